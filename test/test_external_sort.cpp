@@ -0,0 +1,187 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/external_sort.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "test_header.hpp"
+
+namespace
+{
+
+// feeds a vector to external_sort in uneven pieces
+struct vector_source
+{
+    vector_source(const std::vector<int> & data) : data(data), position(0) {}
+
+    std::size_t operator()(int * buffer, std::size_t capacity)
+    {
+        const std::size_t n = std::min(std::min(capacity, data.size() - position), 1 + position % 777);
+        std::copy(data.begin() + position, data.begin() + position + n, buffer);
+        position += n;
+        return n;
+    }
+
+    const std::vector<int> & data;
+    std::size_t              position;
+};
+
+struct vector_sink
+{
+    void operator()(const int * data, std::size_t n)
+    {
+        result->insert(result->end(), data, data + n);
+    }
+
+    std::vector<int> * result;
+};
+
+struct keyed_int
+{
+    int key;
+    int value;
+};
+
+struct key_less
+{
+    bool operator()(const keyed_int & a, const keyed_int & b) const
+    {
+        return a.key < b.key;
+    }
+};
+
+} // end namespace
+
+TEST(ExternalSortTests, TestExternalSortInMemory)
+{
+    thrust::host_vector<int> h_data = get_random_data<int>(1000, 0, 100, 1);
+
+    std::vector<int> data(h_data.begin(), h_data.end());
+    std::vector<int> result;
+
+    thrust::external_sort_options options;
+
+    thrust::external_sort_statistics statistics
+        = thrust::external_sort<int>(thrust::host, vector_source(data), vector_sink{&result}, options);
+
+    std::sort(data.begin(), data.end());
+    ASSERT_EQ(data, result);
+    ASSERT_EQ(statistics.num_elements, 1000u);
+    ASSERT_EQ(statistics.num_runs, 0u);
+    ASSERT_EQ(statistics.bytes_spilled, 0u);
+}
+
+TEST(ExternalSortTests, TestExternalSortEmpty)
+{
+    std::vector<int> data;
+    std::vector<int> result;
+
+    thrust::external_sort_statistics statistics = thrust::external_sort<int>(
+        vector_source(data), vector_sink{&result}, thrust::external_sort_options());
+
+    ASSERT_TRUE(result.empty());
+    ASSERT_EQ(statistics.num_elements, 0u);
+}
+
+TEST(ExternalSortTests, TestExternalSortSpilled)
+{
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(std::size_t max_merge_ways : {std::size_t(0), std::size_t(2), std::size_t(5)})
+        {
+            SCOPED_TRACE(testing::Message() << "with max_merge_ways= " << max_merge_ways);
+
+            thrust::host_vector<int> h_data = get_random_data<int>(size, 0, 1000, 7);
+
+            std::vector<int> data(h_data.begin(), h_data.end());
+            std::vector<int> result;
+
+            thrust::external_sort_options options;
+            options.memory_budget  = 4096 * sizeof(int);
+            options.max_merge_ways = max_merge_ways;
+
+            thrust::external_sort_statistics statistics = thrust::external_sort<int>(
+                thrust::host, vector_source(data), vector_sink{&result}, options, thrust::greater<int>());
+
+            std::sort(data.begin(), data.end(), thrust::greater<int>());
+            ASSERT_EQ(data, result);
+            ASSERT_EQ(statistics.num_elements, size);
+
+            if(size > 2048)
+            {
+                ASSERT_EQ(statistics.num_runs, (size + 2047) / 2048);
+                ASSERT_GE(statistics.bytes_spilled, size * sizeof(int));
+            }
+            if(max_merge_ways == 2 && statistics.num_runs > 2)
+            {
+                ASSERT_GT(statistics.num_merge_passes, 1u);
+            }
+        }
+    }
+}
+
+TEST(ExternalSortTests, TestExternalSortFilesPreserveRunOrder)
+{
+    const int size = 2000;
+
+    std::vector<keyed_int> data(size);
+    for(int i = 0; i < size; i++)
+    {
+        data[i].key   = (i * 7919) % 13;
+        data[i].value = i;
+    }
+
+    std::FILE * input  = std::tmpfile();
+    std::FILE * output = std::tmpfile();
+    ASSERT_NE(input, nullptr);
+    ASSERT_NE(output, nullptr);
+
+    ASSERT_EQ(std::fwrite(data.data(), sizeof(keyed_int), size, input), std::size_t(size));
+    std::rewind(input);
+
+    // one element per chunk, so every element is a run of its own
+    thrust::external_sort_options options;
+    options.memory_budget  = 2 * sizeof(keyed_int);
+    options.max_merge_ways = 3;
+
+    thrust::external_sort<keyed_int>(thrust::host,
+                                     thrust::file_source<keyed_int>(input),
+                                     thrust::file_sink<keyed_int>(output),
+                                     options,
+                                     key_less());
+
+    std::vector<keyed_int> result(size);
+    std::rewind(output);
+    ASSERT_EQ(std::fread(result.data(), sizeof(keyed_int), size, output), std::size_t(size));
+
+    std::stable_sort(data.begin(), data.end(), key_less());
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQ(result[i].key, data[i].key);
+        ASSERT_EQ(result[i].value, data[i].value);
+    }
+
+    std::fclose(input);
+    std::fclose(output);
+}
@@ -0,0 +1,255 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/histogram.h>
+#include <thrust/host_vector.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(HistogramTests, FullTestsParams);
+TESTS_DEFINE(HistogramPrimitiveTests, NumericalTestsParams);
+
+template <typename T>
+thrust::host_vector<int> histogram_even_reference(const thrust::host_vector<T>& samples,
+                                                  int                             num_bins,
+                                                  T                               lower_level,
+                                                  T                               upper_level)
+{
+    thrust::host_vector<int> result(num_bins, 0);
+
+    for(size_t i = 0; i < samples.size(); i++)
+    {
+        const T sample = samples[i];
+        if(sample >= lower_level && sample < upper_level)
+        {
+            int bin = static_cast<int>((static_cast<double>(sample) - static_cast<double>(lower_level))
+                                       * num_bins
+                                       / (static_cast<double>(upper_level) - static_cast<double>(lower_level)));
+            result[bin < num_bins ? bin : num_bins - 1]++;
+        }
+    }
+
+    return result;
+}
+
+TYPED_TEST(HistogramTests, TestHistogramEvenSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector samples(12);
+    for(size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = T(i);
+    }
+
+    Vector counts(5, T(1));
+
+    auto end = thrust::histogram_even(
+        Policy{}, samples.begin(), samples.end(), counts.begin(), 6, T(0), T(10));
+
+    ASSERT_EQ(end - counts.begin(), 5);
+    ASSERT_EQ(counts[0], T(2));
+    ASSERT_EQ(counts[1], T(2));
+    ASSERT_EQ(counts[2], T(2));
+    ASSERT_EQ(counts[3], T(2));
+    ASSERT_EQ(counts[4], T(2));
+}
+
+TYPED_TEST(HistogramTests, TestHistogramRangeSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector samples(8);
+    samples[0] = T(0);
+    samples[1] = T(1);
+    samples[2] = T(5);
+    samples[3] = T(9);
+    samples[4] = T(10);
+    samples[5] = T(42);
+    samples[6] = T(99);
+    samples[7] = T(100);
+
+    Vector levels(4);
+    levels[0] = T(0);
+    levels[1] = T(2);
+    levels[2] = T(10);
+    levels[3] = T(100);
+
+    Vector counts(3, T(1));
+
+    auto end = thrust::histogram_range(
+        Policy{}, samples.begin(), samples.end(), counts.begin(), levels.begin(), levels.end());
+
+    ASSERT_EQ(end - counts.begin(), 3);
+    ASSERT_EQ(counts[0], T(2));
+    ASSERT_EQ(counts[1], T(2));
+    ASSERT_EQ(counts[2], T(3));
+}
+
+TYPED_TEST(HistogramPrimitiveTests, TestHistogramEven)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const T lower_level = T(0);
+    const T upper_level = T(100);
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_samples = get_random_data<T>(size, T(0), T(120), seed);
+            thrust::device_vector<T> d_samples = h_samples;
+
+            for(int num_bins : {1, 7, 100})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_bins= " << num_bins);
+
+                thrust::host_vector<int> expected
+                    = histogram_even_reference(h_samples, num_bins, lower_level, upper_level);
+
+                thrust::host_vector<int> h_counts(num_bins);
+                thrust::histogram_even(h_samples.begin(),
+                                       h_samples.end(),
+                                       h_counts.begin(),
+                                       num_bins + 1,
+                                       lower_level,
+                                       upper_level);
+                ASSERT_EQ(expected, h_counts);
+
+                thrust::device_vector<int> d_counts(num_bins);
+                thrust::histogram_even(d_samples.begin(),
+                                       d_samples.end(),
+                                       d_counts.begin(),
+                                       num_bins + 1,
+                                       lower_level,
+                                       upper_level);
+                thrust::host_vector<int> d_result = d_counts;
+                ASSERT_EQ(expected, d_result);
+            }
+        }
+    }
+}
+
+TEST(HistogramTests, TestHistogramEvenWideRange)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the product of a sample offset and the number of bins exceeds 64 bits
+    const int       num_bins    = 1 << 25;
+    const long long lower_level = 0;
+    const long long upper_level = 1ll << 40;
+
+    thrust::host_vector<long long> h_samples(7);
+    h_samples[0] = 0;
+    h_samples[1] = (1ll << 32) + 1;
+    h_samples[2] = 1ll << 39;
+    h_samples[3] = (1ll << 40) - 1;
+    h_samples[4] = (1ll << 40) - (1ll << 15);
+    h_samples[5] = 1ll << 40;
+    h_samples[6] = -1;
+
+    // a bin is 2^15 wide
+    thrust::host_vector<int> expected(num_bins, 0);
+    expected[0]++;
+    expected[1 << 17]++;
+    expected[1 << 24]++;
+    expected[num_bins - 1] += 2;
+
+    thrust::host_vector<int> h_counts(num_bins);
+    thrust::histogram_even(thrust::host,
+                           h_samples.begin(),
+                           h_samples.end(),
+                           h_counts.begin(),
+                           num_bins + 1,
+                           lower_level,
+                           upper_level);
+    ASSERT_EQ(expected, h_counts);
+
+    thrust::device_vector<long long> d_samples = h_samples;
+    thrust::device_vector<int>       d_counts(num_bins);
+    thrust::histogram_even(d_samples.begin(),
+                           d_samples.end(),
+                           d_counts.begin(),
+                           num_bins + 1,
+                           lower_level,
+                           upper_level);
+    thrust::host_vector<int> d_result = d_counts;
+    ASSERT_EQ(expected, d_result);
+}
+
+TYPED_TEST(HistogramPrimitiveTests, TestMultiHistogramEven)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_pixels = get_random_data<T>(4 * size, T(0), T(100), seed);
+            thrust::device_vector<T> d_pixels = h_pixels;
+
+            thrust::device_vector<int> d_counts[3]
+                = {thrust::device_vector<int>(10), thrust::device_vector<int>(5), thrust::device_vector<int>(2)};
+
+            thrust::device_vector<int>::iterator histograms[3]
+                = {d_counts[0].begin(), d_counts[1].begin(), d_counts[2].begin()};
+            const int num_levels[3]  = {11, 6, 3};
+            const T   lower_level[3] = {T(0), T(0), T(0)};
+            const T   upper_level[3] = {T(100), T(100), T(100)};
+
+            thrust::multi_histogram_even<4, 3>(
+                d_pixels.begin(), d_pixels.end(), histograms, num_levels, lower_level, upper_level);
+
+            for(int c = 0; c < 3; c++)
+            {
+                SCOPED_TRACE(testing::Message() << "with channel= " << c);
+
+                thrust::host_vector<T> h_channel(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    h_channel[i] = h_pixels[4 * i + c];
+                }
+
+                thrust::host_vector<int> expected
+                    = histogram_even_reference(h_channel, num_levels[c] - 1, lower_level[c], upper_level[c]);
+                thrust::host_vector<int> d_result = d_counts[c];
+                ASSERT_EQ(expected, d_result);
+            }
+        }
+    }
+}
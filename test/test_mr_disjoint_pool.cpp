@@ -1,6 +1,8 @@
 #include <thrust/mr/disjoint_pool.h>
 #include <thrust/mr/new.h>
 
+#include <vector>
+
 #include "test_header.hpp"
 
 #if __cplusplus >= 201103L
@@ -271,6 +273,121 @@ TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolCachingOversized)
 }
 #endif
 
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), outstanding(0)
+    {
+    }
+
+    virtual void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    int allocations;
+    int outstanding;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+template<template<typename, typename> class PoolTemplate>
+void TestDisjointPoolSplittingOversized()
+{
+    counting_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef PoolTemplate<
+        counting_resource,
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+
+    {
+        Pool pool(&upstream, &bookkeeper, opts);
+
+        char * a = static_cast<char *>(pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT));
+        ASSERT_EQ(upstream.allocations, 1);
+        pool.do_deallocate(a, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+        // the cached block is split for smaller requests
+        char * b = static_cast<char *>(pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT));
+        char * c = static_cast<char *>(pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT));
+        char * d = static_cast<char *>(pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT));
+        ASSERT_EQ(b, a);
+        ASSERT_EQ(c, a + 2048);
+        ASSERT_EQ(d, a + 6144);
+        ASSERT_EQ(upstream.allocations, 1);
+
+        // and coalesced back as the pieces are returned, in any order
+        pool.do_deallocate(b, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(d, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(c, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+        char * e = static_cast<char *>(pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT));
+        ASSERT_EQ(e, a);
+        ASSERT_EQ(upstream.allocations, 1);
+        pool.do_deallocate(e, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+        pool.release();
+        ASSERT_EQ(upstream.outstanding, 0);
+
+        // many live differently sized blocks are found on deallocation and reused
+        std::vector<void *> blocks;
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(pool.do_allocate(2048 + i * 16, THRUST_MR_DEFAULT_ALIGNMENT));
+        }
+        int allocations = upstream.allocations;
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            std::size_t j = (i * 7) % 1000;
+            pool.do_deallocate(blocks[j], 2048 + j * 16, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            blocks[i] = pool.do_allocate(2048 + i * 16, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+        ASSERT_EQ(upstream.allocations, allocations);
+
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            pool.do_deallocate(blocks[i], 2048 + i * 16, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+    }
+
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+TEST(MrDisjointPoolTests, TestDisjointUnsynchronizedPoolSplittingOversized)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolSplittingOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+
+#if __cplusplus >= 201103L
+TEST(MrDisjointPoolTests, TestDisjointSynchronizedPoolSplittingOversized)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestDisjointPoolSplittingOversized<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+#endif
+
 template<template<typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
@@ -0,0 +1,250 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/mr/monotonic_buffer.h>
+#include <thrust/mr/disjoint_monotonic_buffer.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <memory>
+
+#include "test_header.hpp"
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+    counting_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+template<typename Resource>
+struct resource_maker;
+
+template<>
+struct resource_maker<thrust::mr::monotonic_buffer_resource<counting_resource> >
+{
+    typedef thrust::mr::monotonic_buffer_resource<counting_resource> type;
+
+    static type * make(counting_resource * upstream, std::size_t initial_chunk_size)
+    {
+        return new type(upstream, initial_chunk_size);
+    }
+
+    static type * make(void * buffer, std::size_t size, counting_resource * upstream)
+    {
+        return new type(buffer, size, upstream);
+    }
+};
+
+template<>
+struct resource_maker<thrust::mr::disjoint_monotonic_buffer_resource<counting_resource, thrust::mr::new_delete_resource> >
+{
+    typedef thrust::mr::disjoint_monotonic_buffer_resource<counting_resource, thrust::mr::new_delete_resource> type;
+
+    static type * make(counting_resource * upstream, std::size_t initial_chunk_size)
+    {
+        return new type(upstream, thrust::mr::get_global_resource<thrust::mr::new_delete_resource>(), initial_chunk_size);
+    }
+
+    static type * make(void * buffer, std::size_t size, counting_resource * upstream)
+    {
+        return new type(buffer, size, upstream, thrust::mr::get_global_resource<thrust::mr::new_delete_resource>());
+    }
+};
+
+template<typename Resource>
+void TestMonotonicBufferAllocation()
+{
+    typedef resource_maker<Resource> maker;
+
+    counting_resource upstream;
+    {
+        std::unique_ptr<Resource> resource(maker::make(&upstream, 256));
+
+        // allocations are aligned and do not overlap
+        char * previous = static_cast<char *>(resource->allocate(10, 8));
+        for (std::size_t alignment = 1; alignment <= 64; alignment <<= 1)
+        {
+            char * ptr = static_cast<char *>(resource->allocate(10, alignment));
+            ASSERT_EQ(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+            ASSERT_NE(ptr, previous);
+            previous = ptr;
+        }
+        ASSERT_EQ(upstream.allocations, 1);
+
+        // deallocation does not return memory
+        resource->deallocate(previous, 10, 64);
+        ASSERT_EQ(upstream.outstanding, 1);
+
+        // the chunks grow geometrically
+        for (int i = 0; i < 100; ++i)
+        {
+            void * ptr = resource->allocate(100);
+            static_cast<char *>(ptr)[99] = 0;
+        }
+        ASSERT_LE(upstream.allocations, 7);
+        ASSERT_GE(resource->capacity(), 100u * 100u);
+
+        // a request larger than the next chunk gets a chunk of its own
+        void * large = resource->allocate(1 << 20);
+        static_cast<char *>(large)[(1 << 20) - 1] = 0;
+        ASSERT_GE(resource->capacity(), std::size_t(1) << 20);
+    }
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+template<typename Resource>
+void TestMonotonicBufferRelease()
+{
+    typedef resource_maker<Resource> maker;
+
+    counting_resource upstream;
+    {
+        std::unique_ptr<Resource> resource(maker::make(&upstream, 256));
+
+        for (int i = 0; i < 100; ++i)
+        {
+            void * ptr = resource->allocate(100);
+            (void)ptr;
+        }
+        std::size_t largest = resource->capacity();
+
+        // all but the largest chunk go back upstream
+        resource->release();
+        ASSERT_EQ(upstream.outstanding, 1);
+        ASSERT_LT(resource->capacity(), largest);
+
+        // the same workload is now served without touching upstream
+        int allocations = upstream.allocations;
+        for (int pass = 0; pass < 3; ++pass)
+        {
+            for (int i = 0; i < 40; ++i)
+            {
+                void * ptr = resource->allocate(100);
+                (void)ptr;
+            }
+            resource->release();
+        }
+        ASSERT_EQ(upstream.allocations, allocations);
+    }
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+template<typename Resource>
+void TestMonotonicBufferInitialBuffer()
+{
+    typedef resource_maker<Resource> maker;
+
+    counting_resource upstream;
+    alignas(64) char buffer[1024];
+    {
+        std::unique_ptr<Resource> resource(maker::make(buffer, sizeof(buffer), &upstream));
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            char * ptr = static_cast<char *>(resource->allocate(512));
+            ASSERT_EQ(ptr, buffer);
+            ptr = static_cast<char *>(resource->allocate(256));
+            ASSERT_EQ(ptr, buffer + 512);
+            ASSERT_EQ(upstream.allocations, 0);
+
+            resource->release();
+        }
+
+        // the buffer is exhausted, so the next request goes upstream
+        void * ptr = resource->allocate(800);
+        ptr = resource->allocate(800);
+        (void)ptr;
+        ASSERT_EQ(upstream.allocations, 1);
+    }
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+template<typename Resource>
+void TestMonotonicBufferAllocator()
+{
+    typedef resource_maker<Resource> maker;
+
+    counting_resource upstream;
+    {
+        std::unique_ptr<Resource> resource(maker::make(&upstream, 256));
+
+        typedef thrust::mr::allocator<int, Resource> allocator;
+        allocator alloc(resource.get());
+
+        // containers
+        thrust::host_vector<int, allocator> vec(alloc);
+        for (int i = 0; i < 1000; ++i)
+        {
+            vec.push_back(1000 - i);
+        }
+
+        // temporary storage of algorithms
+        thrust::sort(thrust::host(alloc), vec.begin(), vec.end());
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            ASSERT_EQ(vec[i], i + 1);
+        }
+    }
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+#define MONOTONIC_BUFFER_TESTS(Name, Resource) \
+TEST(MrMonotonicBufferTests, Name##Allocation) \
+{ \
+    TestMonotonicBufferAllocation<Resource>(); \
+} \
+TEST(MrMonotonicBufferTests, Name##Release) \
+{ \
+    TestMonotonicBufferRelease<Resource>(); \
+} \
+TEST(MrMonotonicBufferTests, Name##InitialBuffer) \
+{ \
+    TestMonotonicBufferInitialBuffer<Resource>(); \
+} \
+TEST(MrMonotonicBufferTests, Name##Allocator) \
+{ \
+    TestMonotonicBufferAllocator<Resource>(); \
+}
+
+typedef thrust::mr::monotonic_buffer_resource<counting_resource> monotonic_resource;
+typedef thrust::mr::disjoint_monotonic_buffer_resource<
+    counting_resource,
+    thrust::mr::new_delete_resource
+> disjoint_monotonic_resource;
+
+MONOTONIC_BUFFER_TESTS(MonotonicBuffer, monotonic_resource)
+MONOTONIC_BUFFER_TESTS(DisjointMonotonicBuffer, disjoint_monotonic_resource)
@@ -0,0 +1,241 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/mr/locked_host_resource.h>
+#include <thrust/mr/pinned_pool.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "test_header.hpp"
+
+#if THRUST_DEVICE_COMPILER == THRUST_DEVICE_COMPILER_HIP
+#include <thrust/system/hip/memory.h>
+#endif
+
+struct counting_locked_resource final : thrust::mr::memory_resource<>
+{
+    counting_locked_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::locked_host_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+#if defined(__linux__)
+// the amount of memory locked by this process, in kB
+std::size_t locked_kilobytes()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmLck:") == 0)
+        {
+            return std::stoul(line.substr(6));
+        }
+    }
+    return 0;
+}
+#endif
+
+TEST(MrPinnedPoolTests, TestLockedHostResource)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::mr::locked_host_resource resource;
+    const std::size_t page = thrust::mr::locked_host_resource::page_size();
+
+#if defined(__linux__)
+    const std::size_t locked_before = locked_kilobytes();
+#endif
+
+    std::vector<char *> blocks;
+    for (std::size_t alignment = 1; alignment <= 4 * page; alignment <<= 1)
+    {
+        char * ptr = static_cast<char *>(resource.allocate(1000, alignment));
+        ASSERT_EQ(reinterpret_cast<std::size_t>(ptr) % page, 0u);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+        ptr[0] = 1;
+        ptr[999] = 2;
+        blocks.push_back(ptr);
+    }
+
+#if defined(__linux__)
+    // every block occupies one locked page
+    ASSERT_EQ(locked_kilobytes() - locked_before, blocks.size() * page / 1024);
+#endif
+
+    std::size_t alignment = 1;
+    for (std::size_t i = 0; i < blocks.size(); ++i, alignment <<= 1)
+    {
+        resource.deallocate(blocks[i], 1000, alignment);
+    }
+
+#if defined(__linux__)
+    ASSERT_EQ(locked_kilobytes(), locked_before);
+#endif
+}
+
+TEST(MrPinnedPoolTests, TestLockedHostResourceTryExpand)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::mr::locked_host_resource resource;
+    const std::size_t page = thrust::mr::locked_host_resource::page_size();
+
+#if defined(__linux__)
+    const std::size_t locked_before = locked_kilobytes();
+#endif
+
+    char * ptr = static_cast<char *>(resource.allocate(3 * page));
+
+    // sizes within the same pages always fit
+    ASSERT_TRUE(resource.try_expand(ptr, 3 * page, 3 * page - 100));
+    ASSERT_TRUE(resource.try_expand(ptr, 3 * page - 100, 3 * page));
+
+#if !defined(_WIN32)
+    // shrinking releases the trailing pages
+    ASSERT_TRUE(resource.try_expand(ptr, 3 * page, page));
+#if defined(__linux__)
+    ASSERT_EQ(locked_kilobytes() - locked_before, page / 1024);
+#endif
+
+    // growing depends on whether the following pages are free
+    std::size_t size = page;
+    if (resource.try_expand(ptr, page, 2 * page))
+    {
+        size = 2 * page;
+        ptr[2 * page - 1] = 1;
+#if defined(__linux__)
+        ASSERT_EQ(locked_kilobytes() - locked_before, 2 * page / 1024);
+#endif
+    }
+#else
+    std::size_t size = 3 * page;
+#endif
+
+    resource.deallocate(ptr, size);
+
+#if defined(__linux__)
+    ASSERT_EQ(locked_kilobytes(), locked_before);
+#endif
+
+    // vectors shrink in place
+    typedef thrust::mr::allocator<int, thrust::mr::locked_host_resource> locked_allocator;
+    thrust::host_vector<int, locked_allocator> vec(4 * page, 1, locked_allocator(&resource));
+    const int * data = thrust::raw_pointer_cast(vec.data());
+
+    vec.resize(10);
+    vec.shrink_to_fit();
+    ASSERT_EQ(vec.capacity(), 10u);
+#if !defined(_WIN32)
+    ASSERT_EQ(thrust::raw_pointer_cast(vec.data()), data);
+#endif
+    ASSERT_EQ(vec, thrust::host_vector<int>(10, 1));
+}
+
+TEST(MrPinnedPoolTests, TestPinnedPoolReuse)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    counting_locked_resource upstream;
+    {
+        thrust::mr::pinned_pool_resource<counting_locked_resource> pool(
+            &upstream, thrust::mr::get_global_resource<thrust::mr::new_delete_resource>());
+
+        // small staging buffers share one chunk
+        std::vector<void *> blocks;
+        for (int i = 0; i < 64; ++i)
+        {
+            blocks.push_back(pool.allocate(4096));
+        }
+        ASSERT_EQ(upstream.allocations, 1);
+
+        // and are reused after being returned
+        for (int pass = 0; pass < 10; ++pass)
+        {
+            for (std::size_t i = 0; i < blocks.size(); ++i)
+            {
+                pool.deallocate(blocks[i], 4096);
+            }
+            for (std::size_t i = 0; i < blocks.size(); ++i)
+            {
+                blocks[i] = pool.allocate(4096);
+            }
+        }
+        ASSERT_EQ(upstream.allocations, 1);
+
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            pool.deallocate(blocks[i], 4096);
+        }
+
+        // oversized buffers are cached
+        for (int pass = 0; pass < 10; ++pass)
+        {
+            void * large = pool.allocate(3 << 20);
+            static_cast<char *>(large)[(3 << 20) - 1] = 0;
+            pool.deallocate(large, 3 << 20);
+        }
+        ASSERT_EQ(upstream.allocations, 2);
+
+        pool.release();
+        ASSERT_EQ(upstream.outstanding, 0);
+    }
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+TEST(MrPinnedPoolTests, TestPinnedPoolStaging)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    typedef thrust::mr::stateless_resource_allocator<int, thrust::mr::locked_host_pool_resource>
+        locked_allocator;
+
+    thrust::host_vector<int, locked_allocator> h_staging(1000);
+    thrust::sequence(h_staging.begin(), h_staging.end());
+
+    thrust::device_vector<int> d_vec = h_staging;
+    thrust::host_vector<int, locked_allocator> h_result = d_vec;
+
+    ASSERT_EQ(h_staging, h_result);
+
+#if THRUST_DEVICE_COMPILER == THRUST_DEVICE_COMPILER_HIP
+    thrust::host_vector<int, thrust::hip::universal_host_pinned_pool_allocator<int>> h_pinned
+        = d_vec;
+    ASSERT_EQ(h_staging, h_pinned);
+#endif
+}
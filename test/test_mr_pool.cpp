@@ -337,6 +337,203 @@ TEST(MrPoolTests, TestSynchronizedPoolCachingOversized)
 }
 #endif
 
+template<template<typename> class PoolTemplate>
+void TestPoolSizeClasses()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+
+    {
+        Pool pool(&upstream, opts);
+
+        // with power-of-two buckets, both requests are served from the bucket of 2048 byte blocks
+        upstream.id_to_allocate = 1;
+        tracked_pointer<void> a1 = pool.do_allocate(1100, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a1.id, 1u);
+
+        tracked_pointer<void> a2 = pool.do_allocate(1900, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a2.id, 1u);
+
+        pool.do_deallocate(a1, 1100, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(a2, 1900, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    opts.size_classes_per_doubling = 4;
+    ASSERT_EQ(opts.validate(), true);
+
+    upstream.id_to_allocate = -1u;
+
+    {
+        Pool pool(&upstream, opts);
+
+        // with four classes per doubling, 1100 bytes are rounded up to 1280, and 1900 to 2048
+        upstream.id_to_allocate = 1;
+        tracked_pointer<void> a1 = pool.do_allocate(1100, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a1.id, 1u);
+
+        upstream.id_to_allocate = 2;
+        tracked_pointer<void> a2 = pool.do_allocate(1900, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a2.id, 2u);
+
+        tracked_pointer<void> a3 = pool.do_allocate(1200, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a3.id, 1u);
+        upstream.id_to_allocate = 0;
+
+        // blocks of the same class don't overlap
+        ASSERT_EQ(static_cast<char *>(a3.ptr) - static_cast<char *>(a1.ptr) >= 1280
+            || static_cast<char *>(a1.ptr) - static_cast<char *>(a3.ptr) >= 1280, true);
+
+        // a deallocated block is reused for a request of the same class
+        pool.do_deallocate(a3, 1200, THRUST_MR_DEFAULT_ALIGNMENT);
+        tracked_pointer<void> a4 = pool.do_allocate(1280, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a4.ptr, a3.ptr);
+
+        // classes closer than the alignment are merged
+        upstream.id_to_allocate = 3;
+        tracked_pointer<void> a5 = pool.do_allocate(THRUST_MR_DEFAULT_ALIGNMENT + 1, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a5.id, 3u);
+
+        tracked_pointer<void> a6 = pool.do_allocate(THRUST_MR_DEFAULT_ALIGNMENT * 2, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a6.id, 3u);
+        upstream.id_to_allocate = 0;
+    }
+}
+
+TEST(MrPoolTests, TestUnsynchronizedPoolSizeClasses)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolSizeClasses<thrust::mr::unsynchronized_pool_resource>();
+}
+
+#if __cplusplus >= 201103L
+TEST(MrPoolTests, TestSynchronizedPoolSizeClasses)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolSizeClasses<thrust::mr::synchronized_pool_resource>();
+}
+#endif
+
+template<template<typename> class PoolTemplate>
+void TestPoolTrim()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+
+    {
+        Pool pool(&upstream, opts);
+
+        upstream.id_to_allocate = 1;
+        tracked_pointer<void> a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        tracked_pointer<void> a2 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a1.id, 1u);
+        ASSERT_EQ(a2.id, 1u);
+
+        upstream.id_to_allocate = 2;
+        tracked_pointer<void> a3 = pool.do_allocate(256, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a3.id, 2u);
+
+        upstream.id_to_allocate = 3;
+        tracked_pointer<void> a4 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a4.id, 3u);
+
+        // nothing is idle
+        ASSERT_EQ(pool.trim(), 0u);
+
+        // cached oversized blocks are returned
+        pool.do_deallocate(a4, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        upstream.id_to_deallocate = 3;
+        ASSERT_EQ(pool.trim(), 2048u);
+        ASSERT_EQ(upstream.id_to_deallocate, 0u);
+
+        // idle chunks are returned
+        pool.do_deallocate(a3, 256, THRUST_MR_DEFAULT_ALIGNMENT);
+        upstream.id_to_deallocate = 2;
+        ASSERT_GE(pool.trim(), 256u);
+        ASSERT_EQ(upstream.id_to_deallocate, 0u);
+
+        // chunks in use are kept, along with their free blocks
+        pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(pool.trim(), 0u);
+
+        tracked_pointer<void> a5 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a5.id, 1u);
+
+        pool.do_deallocate(a2, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+        pool.do_deallocate(a5, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+        upstream.id_to_deallocate = 1;
+        ASSERT_GE(pool.trim(), 128u);
+        ASSERT_EQ(upstream.id_to_deallocate, 0u);
+
+        // the pool still works after being trimmed
+        upstream.id_to_allocate = 4;
+        tracked_pointer<void> a6 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a6.id, 4u);
+
+        upstream.id_to_deallocate = 4;
+    }
+    ASSERT_EQ(upstream.id_to_deallocate, 0u);
+
+    opts.idle_bytes_trim_threshold = 1;
+
+    upstream.id_to_allocate = -1u;
+
+    {
+        Pool pool(&upstream, opts);
+
+        upstream.id_to_allocate = 5;
+        tracked_pointer<void> a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a1.id, 5u);
+
+        // a chunk becoming idle above the threshold is returned right away
+        upstream.id_to_deallocate = 5;
+        pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(upstream.id_to_deallocate, 0u);
+
+        upstream.id_to_allocate = 6;
+        tracked_pointer<void> a2 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(a2.id, 6u);
+
+        // and so is a cached oversized block
+        upstream.id_to_deallocate = 6;
+        pool.do_deallocate(a2, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQ(upstream.id_to_deallocate, 0u);
+    }
+}
+
+TEST(MrPoolTests, TestUnsynchronizedPoolTrim)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolTrim<thrust::mr::unsynchronized_pool_resource>();
+}
+
+#if __cplusplus >= 201103L
+TEST(MrPoolTests, TestSynchronizedPoolTrim)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    TestPoolTrim<thrust::mr::synchronized_pool_resource>();
+}
+#endif
+
 template<template<typename> class PoolTemplate>
 void TestGlobalPool()
 {
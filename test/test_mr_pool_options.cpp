@@ -32,6 +32,18 @@ TEST(MrPoolOptionsTests, TestPoolOptionsBasicValidity)
     ASSERT_EQ(options.validate(), false);
     options.smallest_block_size = 8;
     ASSERT_EQ(options.validate(), true);
+
+    // the number of size classes per doubling is not a power of two
+    options.size_classes_per_doubling = 3;
+    ASSERT_EQ(options.validate(), false);
+    options.size_classes_per_doubling = 4;
+    ASSERT_EQ(options.validate(), true);
+
+    // there are more size classes per doubling than bytes in the smallest block
+    options.size_classes_per_doubling = 16;
+    ASSERT_EQ(options.validate(), false);
+    options.size_classes_per_doubling = 4;
+    ASSERT_EQ(options.validate(), true);
 }
 
 TEST(MrPoolOptionsTests, TestPoolOptionsComplexValidity)
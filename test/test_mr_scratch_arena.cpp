@@ -0,0 +1,190 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/mr/scratch_arena.h>
+#include <thrust/execution_policy.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/partition.h>
+#include <thrust/sort.h>
+
+#include <vector>
+
+#include "test_header.hpp"
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+    counting_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+struct is_even
+{
+    __host__ __device__
+    bool operator()(int x) const
+    {
+        return x % 2 == 0;
+    }
+};
+
+TEST(MrScratchArenaTests, TestAlignment)
+{
+    thrust::mr::scratch_arena arena;
+
+    for (std::size_t alignment = 16; alignment <= 4 * 1024; alignment <<= 1)
+    {
+        void * ptr = arena.allocate(100, alignment);
+        ASSERT_EQ(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+        char * char_ptr = static_cast<char *>(ptr);
+        thrust::fill(char_ptr, char_ptr + 100, 0);
+    }
+}
+
+TEST(MrScratchArenaTests, TestLifoReuse)
+{
+    counting_resource upstream;
+    thrust::mr::scratch_arena arena(&upstream);
+
+    void * a = arena.allocate(64);
+    void * b = arena.allocate(64);
+    arena.deallocate(b, 64);
+
+    // the most recent allocation is rewound while a is still outstanding
+    void * c = arena.allocate(64);
+    ASSERT_EQ(b, c);
+
+    arena.deallocate(c, 64);
+    arena.deallocate(a, 64);
+
+    // an idle arena starts over from the beginning of its storage
+    void * d = arena.allocate(64);
+    ASSERT_EQ(a, d);
+    arena.deallocate(d, 64);
+
+    ASSERT_EQ(upstream.allocations, 1);
+}
+
+TEST(MrScratchArenaTests, TestGrowthAndCoalescing)
+{
+    counting_resource upstream;
+
+    {
+        thrust::mr::scratch_arena arena(&upstream);
+
+        std::vector<void *> ptrs;
+        for (std::size_t bytes = 1024; bytes <= 1024 * 1024; bytes *= 2)
+        {
+            ptrs.push_back(arena.allocate(bytes));
+        }
+        ASSERT_GT(upstream.allocations, 1);
+
+        for (std::size_t i = 0, bytes = 1024; i < ptrs.size(); ++i, bytes *= 2)
+        {
+            arena.deallocate(ptrs[i], bytes);
+        }
+
+        const std::size_t capacity = arena.capacity();
+        const int allocations = upstream.allocations;
+
+        // replaying the workload is served from a single coalesced block
+        for (int iteration = 0; iteration < 2; ++iteration)
+        {
+            ptrs.clear();
+            for (std::size_t bytes = 1024; bytes <= 1024 * 1024; bytes *= 2)
+            {
+                ptrs.push_back(arena.allocate(bytes));
+            }
+            for (std::size_t i = 0, bytes = 1024; i < ptrs.size(); ++i, bytes *= 2)
+            {
+                arena.deallocate(ptrs[i], bytes);
+            }
+        }
+
+        ASSERT_EQ(upstream.allocations, allocations + 1);
+        ASSERT_EQ(upstream.outstanding, 1);
+        ASSERT_EQ(arena.capacity(), capacity);
+    }
+
+    ASSERT_EQ(upstream.outstanding, 0);
+}
+
+TEST(MrScratchArenaTests, TestWithScratchArena)
+{
+    counting_resource upstream;
+    thrust::mr::scratch_arena arena(&upstream);
+
+    std::vector<int> data(1000);
+    for (int iteration = 0; iteration < 10; ++iteration)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<int>((i * 7919 + iteration) % 1000);
+        }
+
+        thrust::stable_sort(thrust::cpp::par.with_scratch_arena(arena), data.begin(), data.end());
+        ASSERT_TRUE(thrust::is_sorted(data.begin(), data.end()));
+
+        thrust::stable_partition(thrust::cpp::par.with_scratch_arena(arena), data.begin(), data.end(), is_even());
+        ASSERT_TRUE(thrust::is_partitioned(data.begin(), data.end(), is_even()));
+    }
+
+    ASSERT_GT(upstream.allocations, 0);
+    ASSERT_LE(upstream.allocations, 2);
+}
+
+TEST(MrScratchArenaTests, TestDefaultScratchArena)
+{
+    counting_resource upstream;
+    thrust::mr::scratch_arena arena(&upstream);
+
+    ASSERT_EQ(thrust::mr::get_default_scratch_arena(), nullptr);
+    ASSERT_EQ(thrust::mr::set_default_scratch_arena(&arena), nullptr);
+
+    std::vector<int> data(1000);
+    for (int iteration = 0; iteration < 10; ++iteration)
+    {
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<int>((i * 7919 + iteration) % 1000);
+        }
+
+        thrust::stable_partition(thrust::host, data.begin(), data.end(), is_even());
+        ASSERT_TRUE(thrust::is_partitioned(data.begin(), data.end(), is_even()));
+    }
+
+    ASSERT_EQ(thrust::mr::set_default_scratch_arena(nullptr), &arena);
+
+    ASSERT_GT(upstream.allocations, 0);
+    ASSERT_LE(upstream.allocations, 2);
+    ASSERT_EQ(upstream.outstanding, static_cast<int>(arena.capacity() > 0));
+}
@@ -0,0 +1,287 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(MultiwayMergeTests, VectorIntegerTestsParams);
+TESTS_DEFINE(MultiwayMergePrimitiveTests, NumericalTestsParams);
+
+TYPED_TEST(MultiwayMergeTests, TestMultiwayMergeSimple)
+{
+    using Vector   = typename TestFixture::input_type;
+    using Policy   = typename TestFixture::execution_policy;
+    using T        = typename Vector::value_type;
+    using Iterator = typename Vector::iterator;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(9);
+    data[0] = T(0); data[1] = T(4); data[2] = T(8);
+    data[3] = T(1); data[4] = T(5);
+    data[5] = T(2); data[6] = T(3); data[7] = T(6); data[8] = T(7);
+
+    std::vector<thrust::pair<Iterator, Iterator>> runs;
+    runs.push_back(thrust::make_pair(data.begin() + 0, data.begin() + 3));
+    runs.push_back(thrust::make_pair(data.begin() + 3, data.begin() + 5));
+    runs.push_back(thrust::make_pair(data.begin() + 5, data.begin() + 5));
+    runs.push_back(thrust::make_pair(data.begin() + 5, data.begin() + 9));
+
+    Vector result(9);
+
+    Iterator end = thrust::multiway_merge(Policy{}, runs.begin(), runs.end(), result.begin());
+
+    ASSERT_EQ(end, result.end());
+    for(size_t i = 0; i < 9; i++)
+    {
+        ASSERT_EQ(result[i], T(i));
+    }
+}
+
+TYPED_TEST(MultiwayMergeTests, TestMultiwayMergeComparator)
+{
+    using Vector   = typename TestFixture::input_type;
+    using Policy   = typename TestFixture::execution_policy;
+    using T        = typename Vector::value_type;
+    using Iterator = typename Vector::iterator;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(6);
+    data[0] = T(5); data[1] = T(2);
+    data[2] = T(4); data[3] = T(1);
+    data[4] = T(6); data[5] = T(3);
+
+    std::vector<thrust::pair<Iterator, Iterator>> runs;
+    runs.push_back(thrust::make_pair(data.begin() + 0, data.begin() + 2));
+    runs.push_back(thrust::make_pair(data.begin() + 2, data.begin() + 4));
+    runs.push_back(thrust::make_pair(data.begin() + 4, data.begin() + 6));
+
+    Vector result(6);
+
+    Iterator end = thrust::multiway_merge(
+        Policy{}, runs.begin(), runs.end(), result.begin(), thrust::greater<T>());
+
+    ASSERT_EQ(end, result.end());
+    for(size_t i = 0; i < 6; i++)
+    {
+        ASSERT_EQ(result[i], T(6 - i));
+    }
+}
+
+TYPED_TEST(MultiwayMergeTests, TestMultiwayMergeByKeyStable)
+{
+    using Vector   = typename TestFixture::input_type;
+    using Policy   = typename TestFixture::execution_policy;
+    using T        = typename Vector::value_type;
+    using Iterator = typename Vector::iterator;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // every run holds the same keys, so the values tell the runs apart
+    Vector keys(9);
+    keys[0] = T(1); keys[1] = T(2); keys[2] = T(2);
+    keys[3] = T(1); keys[4] = T(2); keys[5] = T(2);
+    keys[6] = T(1); keys[7] = T(2); keys[8] = T(2);
+
+    Vector values(9);
+    thrust::sequence(values.begin(), values.end());
+
+    std::vector<thrust::pair<Iterator, Iterator>> runs;
+    std::vector<Iterator>                         values_runs;
+    for(int i = 0; i < 3; i++)
+    {
+        runs.push_back(thrust::make_pair(keys.begin() + 3 * i, keys.begin() + 3 * i + 3));
+        values_runs.push_back(values.begin() + 3 * i);
+    }
+
+    Vector keys_result(9);
+    Vector values_result(9);
+
+    thrust::pair<Iterator, Iterator> ends = thrust::multiway_merge_by_key(Policy{},
+                                                                          runs.begin(),
+                                                                          runs.end(),
+                                                                          values_runs.begin(),
+                                                                          keys_result.begin(),
+                                                                          values_result.begin());
+
+    ASSERT_EQ(ends.first, keys_result.end());
+    ASSERT_EQ(ends.second, values_result.end());
+
+    const T expected_keys[9]   = {1, 1, 1, 2, 2, 2, 2, 2, 2};
+    const T expected_values[9] = {0, 3, 6, 1, 2, 4, 5, 7, 8};
+    for(size_t i = 0; i < 9; i++)
+    {
+        ASSERT_EQ(keys_result[i], expected_keys[i]);
+        ASSERT_EQ(values_result[i], expected_values[i]);
+    }
+}
+
+// compares the elements first, first + 1, ... by their weights and records
+// any argument which is not an element
+struct checked_weight_less
+{
+    int        first;
+    int        n;
+    const int* weights;
+    int*       invalid;
+
+    bool operator()(int a, int b) const
+    {
+        if(a < first || a >= first + n || b < first || b >= first + n)
+        {
+            *invalid = 1;
+            return false;
+        }
+
+        return weights[a - first] < weights[b - first];
+    }
+};
+
+TEST(MultiwayMergeTests, TestMultiwayMergeComparatorArguments)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    using Iterator = std::vector<int>::iterator;
+
+    const int first = 1000;
+    const int n     = 12;
+
+    const int weights[n] = {7, 3, 3, 9, 0, 5, 3, 8, 1, 6, 2, 5};
+
+    // five runs, one of them empty, so the tree has padding leaves as well
+    const int       num_runs              = 5;
+    const ptrdiff_t offsets[num_runs + 1] = {0, 3, 3, 7, 9, 12};
+
+    std::vector<int> keys(n);
+    for(int i = 0; i < n; i++)
+    {
+        keys[i] = first + i;
+    }
+
+    int                 invalid = 0;
+    checked_weight_less comp    = {first, n, weights, &invalid};
+
+    std::vector<thrust::pair<Iterator, Iterator>> runs;
+    std::vector<Iterator>                         values_runs;
+    for(int i = 0; i < num_runs; i++)
+    {
+        std::stable_sort(keys.begin() + offsets[i], keys.begin() + offsets[i + 1], comp);
+        runs.push_back(thrust::make_pair(keys.begin() + offsets[i], keys.begin() + offsets[i + 1]));
+    }
+
+    std::vector<int> values(n);
+    for(int i = 0; i < n; i++)
+    {
+        values[i] = keys[i] - first;
+    }
+    for(int i = 0; i < num_runs; i++)
+    {
+        values_runs.push_back(values.begin() + offsets[i]);
+    }
+
+    // a stable merge of the runs is a stable sort of their concatenation
+    std::vector<int> expected = keys;
+    std::stable_sort(expected.begin(), expected.end(), comp);
+
+    std::vector<int> result(n);
+    thrust::multiway_merge(thrust::host, runs.begin(), runs.end(), result.begin(), comp);
+    ASSERT_EQ(invalid, 0);
+    ASSERT_EQ(result, expected);
+
+    std::vector<int> keys_result(n);
+    std::vector<int> values_result(n);
+    thrust::multiway_merge_by_key(thrust::host,
+                                  runs.begin(),
+                                  runs.end(),
+                                  values_runs.begin(),
+                                  keys_result.begin(),
+                                  values_result.begin(),
+                                  comp);
+    ASSERT_EQ(invalid, 0);
+    ASSERT_EQ(keys_result, expected);
+    for(int i = 0; i < n; i++)
+    {
+        ASSERT_EQ(values_result[i], keys_result[i] - first);
+    }
+}
+
+TYPED_TEST(MultiwayMergePrimitiveTests, TestMultiwayMerge)
+{
+    using T        = typename TestFixture::input_type;
+    using Iterator = typename thrust::device_vector<T>::iterator;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(size, T(0), T(100), seed);
+
+            for(size_t num_runs : {size_t(1), size_t(3), size_t(8), size_t(33)})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_runs= " << num_runs);
+
+                // cut the input into runs of uneven length and sort each one
+                std::vector<size_t> offsets(num_runs + 1);
+                for(size_t i = 0; i <= num_runs; i++)
+                {
+                    offsets[i] = size * i * i / (num_runs * num_runs);
+                }
+
+                thrust::host_vector<T> h_runs = h_data;
+                for(size_t i = 0; i < num_runs; i++)
+                {
+                    thrust::sort(h_runs.begin() + offsets[i], h_runs.begin() + offsets[i + 1]);
+                }
+
+                thrust::host_vector<T> h_expected = h_data;
+                thrust::sort(h_expected.begin(), h_expected.end());
+
+                thrust::device_vector<T> d_runs = h_runs;
+
+                std::vector<thrust::pair<Iterator, Iterator>> runs;
+                for(size_t i = 0; i < num_runs; i++)
+                {
+                    runs.push_back(
+                        thrust::make_pair(d_runs.begin() + offsets[i], d_runs.begin() + offsets[i + 1]));
+                }
+
+                thrust::device_vector<T> d_result(size);
+                thrust::multiway_merge(runs.begin(), runs.end(), d_result.begin());
+
+                thrust::host_vector<T> h_result = d_result;
+                ASSERT_EQ(h_expected, h_result);
+            }
+        }
+    }
+}
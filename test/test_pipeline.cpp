@@ -0,0 +1,163 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/pipeline.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(PipelineSignedTests, VectorSignedTestsParams);
+TESTS_DEFINE(PipelineIntegerPrimitiveTests, IntegerTestsParams);
+
+template <typename T>
+struct is_odd_pipeline
+{
+    __host__ __device__ bool operator()(T x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+template <typename T>
+struct is_positive_pipeline
+{
+    __host__ __device__ bool operator()(T x) const
+    {
+        return x > T(0);
+    }
+};
+
+TYPED_TEST(PipelineSignedTests, TestPipelineSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(5);
+    data[0] = T(1);
+    data[1] = T(-2);
+    data[2] = T(3);
+    data[3] = T(0);
+    data[4] = T(4);
+
+    T sum = thrust::pipeline(Policy{}, data.begin(), data.end())
+          | thrust::transformed(thrust::negate<T>())
+          | thrust::reduced(T(10));
+    ASSERT_EQ(sum, T(4));
+
+    T filtered_sum = thrust::pipeline(Policy{}, data.begin(), data.end())
+                   | thrust::filtered(is_positive_pipeline<T>())
+                   | thrust::transformed(thrust::negate<T>())
+                   | thrust::reduced(T(10));
+    ASSERT_EQ(filtered_sum, T(2));
+
+    auto count = thrust::pipeline(Policy{}, data.begin(), data.end())
+               | thrust::filtered(is_positive_pipeline<T>())
+               | thrust::counted();
+    ASSERT_EQ(count, 3);
+
+    Vector output(5, T(0));
+    auto end = thrust::pipeline(Policy{}, data.begin(), data.end())
+             | thrust::filtered(is_positive_pipeline<T>())
+             | thrust::transformed(thrust::negate<T>())
+             | thrust::copied(output.begin());
+    ASSERT_EQ(end - output.begin(), 3);
+    ASSERT_EQ(output[0], T(-1));
+    ASSERT_EQ(output[1], T(-3));
+    ASSERT_EQ(output[2], T(-4));
+}
+
+TYPED_TEST(PipelineSignedTests, TestPipelineEmpty)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(3, T(-1));
+
+    T result = thrust::pipeline(Policy{}, data.begin(), data.end())
+             | thrust::filtered(is_positive_pipeline<T>())
+             | thrust::reduced(T(13), thrust::maximum<T>());
+    ASSERT_EQ(result, T(13));
+
+    auto count = thrust::pipeline(Policy{}, data.begin(), data.begin())
+               | thrust::counted();
+    ASSERT_EQ(count, 0);
+}
+
+TYPED_TEST(PipelineIntegerPrimitiveTests, TestPipeline)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(
+                size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), seed);
+
+            thrust::device_vector<T> d_data = h_data;
+
+            // reference: the same stages run as separate passes on the host
+            thrust::host_vector<T> h_transformed(size);
+            thrust::transform(h_data.begin(), h_data.end(), h_transformed.begin(), thrust::negate<T>());
+            thrust::host_vector<T> h_filtered(size);
+            h_filtered.erase(thrust::copy_if(h_transformed.begin(),
+                                             h_transformed.end(),
+                                             h_filtered.begin(),
+                                             is_odd_pipeline<T>()),
+                             h_filtered.end());
+
+            T cpu_result = thrust::reduce(h_filtered.begin(), h_filtered.end(), T(13));
+            T gpu_result = thrust::pipeline(d_data.begin(), d_data.end())
+                         | thrust::transformed(thrust::negate<T>())
+                         | thrust::filtered(is_odd_pipeline<T>())
+                         | thrust::reduced(T(13));
+            ASSERT_EQ(cpu_result, gpu_result);
+
+            auto gpu_count = thrust::pipeline(d_data.begin(), d_data.end())
+                           | thrust::transformed(thrust::negate<T>())
+                           | thrust::filtered(is_odd_pipeline<T>())
+                           | thrust::counted();
+            ASSERT_EQ(static_cast<size_t>(gpu_count), h_filtered.size());
+
+            thrust::device_vector<T> d_output(size);
+            auto d_end = thrust::pipeline(d_data.begin(), d_data.end())
+                       | thrust::transformed(thrust::negate<T>())
+                       | thrust::filtered(is_odd_pipeline<T>())
+                       | thrust::copied(d_output.begin());
+            d_output.erase(d_end, d_output.end());
+
+            thrust::host_vector<T> h_output = d_output;
+            ASSERT_EQ(h_filtered, h_output);
+        }
+    }
+}
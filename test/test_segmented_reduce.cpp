@@ -0,0 +1,257 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_reduce.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SegmentedReduceTests, VectorIntegerTestsParams);
+TESTS_DEFINE(SegmentedReducePrimitiveTests, NumericalTestsParams);
+
+template <typename T>
+struct square
+{
+    __host__ __device__ T operator()(const T& x) const
+    {
+        return x * x;
+    }
+};
+
+TYPED_TEST(SegmentedReduceTests, TestSegmentedReduceSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(7);
+    values[0] = T(2); values[1] = T(0);
+    values[2] = T(3); values[3] = T(1); values[4] = T(4);
+    values[5] = T(6); values[6] = T(5);
+
+    // the second segment is empty
+    Vector offsets(5);
+    offsets[0] = T(0); offsets[1] = T(2); offsets[2] = T(2); offsets[3] = T(5); offsets[4] = T(7);
+
+    Vector result(4);
+
+    typename Vector::iterator iter = thrust::segmented_reduce(Policy{},
+                                                              values.begin(),
+                                                              offsets.begin(),
+                                                              offsets.end() - 1,
+                                                              offsets.begin() + 1,
+                                                              result.begin());
+
+    ASSERT_EQ(iter - result.begin(), 4);
+    ASSERT_EQ(result[0], T(2));
+    ASSERT_EQ(result[1], T(0));
+    ASSERT_EQ(result[2], T(8));
+    ASSERT_EQ(result[3], T(11));
+
+    thrust::segmented_reduce(Policy{},
+                             values.begin(),
+                             offsets.begin(),
+                             offsets.end() - 1,
+                             offsets.begin() + 1,
+                             result.begin(),
+                             T(1),
+                             thrust::maximum<T>());
+
+    ASSERT_EQ(result[0], T(2));
+    ASSERT_EQ(result[1], T(1));
+    ASSERT_EQ(result[2], T(4));
+    ASSERT_EQ(result[3], T(6));
+
+    thrust::segmented_transform_reduce(Policy{},
+                                       values.begin(),
+                                       offsets.begin(),
+                                       offsets.end() - 1,
+                                       offsets.begin() + 1,
+                                       result.begin(),
+                                       square<T>(),
+                                       T(0),
+                                       thrust::plus<T>());
+
+    ASSERT_EQ(result[0], T(4));
+    ASSERT_EQ(result[1], T(0));
+    ASSERT_EQ(result[2], T(26));
+    ASSERT_EQ(result[3], T(61));
+}
+
+TYPED_TEST(SegmentedReduceTests, TestSegmentedMinMaxElementSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(7);
+    values[0] = T(2); values[1] = T(0);
+    values[2] = T(3); values[3] = T(1); values[4] = T(3);
+    values[5] = T(6); values[6] = T(5);
+
+    Vector offsets(5);
+    offsets[0] = T(0); offsets[1] = T(2); offsets[2] = T(2); offsets[3] = T(5); offsets[4] = T(7);
+
+    thrust::device_vector<int> positions(4);
+
+    thrust::segmented_min_element(Policy{},
+                                  values.begin(),
+                                  offsets.begin(),
+                                  offsets.end() - 1,
+                                  offsets.begin() + 1,
+                                  positions.begin());
+
+    ASSERT_EQ(positions[0], 1);
+    ASSERT_EQ(positions[1], 2);
+    ASSERT_EQ(positions[2], 3);
+    ASSERT_EQ(positions[3], 6);
+
+    // the first of equal largest elements is found
+    thrust::segmented_max_element(Policy{},
+                                  values.begin(),
+                                  offsets.begin(),
+                                  offsets.end() - 1,
+                                  offsets.begin() + 1,
+                                  positions.begin());
+
+    ASSERT_EQ(positions[0], 0);
+    ASSERT_EQ(positions[1], 2);
+    ASSERT_EQ(positions[2], 2);
+    ASSERT_EQ(positions[3], 5);
+
+    thrust::segmented_max_element(Policy{},
+                                  values.begin(),
+                                  offsets.begin(),
+                                  offsets.end() - 1,
+                                  offsets.begin() + 1,
+                                  positions.begin(),
+                                  thrust::greater<T>());
+
+    ASSERT_EQ(positions[0], 1);
+    ASSERT_EQ(positions[1], 2);
+    ASSERT_EQ(positions[2], 3);
+    ASSERT_EQ(positions[3], 6);
+}
+
+TYPED_TEST(SegmentedReduceTests, TestSegmentedReduceNoSegments)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector values(3, T(1));
+    Vector offsets(1, T(0));
+    Vector result(1, T(7));
+
+    typename Vector::iterator iter = thrust::segmented_reduce(Policy{},
+                                                              values.begin(),
+                                                              offsets.begin(),
+                                                              offsets.begin(),
+                                                              offsets.begin(),
+                                                              result.begin());
+
+    ASSERT_EQ(iter, result.begin());
+    ASSERT_EQ(result[0], T(7));
+}
+
+// CSR-like row lengths: mostly short rows with a few very long ones
+thrust::host_vector<int> get_row_offsets(size_t size, int seed_value)
+{
+    std::default_random_engine rng(seed_value);
+
+    thrust::host_vector<int> offsets(1, 0);
+    size_t                   offset = 0;
+
+    while(offset < size)
+    {
+        const int    kind   = std::uniform_int_distribution<int>(0, 99)(rng);
+        const size_t length = kind < 90 ? std::uniform_int_distribution<size_t>(0, 16)(rng)
+                                        : std::uniform_int_distribution<size_t>(17, 50000)(rng);
+
+        offset = std::min(size, offset + length);
+        offsets.push_back(static_cast<int>(offset));
+    }
+
+    return offsets;
+}
+
+TYPED_TEST(SegmentedReducePrimitiveTests, TestSegmentedReduce)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T>   h_values = get_random_data<T>(size, T(0), T(10), seed);
+            thrust::host_vector<int> offsets  = get_row_offsets(size, seed);
+            const size_t             num_rows = offsets.size() - 1;
+
+            thrust::device_vector<T>   d_values  = h_values;
+            thrust::device_vector<int> d_offsets = offsets;
+
+            thrust::host_vector<T>   h_sums(num_rows);
+            thrust::host_vector<int> h_maxima(num_rows);
+
+            for(size_t i = 0; i < num_rows; i++)
+            {
+                h_sums[i]   = thrust::reduce(h_values.begin() + offsets[i],
+                                             h_values.begin() + offsets[i + 1],
+                                             T(0),
+                                             thrust::maximum<T>());
+                h_maxima[i] = thrust::max_element(h_values.begin() + offsets[i],
+                                                  h_values.begin() + offsets[i + 1])
+                              - h_values.begin();
+            }
+
+            thrust::device_vector<T>   d_sums(num_rows);
+            thrust::device_vector<int> d_maxima(num_rows);
+
+            thrust::segmented_reduce(d_values.begin(),
+                                     d_offsets.begin(),
+                                     d_offsets.end() - 1,
+                                     d_offsets.begin() + 1,
+                                     d_sums.begin(),
+                                     T(0),
+                                     thrust::maximum<T>());
+
+            thrust::segmented_max_element(d_values.begin(),
+                                          d_offsets.begin(),
+                                          d_offsets.end() - 1,
+                                          d_offsets.begin() + 1,
+                                          d_maxima.begin());
+
+            ASSERT_EQ(h_sums, d_sums);
+            ASSERT_EQ(h_maxima, d_maxima);
+        }
+    }
+}
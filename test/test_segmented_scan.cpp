@@ -0,0 +1,128 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/scan.h>
+#include <thrust/segmented_scan.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SegmentedScanTests, VectorIntegerTestsParams);
+TESTS_DEFINE(SegmentedScanPrimitiveTests, NumericalTestsParams);
+
+TYPED_TEST(SegmentedScanTests, TestSegmentedInclusiveScanSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector input(6);
+    input[0] = T(1); input[1] = T(2); input[2] = T(3);
+    input[3] = T(4);
+    input[4] = T(5); input[5] = T(6);
+
+    // the element at offset 3 belongs to no segment
+    Vector begin_offsets(2);
+    begin_offsets[0] = T(0); begin_offsets[1] = T(4);
+
+    Vector end_offsets(2);
+    end_offsets[0] = T(3); end_offsets[1] = T(6);
+
+    Vector output(6, T(9));
+
+    thrust::segmented_inclusive_scan(Policy{},
+                                     input.begin(),
+                                     begin_offsets.begin(),
+                                     begin_offsets.end(),
+                                     end_offsets.begin(),
+                                     output.begin());
+
+    ASSERT_EQ(output[0], T(1));
+    ASSERT_EQ(output[1], T(3));
+    ASSERT_EQ(output[2], T(6));
+    ASSERT_EQ(output[3], T(9));
+    ASSERT_EQ(output[4], T(5));
+    ASSERT_EQ(output[5], T(11));
+
+    // in-place
+    thrust::segmented_inclusive_scan(Policy{},
+                                     input.begin(),
+                                     begin_offsets.begin(),
+                                     begin_offsets.end(),
+                                     end_offsets.begin(),
+                                     input.begin(),
+                                     thrust::maximum<T>());
+
+    ASSERT_EQ(input[0], T(1));
+    ASSERT_EQ(input[1], T(2));
+    ASSERT_EQ(input[2], T(3));
+    ASSERT_EQ(input[3], T(4));
+    ASSERT_EQ(input[4], T(5));
+    ASSERT_EQ(input[5], T(6));
+}
+
+TYPED_TEST(SegmentedScanPrimitiveTests, TestSegmentedInclusiveScan)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_input = get_random_data<T>(size, T(0), T(10), seed);
+
+            std::default_random_engine rng(seed);
+            thrust::host_vector<int>   offsets(1, 0);
+            while(static_cast<size_t>(offsets.back()) < size)
+            {
+                const size_t length = std::uniform_int_distribution<size_t>(0, 3000)(rng);
+                offsets.push_back(static_cast<int>(std::min(size, offsets.back() + length)));
+            }
+
+            thrust::device_vector<T>   d_input   = h_input;
+            thrust::device_vector<int> d_offsets = offsets;
+
+            thrust::host_vector<T> h_output(size);
+            for(size_t i = 0; i + 1 < offsets.size(); i++)
+            {
+                thrust::inclusive_scan(h_input.begin() + offsets[i],
+                                       h_input.begin() + offsets[i + 1],
+                                       h_output.begin() + offsets[i],
+                                       thrust::maximum<T>());
+            }
+
+            thrust::device_vector<T> d_output(size);
+            thrust::segmented_inclusive_scan(d_input.begin(),
+                                             d_offsets.begin(),
+                                             d_offsets.end() - 1,
+                                             d_offsets.begin() + 1,
+                                             d_output.begin(),
+                                             thrust::maximum<T>());
+
+            ASSERT_EQ(h_output, d_output);
+        }
+    }
+}
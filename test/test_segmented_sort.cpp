@@ -0,0 +1,267 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SegmentedSortTests, VectorIntegerTestsParams);
+TESTS_DEFINE(SegmentedSortPrimitiveTests, NumericalTestsParams);
+
+TYPED_TEST(SegmentedSortTests, TestSegmentedSortSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(9);
+    keys[0] = T(3); keys[1] = T(1); keys[2] = T(2);
+    keys[3] = T(9); keys[4] = T(7);
+    keys[5] = T(8);
+    keys[6] = T(6); keys[7] = T(4); keys[8] = T(5);
+
+    // the element at offset 5 belongs to no segment
+    Vector begin_offsets(3);
+    begin_offsets[0] = T(0); begin_offsets[1] = T(3); begin_offsets[2] = T(6);
+
+    Vector end_offsets(3);
+    end_offsets[0] = T(3); end_offsets[1] = T(5); end_offsets[2] = T(9);
+
+    thrust::segmented_sort(Policy{},
+                           keys.begin(),
+                           keys.end(),
+                           begin_offsets.begin(),
+                           begin_offsets.end(),
+                           end_offsets.begin());
+
+    ASSERT_EQ(keys[0], T(1));
+    ASSERT_EQ(keys[1], T(2));
+    ASSERT_EQ(keys[2], T(3));
+    ASSERT_EQ(keys[3], T(7));
+    ASSERT_EQ(keys[4], T(9));
+    ASSERT_EQ(keys[5], T(8));
+    ASSERT_EQ(keys[6], T(4));
+    ASSERT_EQ(keys[7], T(5));
+    ASSERT_EQ(keys[8], T(6));
+
+    thrust::stable_segmented_sort(Policy{},
+                                  keys.begin(),
+                                  keys.end(),
+                                  begin_offsets.begin(),
+                                  begin_offsets.end(),
+                                  end_offsets.begin(),
+                                  thrust::greater<T>());
+
+    ASSERT_EQ(keys[0], T(3));
+    ASSERT_EQ(keys[1], T(2));
+    ASSERT_EQ(keys[2], T(1));
+    ASSERT_EQ(keys[3], T(9));
+    ASSERT_EQ(keys[4], T(7));
+    ASSERT_EQ(keys[5], T(8));
+    ASSERT_EQ(keys[6], T(6));
+    ASSERT_EQ(keys[7], T(5));
+    ASSERT_EQ(keys[8], T(4));
+}
+
+TYPED_TEST(SegmentedSortTests, TestSegmentedSortByKeySimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(6);
+    keys[0] = T(30); keys[1] = T(10); keys[2] = T(20);
+    keys[3] = T(5);
+    keys[4] = T(8); keys[5] = T(7);
+
+    Vector values(6);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = T(i);
+    }
+
+    Vector offsets(4);
+    offsets[0] = T(0); offsets[1] = T(3); offsets[2] = T(4); offsets[3] = T(6);
+
+    thrust::segmented_sort_by_key(Policy{},
+                                  keys.begin(),
+                                  keys.end(),
+                                  values.begin(),
+                                  offsets.begin(),
+                                  offsets.end() - 1,
+                                  offsets.begin() + 1);
+
+    ASSERT_EQ(keys[0], T(10));
+    ASSERT_EQ(keys[1], T(20));
+    ASSERT_EQ(keys[2], T(30));
+    ASSERT_EQ(keys[3], T(5));
+    ASSERT_EQ(keys[4], T(7));
+    ASSERT_EQ(keys[5], T(8));
+
+    ASSERT_EQ(values[0], T(1));
+    ASSERT_EQ(values[1], T(2));
+    ASSERT_EQ(values[2], T(0));
+    ASSERT_EQ(values[3], T(3));
+    ASSERT_EQ(values[4], T(5));
+    ASSERT_EQ(values[5], T(4));
+}
+
+TYPED_TEST(SegmentedSortTests, TestSegmentedSortNoSegments)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(3);
+    keys[0] = T(2); keys[1] = T(1); keys[2] = T(0);
+
+    Vector offsets(1, T(0));
+
+    thrust::segmented_sort(Policy{},
+                           keys.begin(),
+                           keys.end(),
+                           offsets.begin(),
+                           offsets.begin(),
+                           offsets.begin());
+
+    ASSERT_EQ(keys[0], T(2));
+    ASSERT_EQ(keys[1], T(1));
+    ASSERT_EQ(keys[2], T(0));
+}
+
+// segment lengths mix empty, tiny, medium and a few long segments
+thrust::host_vector<int> get_segment_offsets(size_t size, int seed_value)
+{
+    std::default_random_engine rng(seed_value);
+
+    thrust::host_vector<int> offsets(1, 0);
+    size_t                   offset = 0;
+
+    while(offset < size)
+    {
+        const int    kind   = std::uniform_int_distribution<int>(0, 99)(rng);
+        const size_t length = kind < 70   ? std::uniform_int_distribution<size_t>(0, 8)(rng)
+                              : kind < 95 ? std::uniform_int_distribution<size_t>(9, 300)(rng)
+                                          : std::uniform_int_distribution<size_t>(301, 20000)(rng);
+
+        offset = std::min(size, offset + length);
+        offsets.push_back(static_cast<int>(offset));
+    }
+
+    return offsets;
+}
+
+template <typename T>
+void segmented_sort_by_key_reference(thrust::host_vector<T>&         keys,
+                                     thrust::host_vector<int>&       values,
+                                     const thrust::host_vector<int>& offsets)
+{
+    for(size_t i = 0; i + 1 < offsets.size(); i++)
+    {
+        thrust::stable_sort_by_key(keys.begin() + offsets[i],
+                                   keys.begin() + offsets[i + 1],
+                                   values.begin() + offsets[i]);
+    }
+}
+
+TYPED_TEST(SegmentedSortPrimitiveTests, TestStableSegmentedSortByKey)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T>   h_keys  = get_random_data<T>(size, T(0), T(16), seed);
+            thrust::host_vector<int> offsets = get_segment_offsets(size, seed);
+
+            thrust::host_vector<int> h_values(size);
+            thrust::sequence(h_values.begin(), h_values.end());
+
+            thrust::device_vector<T>   d_keys    = h_keys;
+            thrust::device_vector<int> d_values  = h_values;
+            thrust::device_vector<int> d_offsets = offsets;
+
+            segmented_sort_by_key_reference(h_keys, h_values, offsets);
+
+            thrust::stable_segmented_sort_by_key(d_keys.begin(),
+                                                 d_keys.end(),
+                                                 d_values.begin(),
+                                                 d_offsets.begin(),
+                                                 d_offsets.end() - 1,
+                                                 d_offsets.begin() + 1);
+
+            ASSERT_EQ(h_keys, d_keys);
+            ASSERT_EQ(h_values, d_values);
+        }
+    }
+}
+
+TYPED_TEST(SegmentedSortPrimitiveTests, TestSegmentedSort)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T>   h_keys  = get_random_data<T>(size, T(0), T(100), seed);
+            thrust::host_vector<int> offsets = get_segment_offsets(size, seed);
+
+            thrust::device_vector<T>   d_keys    = h_keys;
+            thrust::device_vector<int> d_offsets = offsets;
+
+            for(size_t i = 0; i + 1 < offsets.size(); i++)
+            {
+                thrust::sort(h_keys.begin() + offsets[i],
+                             h_keys.begin() + offsets[i + 1],
+                             thrust::greater<T>());
+            }
+
+            thrust::segmented_sort(d_keys.begin(),
+                                   d_keys.end(),
+                                   d_offsets.begin(),
+                                   d_offsets.end() - 1,
+                                   d_offsets.begin() + 1,
+                                   thrust::greater<T>());
+
+            ASSERT_EQ(h_keys, d_keys);
+        }
+    }
+}
@@ -0,0 +1,244 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/selection.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SelectionTests, VectorIntegerTestsParams);
+TESTS_DEFINE(SelectionPrimitiveTests, NumericalTestsParams);
+
+TYPED_TEST(SelectionTests, TestNthElementSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(7);
+    data[0] = T(5); data[1] = T(1); data[2] = T(6); data[3] = T(3);
+    data[4] = T(7); data[5] = T(2); data[6] = T(4);
+
+    thrust::nth_element(Policy{}, data.begin(), data.begin() + 3, data.end());
+
+    ASSERT_EQ(data[3], T(4));
+    for(size_t i = 0; i < 3; i++)
+    {
+        ASSERT_LT(data[i], T(4));
+    }
+    for(size_t i = 4; i < 7; i++)
+    {
+        ASSERT_GT(data[i], T(4));
+    }
+
+    thrust::nth_element(Policy{}, data.begin(), data.begin() + 1, data.end(), thrust::greater<T>());
+
+    ASSERT_EQ(data[1], T(6));
+    ASSERT_EQ(data[0], T(7));
+}
+
+TYPED_TEST(SelectionTests, TestPartialSortSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector data(6);
+    data[0] = T(5); data[1] = T(1); data[2] = T(6);
+    data[3] = T(3); data[4] = T(2); data[5] = T(4);
+
+    thrust::partial_sort(Policy{}, data.begin(), data.begin() + 3, data.end());
+
+    ASSERT_EQ(data[0], T(1));
+    ASSERT_EQ(data[1], T(2));
+    ASSERT_EQ(data[2], T(3));
+
+    Vector result(4, T(0));
+
+    typename Vector::iterator end = thrust::partial_sort_copy(Policy{},
+                                                              data.begin(),
+                                                              data.end(),
+                                                              result.begin(),
+                                                              result.end(),
+                                                              thrust::greater<T>());
+
+    ASSERT_EQ(end, result.end());
+    ASSERT_EQ(result[0], T(6));
+    ASSERT_EQ(result[1], T(5));
+    ASSERT_EQ(result[2], T(4));
+    ASSERT_EQ(result[3], T(3));
+
+    // the output is longer than the input
+    Vector long_result(8, T(0));
+
+    end = thrust::partial_sort_copy(Policy{}, data.begin(), data.end(), long_result.begin(), long_result.end());
+
+    ASSERT_EQ(end - long_result.begin(), 6);
+    ASSERT_EQ(long_result[0], T(1));
+    ASSERT_EQ(long_result[5], T(6));
+    ASSERT_EQ(long_result[6], T(0));
+}
+
+TYPED_TEST(SelectionTests, TestTopKSimple)
+{
+    using Vector = typename TestFixture::input_type;
+    using Policy = typename TestFixture::execution_policy;
+    using T      = typename Vector::value_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    Vector keys(6);
+    keys[0] = T(5); keys[1] = T(9); keys[2] = T(1);
+    keys[3] = T(7); keys[4] = T(3); keys[5] = T(8);
+
+    Vector values(6);
+    thrust::sequence(values.begin(), values.end(), T(10));
+
+    Vector result(3);
+
+    typename Vector::iterator end = thrust::top_k(Policy{}, keys.begin(), keys.end(), 3, result.begin());
+
+    ASSERT_EQ(end, result.end());
+    ASSERT_EQ(result[0], T(9));
+    ASSERT_EQ(result[1], T(8));
+    ASSERT_EQ(result[2], T(7));
+
+    Vector keys_result(2);
+    Vector values_result(2);
+
+    thrust::pair<typename Vector::iterator, typename Vector::iterator> ends
+        = thrust::top_k_by_key(Policy{},
+                               keys.begin(),
+                               keys.end(),
+                               values.begin(),
+                               2,
+                               keys_result.begin(),
+                               values_result.begin(),
+                               thrust::less<T>());
+
+    ASSERT_EQ(ends.first, keys_result.end());
+    ASSERT_EQ(ends.second, values_result.end());
+    ASSERT_EQ(keys_result[0], T(1));
+    ASSERT_EQ(keys_result[1], T(3));
+    ASSERT_EQ(values_result[0], T(12));
+    ASSERT_EQ(values_result[1], T(14));
+}
+
+TYPED_TEST(SelectionPrimitiveTests, TestNthElement)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        if(size == 0)
+        {
+            continue;
+        }
+
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_data = get_random_data<T>(size, T(0), T(100), seed);
+
+            thrust::host_vector<T> h_sorted = h_data;
+            thrust::sort(h_sorted.begin(), h_sorted.end());
+
+            thrust::device_vector<T> d_data = h_data;
+
+            const size_t nth = size / 3;
+            thrust::nth_element(d_data.begin(), d_data.begin() + nth, d_data.end());
+
+            h_data = d_data;
+            ASSERT_EQ(h_data[nth], h_sorted[nth]);
+            for(size_t i = 0; i < nth; i++)
+            {
+                ASSERT_LE(h_data[i], h_data[nth]);
+            }
+            for(size_t i = nth; i < size; i++)
+            {
+                ASSERT_GE(h_data[i], h_data[nth]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SelectionPrimitiveTests, TestTopKByKey)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_keys = get_random_data<T>(size, T(0), T(100), seed);
+
+            thrust::host_vector<int> h_values(size);
+            thrust::sequence(h_values.begin(), h_values.end());
+
+            thrust::device_vector<T>   d_keys   = h_keys;
+            thrust::device_vector<int> d_values = h_values;
+
+            for(size_t k : {size_t(1), size_t(100), size / 2})
+            {
+                SCOPED_TRACE(testing::Message() << "with k= " << k);
+
+                const size_t count = std::min(k, size);
+
+                thrust::host_vector<T> h_sorted = h_keys;
+                thrust::sort(h_sorted.begin(), h_sorted.end(), thrust::greater<T>());
+                h_sorted.resize(count);
+
+                thrust::device_vector<T>   d_keys_result(count);
+                thrust::device_vector<int> d_values_result(count);
+
+                thrust::top_k_by_key(d_keys.begin(),
+                                     d_keys.end(),
+                                     d_values.begin(),
+                                     k,
+                                     d_keys_result.begin(),
+                                     d_values_result.begin());
+
+                thrust::host_vector<T>   h_keys_result   = d_keys_result;
+                thrust::host_vector<int> h_values_result = d_values_result;
+
+                ASSERT_EQ(h_sorted, h_keys_result);
+                for(size_t i = 0; i < count; i++)
+                {
+                    ASSERT_EQ(h_keys[h_values_result[i]], h_keys_result[i]);
+                }
+            }
+        }
+    }
+}
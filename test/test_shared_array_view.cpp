@@ -0,0 +1,190 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/shared_array_view.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <utility>
+
+#include "test_header.hpp"
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+    counting_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+TEST(SharedArrayViewTests, TestSharedArrayViewSharing)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::shared_array_view<int> empty;
+    ASSERT_EQ(empty.size(), 0u);
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.use_count(), 0);
+    ASSERT_EQ(empty.begin(), empty.end());
+
+    thrust::host_vector<int> h(1000);
+    thrust::sequence(h.begin(), h.end());
+    const int * data = thrust::raw_pointer_cast(h.data());
+
+    // the storage of the vector is taken over
+    thrust::shared_array_view<int> view(std::move(h));
+    ASSERT_TRUE(h.empty());
+    ASSERT_EQ(view.size(), 1000u);
+    ASSERT_EQ(view.data(), data);
+    ASSERT_TRUE(view.unique());
+
+    // copies share the elements
+    thrust::shared_array_view<int> copy = view;
+    ASSERT_EQ(copy.data(), data);
+    ASSERT_EQ(view.use_count(), 2);
+    ASSERT_FALSE(view.unique());
+
+    ASSERT_EQ(thrust::reduce(copy.begin(), copy.end()), 999 * 1000 / 2);
+    ASSERT_EQ(copy[10], 10);
+
+    auto made = thrust::make_shared_array_view(thrust::host_vector<int>(5, 7));
+    ASSERT_EQ(made.size(), 5u);
+    ASSERT_EQ(made[4], 7);
+
+    // an lvalue vector is copied
+    thrust::host_vector<int> source(3, 2);
+    thrust::shared_array_view<int> copied(source);
+    ASSERT_NE(copied.data(), thrust::raw_pointer_cast(source.data()));
+    ASSERT_EQ(copied[2], 2);
+
+    copy.reset();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_TRUE(view.unique());
+
+    copy.swap(view);
+    ASSERT_EQ(copy.data(), data);
+    ASSERT_TRUE(view.empty());
+}
+
+TEST(SharedArrayViewTests, TestSharedArrayViewCopyOnWrite)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<int> h(100);
+    thrust::sequence(h.begin(), h.end(), 100, -1);
+
+    thrust::shared_array_view<int> view(std::move(h));
+    const int * data = view.data();
+
+    // a unique view is modified in place
+    view.mutable_begin()[0] = 1000;
+    ASSERT_EQ(view.data(), data);
+    ASSERT_EQ(view[0], 1000);
+
+    // a shared view is cloned before the first modification
+    thrust::shared_array_view<int> stage = view;
+    thrust::sort(stage.mutable_begin(), stage.mutable_end());
+    ASSERT_NE(stage.data(), data);
+    ASSERT_TRUE(stage.unique());
+    ASSERT_TRUE(view.unique());
+
+    ASSERT_EQ(view.data(), data);
+    ASSERT_EQ(view[0], 1000);
+    ASSERT_EQ(view[1], 99);
+    ASSERT_EQ(stage[0], 1);
+    ASSERT_EQ(stage[99], 1000);
+
+    // detaching with a policy
+    thrust::shared_array_view<int> other = view;
+    other.detach(thrust::cpp::par);
+    ASSERT_NE(other.data(), data);
+    ASSERT_TRUE(other.unique());
+    ASSERT_TRUE(thrust::equal(other.begin(), other.end(), view.begin()));
+
+    other.mutable_data()[1] = -1;
+    ASSERT_EQ(view[1], 99);
+    ASSERT_EQ(other[1], -1);
+}
+
+TEST(SharedArrayViewTests, TestSharedArrayViewWithMrAllocator)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    typedef thrust::mr::allocator<int, counting_resource> allocator;
+
+    counting_resource resource;
+    {
+        thrust::host_vector<int, allocator> h(1000, 3, allocator(&resource));
+        ASSERT_EQ(resource.allocations, 1);
+
+        thrust::shared_array_view<int, allocator> view(std::move(h));
+        thrust::shared_array_view<int, allocator> copy = view;
+        ASSERT_EQ(resource.allocations, 1);
+        ASSERT_EQ(copy.get_allocator(), allocator(&resource));
+
+        // the clone is allocated from the same resource
+        copy.detach(thrust::cpp::par);
+        ASSERT_EQ(resource.allocations, 2);
+        ASSERT_EQ(copy.get_allocator(), allocator(&resource));
+
+        copy.mutable_begin()[0] = 0;
+        ASSERT_EQ(resource.allocations, 2);
+        ASSERT_EQ(view[0], 3);
+        ASSERT_EQ(thrust::reduce(copy.begin(), copy.end()), 999 * 3);
+    }
+    ASSERT_EQ(resource.outstanding, 0);
+}
+
+TEST(SharedArrayViewTests, TestSharedArrayViewDevice)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::device_vector<int> d(1000);
+    thrust::sequence(d.begin(), d.end(), 1000, -1);
+
+    auto view = thrust::make_shared_array_view(std::move(d));
+    auto copy = view;
+
+    ASSERT_EQ(thrust::reduce(view.begin(), view.end()), 1001 * 1000 / 2);
+
+    thrust::sort(copy.mutable_begin(), copy.mutable_end());
+    ASSERT_EQ(copy[0], 1);
+    ASSERT_EQ(view[0], 1000);
+
+    thrust::host_vector<int> h(view.begin(), view.end());
+    ASSERT_EQ(h[999], 1);
+}
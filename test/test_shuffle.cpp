@@ -371,6 +371,45 @@ TYPED_TEST(ShuffleVectorTests, TestShuffleCopySimple)
     ASSERT_EQ(shuffled, data);
 }
 
+TYPED_TEST(ShuffleVariablesTests, TestShuffleCopyLarge)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+    using T = typename TestFixture::input_type;
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        if(static_cast<double>(size) >= static_cast<double>(std::numeric_limits<T>::max()))
+        {
+            continue;
+        }
+
+        thrust::host_vector<T> data(size);
+        thrust::sequence(data.begin(), data.end(), 0llu);
+
+        thrust::host_vector<T> h_shuffled(data);
+        thrust::host_vector<T> h_copied(size);
+        thrust::default_random_engine g(0xD5);
+        thrust::shuffle(h_shuffled.begin(), h_shuffled.end(), g);
+        g.seed(0xD5);
+        thrust::shuffle_copy(data.begin(), data.end(), h_copied.begin(), g);
+        ASSERT_EQ(h_shuffled, h_copied);
+
+        thrust::device_vector<T> d_data(data);
+        thrust::device_vector<T> d_shuffled(size);
+        g.seed(0xD5);
+        thrust::shuffle_copy(d_data.begin(), d_data.end(), d_shuffled.begin(), g);
+
+        // Check all of our data is present in both results
+        thrust::sort(h_shuffled.begin(), h_shuffled.end());
+        thrust::sort(d_shuffled.begin(), d_shuffled.end());
+        thrust::host_vector<T> d_result(d_shuffled);
+        ASSERT_EQ(h_shuffled, data);
+        ASSERT_EQ(d_result, data);
+    }
+}
+
 TYPED_TEST(ShuffleVariablesTests, TestHostDeviceIdentical)
 {
     SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
@@ -0,0 +1,235 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/soa_vector.h>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "test_header.hpp"
+
+namespace
+{
+
+typedef thrust::tuple<int, double, char> record;
+
+// the number of blocks handed out by every counting_allocator
+std::size_t allocations = 0;
+
+// a host allocator counting the blocks it hands out
+template<typename T>
+struct counting_allocator : std::allocator<T>
+{
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+struct odd_key
+{
+    __host__ __device__ bool operator()(const record &r) const
+    {
+        return thrust::get<0>(r) % 2 != 0;
+    }
+};
+
+} // end namespace
+
+TEST(SoaVectorTests, TestSoaVectorPushBackAndResize)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::soa_vector<record> v;
+    ASSERT_EQ(v.size(), 0);
+    ASSERT_EQ(v.empty(), true);
+    ASSERT_EQ(v.begin() == v.end(), true);
+
+    for(int i = 0; i < 100; ++i)
+    {
+        v.push_back(thrust::make_tuple(i, i * 0.5, char('a' + i % 26)));
+    }
+    ASSERT_EQ(v.size(), 100);
+    ASSERT_GE(v.capacity(), 100);
+    ASSERT_EQ(v.end() - v.begin(), 100);
+
+    for(int i = 0; i < 100; ++i)
+    {
+        record r = v[i];
+        ASSERT_EQ(thrust::get<0>(r), i);
+        ASSERT_EQ(thrust::get<1>(r), i * 0.5);
+        ASSERT_EQ(thrust::get<2>(r), char('a' + i % 26));
+    }
+
+    v.resize(150, thrust::make_tuple(-1, 2.0, 'z'));
+    ASSERT_EQ(v.size(), 150);
+    ASSERT_EQ(thrust::get<0>(v[99]), 99);
+    ASSERT_EQ(v[149] == thrust::make_tuple(-1, 2.0, 'z'), true);
+
+    v.resize(200);
+    ASSERT_EQ(v[199] == record(0, 0.0, 0), true);
+
+    v.resize(10);
+    v.pop_back();
+    ASSERT_EQ(v.size(), 9);
+    ASSERT_EQ(thrust::get<0>(v[8]), 8);
+
+    v.shrink_to_fit();
+    ASSERT_EQ(v.capacity(), 9);
+    ASSERT_EQ(thrust::get<1>(v[8]), 4.0);
+
+    v.clear();
+    ASSERT_EQ(v.size(), 0);
+    ASSERT_EQ(v.capacity(), 9);
+}
+
+TEST(SoaVectorTests, TestSoaVectorSingleAllocation)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    typedef thrust::tuple<char, double, short, int> fields;
+    thrust::soa_vector<fields, counting_allocator<fields>> v;
+
+    allocations = 0;
+    v.reserve(33);
+    ASSERT_EQ(allocations, 1);
+    ASSERT_EQ(v.capacity(), 33);
+
+    // the columns follow each other in one block, each aligned for its type
+    std::uintptr_t c0 = reinterpret_cast<std::uintptr_t>(v.column<0>());
+    std::uintptr_t c1 = reinterpret_cast<std::uintptr_t>(v.column<1>());
+    std::uintptr_t c2 = reinterpret_cast<std::uintptr_t>(v.column<2>());
+    std::uintptr_t c3 = reinterpret_cast<std::uintptr_t>(v.column<3>());
+    ASSERT_GE(c1, c0 + 33 * sizeof(char));
+    ASSERT_LT(c1, c0 + 33 * sizeof(char) + alignof(double));
+    ASSERT_EQ(c1 % alignof(double), 0);
+    ASSERT_EQ(c2, c1 + 33 * sizeof(double));
+    ASSERT_GE(c3, c2 + 33 * sizeof(short));
+    ASSERT_EQ(c3 % alignof(int), 0);
+
+    // growing moves all columns into one new block
+    v.resize(34, thrust::make_tuple('x', 1.5, short(2), 3));
+    ASSERT_EQ(allocations, 2);
+    ASSERT_EQ(v.column<0>()[33], 'x');
+    ASSERT_EQ(v.column<1>()[33], 1.5);
+    ASSERT_EQ(v.column<2>()[33], 2);
+    ASSERT_EQ(v.column<3>()[33], 3);
+}
+
+TEST(SoaVectorTests, TestSoaVectorCopyAndMove)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<record> h(5);
+    for(int i = 0; i < 5; ++i)
+    {
+        h[i] = thrust::make_tuple(i, -i, 'q');
+    }
+
+    thrust::soa_vector<record> v;
+    v.assign(h.begin(), h.end());
+    ASSERT_EQ(v.size(), 5);
+
+    thrust::soa_vector<record> copy(v);
+    ASSERT_EQ(copy.size(), 5);
+    ASSERT_EQ(copy.capacity(), 5);
+    ASSERT_EQ(thrust::equal(copy.begin(), copy.end(), v.begin()), true);
+
+    copy[0] = thrust::make_tuple(100, 0.0, 'a');
+    ASSERT_EQ(thrust::get<0>(v[0]), 0);
+
+    thrust::soa_vector<record> moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 5);
+    ASSERT_EQ(copy.size(), 0);
+    ASSERT_EQ(thrust::get<0>(moved[0]), 100);
+
+    copy = moved;
+    ASSERT_EQ(copy.size(), 5);
+    ASSERT_EQ(thrust::get<0>(copy[0]), 100);
+
+    v = std::move(moved);
+    ASSERT_EQ(thrust::get<0>(v[0]), 100);
+
+    thrust::host_vector<record> back(v.size());
+    thrust::copy(v.begin(), v.end(), back.begin());
+    ASSERT_EQ(back[4] == thrust::make_tuple(4, -4.0, 'q'), true);
+}
+
+TEST(SoaVectorTests, TestSoaVectorAlgorithms)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const int n = 1000;
+    thrust::soa_vector<record> v;
+    for(int i = 0; i < n; ++i)
+    {
+        v.push_back(thrust::make_tuple((i * 7919) % n, double(i), char(i % 3)));
+    }
+
+    // sort the records by their first column
+    thrust::sort_by_key(v.column<0>(), v.column<0>() + v.size(), v.columns<1, 2>());
+    for(int i = 0; i < n; ++i)
+    {
+        record r = v[i];
+        ASSERT_EQ(thrust::get<0>(r), i);
+        ASSERT_EQ(int(thrust::get<1>(r)) * 7919 % n, i);
+        ASSERT_EQ(thrust::get<2>(r), char(int(thrust::get<1>(r)) % 3));
+    }
+
+    // keep the records with odd keys
+    thrust::soa_vector<record> odd(v.size());
+    odd.resize(thrust::copy_if(v.begin(), v.end(), odd.begin(), odd_key()) - odd.begin());
+    ASSERT_EQ(odd.size(), n / 2);
+    ASSERT_EQ(thrust::get<0>(odd[0]), 1);
+    ASSERT_EQ(thrust::get<0>(odd[n / 2 - 1]), n - 1);
+
+    // sum the second column over runs of equal third column
+    thrust::sort_by_key(v.column<2>(), v.column<2>() + v.size(), v.columns<0, 1>());
+    thrust::device_vector<char>   keys(3);
+    thrust::device_vector<double> sums(3);
+    thrust::reduce_by_key(v.column<2>(), v.column<2>() + v.size(), v.column<1>(), keys.begin(), sums.begin());
+
+    double expected[3] = {0.0, 0.0, 0.0};
+    for(int i = 0; i < n; ++i)
+    {
+        expected[i % 3] += i;
+    }
+    for(int k = 0; k < 3; ++k)
+    {
+        ASSERT_EQ(keys[k], char(k));
+        ASSERT_EQ(sums[k], expected[k]);
+    }
+}
@@ -0,0 +1,350 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/radix_key.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
+#include <ostream>
+#include <type_traits>
+
+#include "test_header.hpp"
+
+TESTS_DEFINE(SortBitRangeTests, AllIntegerTestsParams);
+
+// the order-preserving unsigned representation of an integer
+template <class T>
+typename std::make_unsigned<T>::type radix_bits(T x)
+{
+    using U = typename std::make_unsigned<T>::type;
+    return std::is_signed<T>::value ? U(U(x) ^ (U(1) << (8 * sizeof(T) - 1))) : U(x);
+}
+
+template <class T>
+struct reference_bit_range_less
+{
+    int begin_bit;
+    int end_bit;
+
+    bool operator()(T lhs, T rhs) const
+    {
+        using U           = typename std::make_unsigned<T>::type;
+        const int width   = end_bit - begin_bit;
+        const U   mask    = width < int(8 * sizeof(U)) ? U((U(1) << width) - 1) : U(~U(0));
+        return U(radix_bits(lhs) >> begin_bit & mask) < U(radix_bits(rhs) >> begin_bit & mask);
+    }
+};
+
+TYPED_TEST(SortBitRangeTests, TestStableSortBitRange)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const int num_bits = 8 * sizeof(T);
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(int begin_bit = 0; begin_bit < num_bits; begin_bit += 5)
+        {
+            const int end_bit = std::min(num_bits, begin_bit + 12);
+
+            SCOPED_TRACE(testing::Message() << "with bits= [" << begin_bit << ", " << end_bit << ")");
+
+            for(auto seed : get_seeds())
+            {
+                SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+                thrust::host_vector<T> h_keys = get_random_data<T>(
+                    size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), seed);
+                thrust::device_vector<T> d_keys = h_keys;
+
+                thrust::host_vector<T> reference = h_keys;
+                std::stable_sort(reference.begin(),
+                                 reference.end(),
+                                 reference_bit_range_less<T>{begin_bit, end_bit});
+
+                thrust::stable_sort(h_keys.begin(), h_keys.end(), begin_bit, end_bit);
+                thrust::stable_sort(d_keys.begin(), d_keys.end(), begin_bit, end_bit);
+
+                ASSERT_EQ(reference, h_keys);
+                ASSERT_EQ(reference, d_keys);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SortBitRangeTests, TestSortByKeyBitRange)
+{
+    using T = typename TestFixture::input_type;
+
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const int begin_bit = 2;
+    const int end_bit   = 8 * sizeof(T) - 3;
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<T> h_keys = get_random_data<T>(
+                size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), seed);
+            thrust::device_vector<T> d_keys = h_keys;
+
+            thrust::host_vector<int> h_values(size);
+            thrust::sequence(h_values.begin(), h_values.end());
+            thrust::device_vector<int> d_values = h_values;
+
+            // sort the values by their keys to obtain the reference
+            thrust::host_vector<int> reference_values = h_values;
+            const reference_bit_range_less<T> comp{begin_bit, end_bit};
+            std::stable_sort(reference_values.begin(),
+                             reference_values.end(),
+                             [&](int lhs, int rhs) { return comp(h_keys[lhs], h_keys[rhs]); });
+
+            thrust::host_vector<T> reference_keys(size);
+            for(size_t i = 0; i < size; i++)
+                reference_keys[i] = h_keys[reference_values[i]];
+
+            thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), begin_bit, end_bit);
+            thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), begin_bit, end_bit);
+
+            ASSERT_EQ(reference_keys, h_keys);
+            ASSERT_EQ(reference_values, h_values);
+            ASSERT_EQ(reference_keys, d_keys);
+            ASSERT_EQ(reference_values, d_values);
+
+            // sort_by_key need not be stable, but must order the keys
+            thrust::host_vector<T> h_unstable_keys = get_random_data<T>(
+                size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), seed);
+            thrust::device_vector<T> d_unstable_keys = h_unstable_keys;
+            thrust::sort_by_key(d_unstable_keys.begin(), d_unstable_keys.end(), d_values.begin(), begin_bit, end_bit);
+
+            h_unstable_keys = d_unstable_keys;
+            ASSERT_TRUE(std::is_sorted(h_unstable_keys.begin(), h_unstable_keys.end(), comp));
+        }
+    }
+}
+
+TEST(SortBitRangeFloatTests, TestSortBitRangeFloat)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<float> h_keys(8);
+    h_keys[0] = 2.5f;  h_keys[1] = -1.0f; h_keys[2] = 0.0f;  h_keys[3] = -7.25f;
+    h_keys[4] = 1e10f; h_keys[5] = 3.0f;  h_keys[6] = -2.5f; h_keys[7] = 1.0f;
+
+    thrust::host_vector<float> reference = h_keys;
+    std::sort(reference.begin(), reference.end());
+
+    thrust::device_vector<float> d_keys = h_keys;
+
+    thrust::sort(h_keys.begin(), h_keys.end(), 0, 32);
+    thrust::sort(d_keys.begin(), d_keys.end(), 0, 32);
+
+    ASSERT_EQ(reference, h_keys);
+    ASSERT_EQ(reference, d_keys);
+
+    // the sign and exponent bits alone order the keys by magnitude class
+    h_keys = reference;
+    thrust::stable_sort(h_keys.begin(), h_keys.end(), 23, 32);
+    ASSERT_EQ(reference, h_keys);
+}
+
+TEST(SortBitRangeEmptyTests, TestSortEmptyBitRange)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    thrust::host_vector<unsigned int> h_keys(5);
+    h_keys[0] = 5; h_keys[1] = 3; h_keys[2] = 4; h_keys[3] = 1; h_keys[4] = 2;
+
+    thrust::device_vector<unsigned int> d_keys = h_keys;
+
+    // no bit is compared, so all keys are equivalent
+    thrust::stable_sort(d_keys.begin(), d_keys.end(), 7, 7);
+    ASSERT_EQ(h_keys, d_keys);
+}
+
+struct radix_key_point
+{
+    short x;
+    short y;
+    float weight;
+};
+
+// orders points by y and then by x
+struct decompose_y_x
+{
+    __host__ __device__ thrust::tuple<short, short> operator()(const radix_key_point& p) const
+    {
+        return thrust::make_tuple(p.y, p.x);
+    }
+};
+
+// orders points by y, x and then by weight, which takes more than 64 bits
+struct decompose_y_x_weight
+{
+    __host__ __device__ thrust::tuple<short, short, float, double>
+    operator()(const radix_key_point& p) const
+    {
+        return thrust::make_tuple(p.y, p.x, p.weight, 0.0);
+    }
+};
+
+// orders points by weight through a reference to it
+struct decompose_weight
+{
+    __host__ __device__ thrust::tuple<const float&> operator()(const radix_key_point& p) const
+    {
+        return thrust::tie(p.weight);
+    }
+};
+
+struct reference_point_less
+{
+    bool operator()(const radix_key_point& lhs, const radix_key_point& rhs) const
+    {
+        if(lhs.y != rhs.y)
+            return lhs.y < rhs.y;
+        if(lhs.x != rhs.x)
+            return lhs.x < rhs.x;
+        return lhs.weight < rhs.weight;
+    }
+};
+
+bool operator==(const radix_key_point& lhs, const radix_key_point& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.weight == rhs.weight;
+}
+
+std::ostream& operator<<(std::ostream& os, const radix_key_point& p)
+{
+    return os << "(" << p.x << ", " << p.y << ", " << p.weight << ")";
+}
+
+thrust::host_vector<radix_key_point> get_random_points(size_t size, int seed)
+{
+    thrust::host_vector<short> x = get_random_data<short>(size, -100, 100, seed);
+    thrust::host_vector<short> y = get_random_data<short>(size, -3, 3, seed + 1);
+    thrust::host_vector<short> w = get_random_data<short>(size, -50, 50, seed + 2);
+
+    thrust::host_vector<radix_key_point> points(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        points[i].x      = x[i];
+        points[i].y      = y[i];
+        points[i].weight = w[i] / 4.0f;
+    }
+    return points;
+}
+
+TEST(SortDecomposerTests, TestSortDecomposer)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<radix_key_point> points = get_random_points(size, seed);
+
+            // the fields fit in 32 bits, so the host backends radix sort
+            thrust::host_vector<radix_key_point> reference = points;
+            std::stable_sort(reference.begin(),
+                             reference.end(),
+                             [](const radix_key_point& lhs, const radix_key_point& rhs) {
+                                 return lhs.y < rhs.y || (lhs.y == rhs.y && lhs.x < rhs.x);
+                             });
+
+            thrust::host_vector<radix_key_point>   h_points = points;
+            thrust::device_vector<radix_key_point> d_points = points;
+
+            thrust::stable_sort(h_points.begin(), h_points.end(), thrust::make_decomposer_less(decompose_y_x()));
+            thrust::stable_sort(d_points.begin(), d_points.end(), thrust::make_decomposer_less(decompose_y_x()));
+
+            ASSERT_EQ(reference, h_points);
+            ASSERT_EQ(reference, d_points);
+
+            // the fields take more than 64 bits, so a comparison sort is used
+            std::sort(reference.begin(), reference.end(), reference_point_less());
+
+            h_points = points;
+            d_points = points;
+
+            thrust::sort(h_points.begin(), h_points.end(), thrust::make_decomposer_less(decompose_y_x_weight()));
+            thrust::sort(d_points.begin(), d_points.end(), thrust::make_decomposer_less(decompose_y_x_weight()));
+
+            ASSERT_EQ(reference, h_points);
+            ASSERT_EQ(reference, d_points);
+        }
+    }
+}
+
+TEST(SortDecomposerTests, TestStableSortByKeyDecomposer)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    for(auto size : get_sizes())
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        for(auto seed : get_seeds())
+        {
+            SCOPED_TRACE(testing::Message() << "with seed= " << seed);
+
+            thrust::host_vector<radix_key_point> points = get_random_points(size, seed);
+
+            thrust::host_vector<int> reference(size);
+            thrust::sequence(reference.begin(), reference.end());
+            std::stable_sort(reference.begin(), reference.end(), [&](int lhs, int rhs) {
+                return points[lhs].weight < points[rhs].weight;
+            });
+
+            thrust::host_vector<radix_key_point>   h_points = points;
+            thrust::device_vector<radix_key_point> d_points = points;
+
+            thrust::host_vector<int> h_values(size);
+            thrust::sequence(h_values.begin(), h_values.end());
+            thrust::device_vector<int> d_values = h_values;
+
+            thrust::stable_sort_by_key(h_points.begin(),
+                                       h_points.end(),
+                                       h_values.begin(),
+                                       thrust::make_decomposer_less(decompose_weight()));
+            thrust::stable_sort_by_key(d_points.begin(),
+                                       d_points.end(),
+                                       d_values.begin(),
+                                       thrust::make_decomposer_less(decompose_weight()));
+
+            ASSERT_EQ(reference, h_values);
+            ASSERT_EQ(reference, d_values);
+        }
+    }
+}
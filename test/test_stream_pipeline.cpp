@@ -0,0 +1,208 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/stream_pipeline.h>
+#include <thrust/execution_policy.h>
+#include <thrust/remove.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "test_header.hpp"
+
+namespace
+{
+
+struct is_odd
+{
+    __host__ __device__
+    bool operator()(int x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+struct square
+{
+    __host__ __device__
+    int operator()(int x) const
+    {
+        return x * x;
+    }
+};
+
+struct vector_source
+{
+    std::size_t operator()(int * buffer, std::size_t capacity)
+    {
+        const std::size_t n = std::min(capacity, data->size() - position);
+        std::copy(data->begin() + position, data->begin() + position + n, buffer);
+        position += n;
+        return n;
+    }
+
+    const std::vector<int> * data;
+    std::size_t              position;
+};
+
+// drops the odd elements of a batch and squares the rest
+struct square_evens
+{
+    template<typename Policy>
+    int * operator()(const Policy & exec, int * first, int * last) const
+    {
+        int * end = thrust::remove_if(exec, first, last, is_odd());
+        return thrust::transform(exec, first, end, first, square());
+    }
+};
+
+struct vector_sink
+{
+    void operator()(const int * data, std::size_t n)
+    {
+        result->insert(result->end(), data, data + n);
+    }
+
+    std::vector<int> * result;
+};
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+    counting_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+} // end namespace
+
+TEST(StreamPipelineTests, TestStreamPipeline)
+{
+    std::vector<int> data(10007);
+    for(std::size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<int>(i % 1000);
+    }
+
+    std::vector<int> expected;
+    for(int x : data)
+    {
+        if(x % 2 == 0)
+        {
+            expected.push_back(x * x);
+        }
+    }
+
+    for(std::size_t num_buffers : {1, 2, 3, 5})
+    {
+        SCOPED_TRACE(testing::Message() << "with num_buffers= " << num_buffers);
+
+        for(std::size_t batch_size : {1, 7, 1024})
+        {
+            SCOPED_TRACE(testing::Message() << "with batch_size= " << batch_size);
+
+            std::vector<int> result;
+
+            counting_resource resource;
+
+            thrust::stream_pipeline_options options;
+            options.batch_size  = batch_size;
+            options.num_buffers = num_buffers;
+            options.resource    = &resource;
+
+            thrust::stream_pipeline_statistics statistics = thrust::stream_pipeline<int>(
+                thrust::host, vector_source{&data, 0}, square_evens(), vector_sink{&result}, options);
+
+            ASSERT_EQ(expected, result);
+            ASSERT_EQ(statistics.num_elements, data.size());
+            ASSERT_EQ(statistics.num_drained, expected.size());
+            ASSERT_EQ(statistics.num_batches, (data.size() + batch_size - 1) / batch_size);
+            ASSERT_GE(statistics.elapsed_seconds, 0.0);
+
+            // the buffers are allocated once and all returned
+            ASSERT_EQ(resource.allocations, static_cast<int>(num_buffers));
+            ASSERT_EQ(resource.outstanding, 0);
+        }
+    }
+}
+
+TEST(StreamPipelineTests, TestStreamPipelineEmpty)
+{
+    std::vector<int> data;
+    std::vector<int> result;
+
+    thrust::stream_pipeline_statistics statistics = thrust::stream_pipeline<int>(
+        thrust::host, vector_source{&data, 0}, square_evens(), vector_sink{&result}, thrust::stream_pipeline_options());
+
+    ASSERT_TRUE(result.empty());
+    ASSERT_EQ(statistics.num_batches, 0u);
+}
+
+TEST(StreamPipelineTests, TestStreamPipelineRethrows)
+{
+    std::vector<int> data(1000, 2);
+
+    thrust::stream_pipeline_options options;
+    options.batch_size = 10;
+
+    // the source fails
+    {
+        std::size_t calls = 0;
+        auto source = [&](int *, std::size_t capacity) -> std::size_t
+        {
+            if(++calls == 5)
+            {
+                throw std::runtime_error("source");
+            }
+            return capacity;
+        };
+
+        std::vector<int> result;
+        ASSERT_THROW(thrust::stream_pipeline<int>(thrust::host, source, square_evens(), vector_sink{&result}, options),
+                     std::runtime_error);
+    }
+
+    // the sink fails
+    {
+        std::size_t calls = 0;
+        auto sink = [&](const int *, std::size_t)
+        {
+            if(++calls == 3)
+            {
+                throw std::runtime_error("sink");
+            }
+        };
+
+        ASSERT_THROW(thrust::stream_pipeline<int>(thrust::host, vector_source{&data, 0}, square_evens(), sink, options),
+                     std::runtime_error);
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <vector>
+
+#include "test_header.hpp"
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+    counting_resource() : allocations(0), outstanding(0) {}
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        ++outstanding;
+        return upstream.do_allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        --outstanding;
+        upstream.do_deallocate(p, bytes, alignment);
+    }
+
+    thrust::mr::new_delete_resource upstream;
+    int allocations;
+    int outstanding;
+};
+
+TEST(TemporaryArrayTests, TestInlineBuffer)
+{
+    counting_resource resource;
+    auto policy = thrust::cpp::par(&resource);
+
+    typedef thrust::detail::temporary_array<int, decltype(policy)> array_type;
+
+    const std::size_t inline_size = THRUST_TEMPORARY_ARRAY_INLINE_BYTES / sizeof(int);
+    {
+        // small arrays do not allocate
+        array_type small(policy, inline_size);
+        ASSERT_EQ(resource.allocations, 0);
+
+        thrust::sequence(thrust::cpp::par, small.begin(), small.end());
+        ASSERT_EQ(small[inline_size - 1], int(inline_size - 1));
+
+        // larger arrays do
+        array_type large(policy, inline_size + 1);
+        ASSERT_EQ(resource.allocations, 1);
+
+        std::vector<int> input(10, 13);
+        array_type copy(policy, input.begin(), input.end());
+        ASSERT_EQ(resource.allocations, 1);
+        ASSERT_EQ(copy[9], 13);
+    }
+    ASSERT_EQ(resource.outstanding, 0);
+
+    // the buffer is reused after being returned
+    {
+        array_type array(policy, 16);
+        array.deallocate();
+        array.allocate(32);
+        ASSERT_EQ(resource.allocations, 1);
+
+        array.deallocate();
+        array.allocate(inline_size * 2);
+        ASSERT_EQ(resource.allocations, 2);
+    }
+    ASSERT_EQ(resource.outstanding, 0);
+}
+
+TEST(TemporaryArrayTests, TestSmallAlgorithmsDoNotAllocate)
+{
+    counting_resource resource;
+
+    thrust::host_vector<int> keys(100);
+    thrust::host_vector<int> values(100);
+    thrust::sequence(keys.begin(), keys.end(), 100, -1);
+    thrust::sequence(values.begin(), values.end());
+
+    thrust::stable_sort_by_key(thrust::cpp::par(&resource), keys.begin(), keys.end(), values.begin());
+    ASSERT_EQ(resource.allocations, 0);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(keys[i], i + 1);
+        ASSERT_EQ(values[i], 99 - i);
+    }
+
+    keys.resize(100000);
+    values.resize(100000);
+    thrust::sequence(keys.begin(), keys.end(), 100000, -1);
+
+    thrust::stable_sort_by_key(thrust::cpp::par(&resource), keys.begin(), keys.end(), values.begin());
+    ASSERT_GT(resource.allocations, 0);
+    ASSERT_EQ(resource.outstanding, 0);
+}
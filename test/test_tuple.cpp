@@ -21,6 +21,8 @@
 #include <thrust/swap.h>
 #include <thrust/tuple.h>
 
+#include <tuple>
+
 #include "test_header.hpp"
 
 TESTS_DEFINE(TupleTests, NumericalTestsParams);
@@ -537,3 +539,55 @@ TEST(TupleTests, TestTupleSwap)
     ASSERT_EQ(ref, (swappable_tuple)d_v1[0]);
     ASSERT_EQ(ref, (swappable_tuple)d_v1[0]);
 }
+
+TEST(TupleTests, TestTupleWide)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    typedef thrust::tuple<int, int, int, int, int, int, int, int, int, int, int, int, int>
+        wide_tuple;
+
+    ASSERT_EQ(13u, thrust::tuple_size<wide_tuple>::value);
+
+    wide_tuple t1 = thrust::make_tuple(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    ASSERT_EQ(0, thrust::get<0>(t1));
+    ASSERT_EQ(10, thrust::get<10>(t1));
+    ASSERT_EQ(12, thrust::get<12>(t1));
+
+    // the first elements only
+    wide_tuple t2(0, 1, 2);
+    ASSERT_EQ(2, thrust::get<2>(t2));
+    ASSERT_EQ(0, thrust::get<3>(t2));
+    ASSERT_EQ(0, thrust::get<12>(t2));
+    ASSERT_EQ(true, t2 < t1);
+
+    thrust::get<12>(t2) = 12;
+    t1 = t2;
+    ASSERT_EQ(t2, t1);
+    ASSERT_EQ(12, thrust::get<12>(t1));
+}
+
+struct empty_functor
+{
+    __host__ __device__ int operator()(int x) const
+    {
+        return x;
+    }
+};
+
+TEST(TupleTests, TestTupleLayout)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // empty elements take no space
+    ASSERT_EQ(sizeof(int), sizeof(thrust::tuple<empty_functor, int>));
+    ASSERT_EQ(sizeof(int), sizeof(thrust::tuple<int, empty_functor>));
+    ASSERT_EQ(sizeof(int*), sizeof(thrust::tuple<empty_functor, int*, thrust::null_type>));
+
+    ASSERT_EQ(sizeof(std::tuple<int, float, double>), sizeof(thrust::tuple<int, float, double>));
+    ASSERT_EQ(true, (std::is_trivially_copyable<thrust::tuple<int, float, double>>::value));
+    ASSERT_EQ(true, (std::is_trivially_copyable<thrust::tuple<empty_functor, int*>>::value));
+
+    thrust::tuple<empty_functor, int> t(empty_functor(), 13);
+    ASSERT_EQ(13, thrust::get<0>(t)(thrust::get<1>(t)));
+}
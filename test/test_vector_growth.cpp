@@ -0,0 +1,225 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/fill.h>
+#include <thrust/growth_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <memory>
+#include <vector>
+
+#include "test_header.hpp"
+
+template <typename T, typename GrowthPolicy>
+struct growth_allocator : std::allocator<T>
+{
+    typedef GrowthPolicy growth_policy;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef growth_allocator<U, GrowthPolicy> other;
+    };
+
+    growth_allocator() {}
+
+    template <typename U>
+    growth_allocator(const growth_allocator<U, GrowthPolicy> &)
+    {
+    }
+};
+
+// hands out memory from a fixed buffer, and grows the last allocation in place
+struct arena
+{
+    arena() : used(0), allocations(0) {}
+
+    char        buffer[1 << 16];
+    std::size_t used;
+    int         allocations;
+};
+
+template <typename T>
+struct expanding_allocator
+{
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef expanding_allocator<U> other;
+    };
+
+    expanding_allocator() : a(nullptr) {}
+
+    expanding_allocator(arena * a) : a(a) {}
+
+    template <typename U>
+    expanding_allocator(const expanding_allocator<U> & other) : a(other.a)
+    {
+    }
+
+    T * allocate(std::size_t n)
+    {
+        if (a->used + n * sizeof(T) > sizeof(a->buffer))
+        {
+            throw std::bad_alloc();
+        }
+
+        ++a->allocations;
+        T * result = reinterpret_cast<T *>(a->buffer + a->used);
+        a->used += n * sizeof(T);
+        return result;
+    }
+
+    void deallocate(T * p, std::size_t n)
+    {
+        if (reinterpret_cast<char *>(p + n) == a->buffer + a->used)
+        {
+            a->used -= n * sizeof(T);
+        }
+    }
+
+    bool try_expand(T * p, std::size_t n, std::size_t new_n)
+    {
+        if (reinterpret_cast<char *>(p + n) != a->buffer + a->used
+            || a->used - n * sizeof(T) + new_n * sizeof(T) > sizeof(a->buffer))
+        {
+            return false;
+        }
+
+        a->used = a->used - n * sizeof(T) + new_n * sizeof(T);
+        return true;
+    }
+
+    bool operator==(const expanding_allocator & other) const
+    {
+        return a == other.a;
+    }
+
+    bool operator!=(const expanding_allocator & other) const
+    {
+        return a != other.a;
+    }
+
+    arena * a;
+};
+
+TEST(VectorGrowthTests, TestGrowthPolicies)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    typedef thrust::geometric_growth<> doubling;
+    ASSERT_EQ(doubling::next_capacity(0, 1, 4), 1u);
+    ASSERT_EQ(doubling::next_capacity(10, 11, 4), 20u);
+    ASSERT_EQ(doubling::next_capacity(10, 25, 4), 25u);
+
+    typedef thrust::geometric_growth<3, 2> one_and_a_half;
+    ASSERT_EQ(one_and_a_half::next_capacity(1, 2, 4), 2u);
+    ASSERT_EQ(one_and_a_half::next_capacity(3, 4, 4), 4u);
+    ASSERT_EQ(one_and_a_half::next_capacity(10, 11, 4), 15u);
+
+    typedef thrust::linear_growth<100> linear;
+    ASSERT_EQ(linear::next_capacity(0, 1, 4), 100u);
+    ASSERT_EQ(linear::next_capacity(100, 101, 4), 200u);
+    ASSERT_EQ(linear::next_capacity(100, 350, 4), 400u);
+
+    typedef thrust::page_rounded_growth<> paged;
+    ASSERT_EQ(paged::next_capacity(0, 1, 4), 1024u);
+    ASSERT_EQ(paged::next_capacity(1024, 1025, 4), 2048u);
+    ASSERT_EQ(paged::next_capacity(0, 3, 1000), 4u);
+}
+
+TEST(VectorGrowthTests, TestVectorGrowthPolicy)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    // the default policy doubles the capacity
+    thrust::host_vector<int> v1;
+    std::vector<std::size_t> capacities1;
+    for (int i = 0; i < 10; ++i)
+    {
+        v1.push_back(i);
+        capacities1.push_back(v1.capacity());
+    }
+    ASSERT_EQ(capacities1, std::vector<std::size_t>({1, 2, 4, 4, 8, 8, 8, 8, 16, 16}));
+
+    thrust::host_vector<int, growth_allocator<int, thrust::geometric_growth<3, 2>>> v2;
+    std::vector<std::size_t> capacities2;
+    for (int i = 0; i < 10; ++i)
+    {
+        v2.push_back(i);
+        capacities2.push_back(v2.capacity());
+    }
+    ASSERT_EQ(capacities2, std::vector<std::size_t>({1, 2, 3, 4, 6, 6, 9, 9, 9, 13}));
+    ASSERT_EQ(v1, v2);
+
+    thrust::host_vector<int, growth_allocator<int, thrust::linear_growth<64>>> v3;
+    v3.push_back(0);
+    ASSERT_EQ(v3.capacity(), 64u);
+    v3.resize(65);
+    ASSERT_EQ(v3.capacity(), 128u);
+    v3.insert(v3.end(), 200, 1);
+    ASSERT_EQ(v3.capacity(), 320u);
+
+    // construction allocates exactly
+    thrust::host_vector<int, growth_allocator<int, thrust::linear_growth<64>>> v4(v1.begin(), v1.end());
+    ASSERT_EQ(v4.capacity(), v1.size());
+}
+
+TEST(VectorGrowthTests, TestVectorTryExpand)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    arena a;
+    {
+        thrust::host_vector<int, expanding_allocator<int>> v((expanding_allocator<int>(&a)));
+
+        // growing the only allocation never moves it
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(i);
+        }
+        ASSERT_EQ(a.allocations, 1);
+
+        const int * data = thrust::raw_pointer_cast(v.data());
+
+        v.reserve(2000);
+        ASSERT_EQ(v.capacity(), 2000u);
+        v.insert(v.begin() + 10, 1500, -1);
+        v.assign(3000, 7);
+        ASSERT_EQ(a.allocations, 1);
+        ASSERT_EQ(thrust::raw_pointer_cast(v.data()), data);
+        ASSERT_EQ(v, thrust::host_vector<int>(3000, 7));
+
+        v.resize(100);
+        v.shrink_to_fit();
+        ASSERT_EQ(v.capacity(), 100u);
+        ASSERT_EQ(a.used, 100 * sizeof(int));
+        ASSERT_EQ(a.allocations, 1);
+
+        // an allocation which is not the last one is reallocated
+        thrust::host_vector<int, expanding_allocator<int>> w(10, 1, expanding_allocator<int>(&a));
+        ASSERT_EQ(a.allocations, 2);
+        v.resize(200);
+        ASSERT_EQ(a.allocations, 3);
+
+        thrust::host_vector<int> expected(200, 0);
+        thrust::fill(expected.begin(), expected.begin() + 100, 7);
+        ASSERT_EQ(v, expected);
+    }
+}
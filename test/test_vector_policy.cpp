@@ -0,0 +1,216 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "test_header.hpp"
+
+// a host policy which counts the bulk operations dispatched to it
+struct counting_policy : thrust::system::cpp::execution_policy<counting_policy>
+{
+    counting_policy(int * calls) : calls(calls) {}
+
+    int * calls;
+};
+
+template <typename InputIterator, typename ForwardIterator>
+ForwardIterator uninitialized_copy(counting_policy & exec,
+                                   InputIterator     first,
+                                   InputIterator     last,
+                                   ForwardIterator   result)
+{
+    ++*exec.calls;
+    return thrust::uninitialized_copy(thrust::cpp::par, first, last, result);
+}
+
+template <typename ForwardIterator, typename Size, typename T>
+ForwardIterator uninitialized_fill_n(counting_policy & exec, ForwardIterator first, Size n, const T & x)
+{
+    ++*exec.calls;
+    return thrust::uninitialized_fill_n(thrust::cpp::par, first, n, x);
+}
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator copy(counting_policy & exec, InputIterator first, InputIterator last, OutputIterator result)
+{
+    ++*exec.calls;
+    return thrust::copy(thrust::cpp::par, first, last, result);
+}
+
+template <typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(counting_policy & exec, OutputIterator first, Size n, const T & x)
+{
+    ++*exec.calls;
+    return thrust::fill_n(thrust::cpp::par, first, n, x);
+}
+
+// an allocator which constructs elements itself
+template <typename T>
+struct constructing_allocator : std::allocator<T>
+{
+    template <typename U>
+    struct rebind
+    {
+        typedef constructing_allocator<U> other;
+    };
+
+    constructing_allocator() {}
+
+    template <typename U>
+    constructing_allocator(const constructing_allocator<U> &)
+    {
+    }
+
+    void construct(T * p)
+    {
+        ::new(static_cast<void *>(p)) T(13);
+    }
+
+    void construct(T * p, const T & x)
+    {
+        ::new(static_cast<void *>(p)) T(x);
+    }
+};
+
+TEST(VectorPolicyTests, TestHostVectorConstructWithPolicy)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    int calls = 0;
+    counting_policy policy(&calls);
+
+    thrust::host_vector<int> v1(policy, 10);
+    ASSERT_EQ(calls, 1);
+    ASSERT_EQ(v1, thrust::host_vector<int>(10, 0));
+
+    thrust::host_vector<int> v2(policy, 10, 7);
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(v2, thrust::host_vector<int>(10, 7));
+
+    std::vector<int> source(100);
+    thrust::sequence(source.begin(), source.end());
+
+    thrust::host_vector<int> v3(policy, source.begin(), source.end());
+    ASSERT_EQ(calls, 3);
+    ASSERT_EQ(v3, source);
+
+    thrust::host_vector<float> v4(policy, v3);
+    ASSERT_EQ(calls, 4);
+    ASSERT_EQ(v4, v3);
+
+    // integral arguments mean (n, value)
+    thrust::host_vector<int> v5(policy, 3, 5);
+    ASSERT_EQ(calls, 5);
+    ASSERT_EQ(v5, thrust::host_vector<int>(3, 5));
+
+    // ranges which cannot be traversed in bulk are not copied with the policy
+    std::list<int> list(source.begin(), source.end());
+    thrust::host_vector<int> v6(policy, list.begin(), list.end());
+    ASSERT_EQ(calls, 5);
+    ASSERT_EQ(v6, source);
+}
+
+TEST(VectorPolicyTests, TestHostVectorModifyWithPolicy)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    int calls = 0;
+    counting_policy policy(&calls);
+
+    std::vector<int> source(100);
+    thrust::sequence(source.begin(), source.end());
+
+    thrust::host_vector<int> v;
+    v.assign(policy, source.begin(), source.end());
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v, source);
+
+    calls = 0;
+    v.assign(policy, 50, 3);
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v, thrust::host_vector<int>(50, 3));
+
+    calls = 0;
+    v.resize(policy, 200, 4);
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v.size(), 200u);
+    ASSERT_EQ(v[49], 3);
+    ASSERT_EQ(v[50], 4);
+    ASSERT_EQ(v[199], 4);
+
+    calls = 0;
+    v.resize(policy, 300);
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v[199], 4);
+    ASSERT_EQ(v[299], 0);
+
+    v.resize(policy, 10);
+    ASSERT_EQ(v, thrust::host_vector<int>(10, 3));
+
+    calls = 0;
+    v.insert(policy, v.begin() + 5, 3, 9);
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v.size(), 13u);
+    ASSERT_EQ(v[4], 3);
+    ASSERT_EQ(v[5], 9);
+    ASSERT_EQ(v[7], 9);
+    ASSERT_EQ(v[8], 3);
+
+    calls = 0;
+    v.insert(policy, v.begin() + 1, source.begin(), source.begin() + 4);
+    ASSERT_GT(calls, 0);
+    ASSERT_EQ(v.size(), 17u);
+    ASSERT_EQ(v[0], 3);
+    ASSERT_EQ(v[1], 0);
+    ASSERT_EQ(v[4], 3);
+    ASSERT_EQ(v[5], 3);
+    ASSERT_EQ(v[9], 9);
+}
+
+TEST(VectorPolicyTests, TestHostVectorPolicyFallback)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    int calls = 0;
+    counting_policy policy(&calls);
+
+    // the allocator's construct() is respected
+    thrust::host_vector<int, constructing_allocator<int>> v1(policy, 10);
+    ASSERT_EQ(calls, 0);
+    ASSERT_EQ(v1, thrust::host_vector<int>(10, 13));
+
+    v1.resize(policy, 20);
+    ASSERT_EQ(calls, 0);
+    ASSERT_EQ(v1, thrust::host_vector<int>(20, 13));
+
+    // device ranges are transferred to the host
+    thrust::device_vector<int> d_vec(100);
+    thrust::sequence(d_vec.begin(), d_vec.end());
+
+    thrust::host_vector<int> v2(policy, d_vec);
+    ASSERT_EQ(v2, d_vec);
+
+    v2.assign(policy, d_vec.begin(), d_vec.begin() + 10);
+    ASSERT_EQ(v2.size(), 10u);
+    ASSERT_EQ(v2[9], 9);
+}
@@ -498,3 +498,49 @@ TEST(ZipIterator32BitTests, TestZipIteratorCopySoAToAoS)
     ASSERT_EQ_QUIET(7, get<0>(h_soa[0]));
     ASSERT_EQ_QUIET(13, get<1>(h_soa[0]));
 }
+
+struct SumFirstAndLast
+{
+    template <typename Tuple>
+    __host__ __device__ int operator()(const Tuple& t) const
+    {
+        return thrust::get<0>(t) + thrust::get<thrust::tuple_size<Tuple>::value - 1>(t);
+    }
+};
+
+TEST(ZipIterator32BitTests, TestZipIteratorWide)
+{
+    SCOPED_TRACE(testing::Message() << "with device_id= " << test::set_device_from_ctest());
+
+    const size_t n = 100;
+
+    thrust::device_vector<int> d[13];
+    for(int i = 0; i < 13; i++)
+    {
+        d[i].resize(n);
+        thrust::sequence(d[i].begin(), d[i].end(), i * 1000);
+    }
+
+    auto first = thrust::make_zip_iterator(thrust::make_tuple(d[0].begin(),
+                                                              d[1].begin(),
+                                                              d[2].begin(),
+                                                              d[3].begin(),
+                                                              d[4].begin(),
+                                                              d[5].begin(),
+                                                              d[6].begin(),
+                                                              d[7].begin(),
+                                                              d[8].begin(),
+                                                              d[9].begin(),
+                                                              d[10].begin(),
+                                                              d[11].begin(),
+                                                              d[12].begin()));
+
+    thrust::device_vector<int> d_result(n);
+    thrust::transform(first, first + n, d_result.begin(), SumFirstAndLast());
+
+    thrust::host_vector<int> h_result = d_result;
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(12000 + 2 * int(i), h_result[i]);
+    }
+}
@@ -0,0 +1,272 @@
+#include <unittest/unittest.h>
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/extrema.h>
+#include <thrust/fill.h>
+#include <thrust/find.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// the sizes on either side of a cutoff: the largest input which runs
+// sequentially and the smallest which runs in parallel
+std::vector<int> omp_cutoff_sizes(int cutoff)
+{
+  std::vector<int> sizes;
+  sizes.push_back(cutoff - 1);
+  sizes.push_back(cutoff);
+  return sizes;
+}
+
+thrust::host_vector<int> omp_small_input_data(int n, int modulus)
+{
+  thrust::host_vector<int> data = unittest::random_integers<int>(n);
+  for(int i = 0; i < n; ++i)
+  {
+    data[i] = static_cast<int>(static_cast<unsigned int>(data[i]) % modulus);
+  }
+  return data;
+}
+
+// neither commutative nor symmetric in its arguments
+struct weighted_difference
+{
+  __host__ __device__
+  int operator()(int curr, int prev) const
+  {
+    return 2 * curr - 3 * prev;
+  }
+};
+
+// the affine map x -> a * x + b
+struct affine
+{
+  unsigned int a;
+  unsigned int b;
+};
+
+// applies f, then g. associative, but not commutative
+struct compose
+{
+  __host__ __device__
+  affine operator()(const affine &f, const affine &g) const
+  {
+    affine h = {g.a * f.a, g.a * f.b + g.b};
+    return h;
+  }
+};
+
+struct is_even
+{
+  __host__ __device__
+  bool operator()(int x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+void TestOmpSmallElementwiseInput(void)
+{
+  using thrust::system::detail::internal::small_elementwise_size;
+
+  std::vector<int> sizes = omp_cutoff_sizes(small_elementwise_size);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input = omp_small_input_data(n, 1000);
+
+    // adjacent_difference
+    thrust::host_vector<int> reference(n);
+    std::adjacent_difference(input.begin(), input.end(), reference.begin(), weighted_difference());
+
+    thrust::host_vector<int> output(n);
+    thrust::adjacent_difference(thrust::omp::par, input.begin(), input.end(), output.begin(), weighted_difference());
+    ASSERT_EQUAL(output, reference);
+
+    // gather and scatter through a reversing map
+    thrust::host_vector<int> map(n);
+    thrust::sequence(map.begin(), map.end(), n - 1, -1);
+
+    thrust::host_vector<int> reversed(input.rbegin(), input.rend());
+
+    thrust::gather(thrust::omp::par, map.begin(), map.end(), input.begin(), output.begin());
+    ASSERT_EQUAL(output, reversed);
+
+    thrust::scatter(thrust::omp::par, input.begin(), input.end(), map.begin(), output.begin());
+    ASSERT_EQUAL(output, reversed);
+  }
+}
+DECLARE_UNITTEST(TestOmpSmallElementwiseInput);
+
+void TestOmpSmallCopyInput(void)
+{
+  using thrust::system::detail::internal::small_copy_size;
+
+  std::vector<int> sizes = omp_cutoff_sizes(small_copy_size);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input = omp_small_input_data(n, 1000);
+
+    thrust::host_vector<int> output(n + 1, -1);
+    thrust::host_vector<int>::iterator result =
+      thrust::copy(thrust::omp::par, input.begin(), input.end(), output.begin());
+    ASSERT_EQUAL(result - output.begin(), n);
+    ASSERT_EQUAL(thrust::equal(input.begin(), input.end(), output.begin()), true);
+    ASSERT_EQUAL(output[n], -1);
+
+    thrust::fill(output.begin(), output.end(), -1);
+    result = thrust::copy_n(thrust::omp::par, input.begin(), n, output.begin());
+    ASSERT_EQUAL(result - output.begin(), n);
+    ASSERT_EQUAL(thrust::equal(input.begin(), input.end(), output.begin()), true);
+    ASSERT_EQUAL(output[n], -1);
+  }
+}
+DECLARE_UNITTEST(TestOmpSmallCopyInput);
+
+void TestOmpSmallReduceInput(void)
+{
+  using thrust::system::detail::internal::small_reduce_size;
+
+  std::vector<int> sizes = omp_cutoff_sizes(small_reduce_size);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input = omp_small_input_data(n, 1000);
+
+    // reduce, with the partial results of the intervals combined in order
+    thrust::host_vector<affine> maps(n);
+    for(int i = 0; i < n; ++i)
+    {
+      affine f = {2 * static_cast<unsigned int>(input[i] % 7) + 1, static_cast<unsigned int>(input[i])};
+      maps[i] = f;
+    }
+
+    const affine init = {3, 5};
+    const affine reference = std::accumulate(maps.begin(), maps.end(), init, compose());
+    const affine result = thrust::reduce(thrust::omp::par, maps.begin(), maps.end(), init, compose());
+    ASSERT_EQUAL(result.a, reference.a);
+    ASSERT_EQUAL(result.b, reference.b);
+
+    // extrema, which must find the first of equal elements
+    ASSERT_EQUAL(thrust::min_element(thrust::omp::par, input.begin(), input.end()) - input.begin(),
+                 std::min_element(input.begin(), input.end()) - input.begin());
+    ASSERT_EQUAL(thrust::max_element(thrust::omp::par, input.begin(), input.end()) - input.begin(),
+                 std::max_element(input.begin(), input.end()) - input.begin());
+
+    // find_if, with the only match at the end
+    thrust::host_vector<int> odd(n, 1);
+    odd[n - 1] = 2;
+    ASSERT_EQUAL(thrust::find_if(thrust::omp::par, odd.begin(), odd.end(), is_even()) - odd.begin(), n - 1);
+  }
+}
+DECLARE_UNITTEST(TestOmpSmallReduceInput);
+
+void TestOmpSmallCompactionInput(void)
+{
+  using thrust::system::detail::internal::small_compaction_size;
+
+  std::vector<int> sizes = omp_cutoff_sizes(small_compaction_size);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input = omp_small_input_data(n, 4);
+
+    // copy_if
+    thrust::host_vector<int> reference(n);
+    reference.erase(std::copy_if(input.begin(), input.end(), reference.begin(), is_even()), reference.end());
+
+    thrust::host_vector<int> output(n);
+    output.erase(thrust::copy_if(thrust::omp::par, input.begin(), input.end(), output.begin(), is_even()),
+                 output.end());
+    ASSERT_EQUAL(output, reference);
+
+    // unique
+    reference = input;
+    reference.erase(std::unique(reference.begin(), reference.end()), reference.end());
+
+    output = input;
+    output.erase(thrust::unique(thrust::omp::par, output.begin(), output.end()), output.end());
+    ASSERT_EQUAL(output, reference);
+
+    // inclusive_scan
+    reference.resize(n);
+    std::partial_sum(input.begin(), input.end(), reference.begin());
+
+    output.resize(n);
+    thrust::inclusive_scan(thrust::omp::par, input.begin(), input.end(), output.begin());
+    ASSERT_EQUAL(output, reference);
+  }
+}
+DECLARE_UNITTEST(TestOmpSmallCompactionInput);
+
+// orders positions by the keys at them
+struct index_less
+{
+  const int *keys;
+
+  index_less(const thrust::host_vector<int> &keys)
+    : keys(thrust::raw_pointer_cast(keys.data()))
+  {}
+
+  bool operator()(int i, int j) const
+  {
+    return keys[i] < keys[j];
+  }
+};
+
+void TestOmpSmallSortInput(void)
+{
+  using thrust::system::detail::internal::small_sort_size;
+
+  std::vector<int> sizes = omp_cutoff_sizes(small_sort_size);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> keys = omp_small_input_data(n, 100);
+
+    thrust::host_vector<int> values(n);
+    thrust::sequence(values.begin(), values.end());
+
+    // sorting by key is stable, so equal keys keep their values in order
+    thrust::host_vector<int> reference_keys = keys;
+    thrust::host_vector<int> reference_values = values;
+    std::stable_sort(reference_values.begin(), reference_values.end(), index_less(keys));
+    for(int i = 0; i < n; ++i)
+    {
+      reference_keys[i] = keys[reference_values[i]];
+    }
+
+    thrust::host_vector<int> sorted = keys;
+    thrust::sort(thrust::omp::par, sorted.begin(), sorted.end());
+    ASSERT_EQUAL(sorted, reference_keys);
+
+    thrust::sort_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin());
+    ASSERT_EQUAL(keys, reference_keys);
+    ASSERT_EQUAL(values, reference_values);
+  }
+}
+DECLARE_UNITTEST(TestOmpSmallSortInput);
@@ -0,0 +1,94 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/tabulate.h>
+
+template<typename T>
+struct streaming_test_function
+{
+  __host__ __device__
+  T operator()(size_t i) const
+  {
+    return static_cast<T>(i * 7 + 3);
+  }
+};
+
+// the number of elements of type T covering the streaming threshold, plus a
+// few so that the range does not end on a streaming store boundary
+template<typename T>
+size_t omp_streaming_size()
+{
+  return thrust::system::detail::internal::streaming_store_threshold / sizeof(T) + 7;
+}
+
+// writes of [1, n + 1) of a buffer of n + 2 elements start one element past
+// an aligned allocation, so the head and tail of the range are written with
+// regular stores and the interior with streaming stores. the first and last
+// element of the buffer must be left untouched
+template<typename T>
+void TestOmpStreamingStores(void)
+{
+  const size_t n = omp_streaming_size<T>();
+  const T sentinel = static_cast<T>(-1);
+
+  thrust::host_vector<T> buffer(n + 2, sentinel);
+  thrust::host_vector<T> reference(n + 2, sentinel);
+  for(size_t i = 0; i < n; ++i)
+  {
+    reference[i + 1] = streaming_test_function<T>()(i);
+  }
+
+  // tabulate
+  thrust::tabulate(thrust::omp::par, buffer.begin() + 1, buffer.begin() + 1 + n, streaming_test_function<T>());
+  ASSERT_EQUAL(buffer, reference);
+
+  // copy
+  thrust::host_vector<T> copied(n + 2, sentinel);
+  typename thrust::host_vector<T>::iterator result =
+    thrust::copy(thrust::omp::par, buffer.begin() + 1, buffer.begin() + 1 + n, copied.begin() + 1);
+  ASSERT_EQUAL(result - copied.begin(), static_cast<std::ptrdiff_t>(n + 1));
+  ASSERT_EQUAL(copied, reference);
+
+  // copy_n, from an unaligned source to an aligned destination
+  thrust::host_vector<T> copied_n(n, sentinel);
+  thrust::copy_n(thrust::omp::par, buffer.begin() + 1, n, copied_n.begin());
+  ASSERT_EQUAL(thrust::equal(copied_n.begin(), copied_n.end(), reference.begin() + 1), true);
+
+  // sequence, over a cleared range
+  thrust::fill(buffer.begin() + 1, buffer.begin() + 1 + n, T(0));
+  thrust::sequence(thrust::omp::par, buffer.begin() + 1, buffer.begin() + 1 + n, T(3), T(7));
+  ASSERT_EQUAL(buffer, reference);
+
+  // fill
+  thrust::fill(thrust::omp::par, buffer.begin() + 1, buffer.begin() + 1 + n, T(42));
+  thrust::fill(reference.begin() + 1, reference.begin() + 1 + n, T(42));
+  ASSERT_EQUAL(buffer, reference);
+
+  thrust::fill_n(thrust::omp::par, buffer.begin() + 1, n, T(5));
+  thrust::fill(reference.begin() + 1, reference.begin() + 1 + n, T(5));
+  ASSERT_EQUAL(buffer, reference);
+}
+
+void TestOmpStreamingStoresChar(void)
+{
+  TestOmpStreamingStores<unsigned char>();
+}
+DECLARE_UNITTEST(TestOmpStreamingStoresChar);
+
+void TestOmpStreamingStoresInt(void)
+{
+  TestOmpStreamingStores<int>();
+}
+DECLARE_UNITTEST(TestOmpStreamingStoresInt);
+
+void TestOmpStreamingStoresDouble(void)
+{
+  TestOmpStreamingStores<double>();
+}
+DECLARE_UNITTEST(TestOmpStreamingStoresDouble);
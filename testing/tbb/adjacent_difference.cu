@@ -0,0 +1,105 @@
+#include <unittest/unittest.h>
+
+#include <thrust/adjacent_difference.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+#include <vector>
+
+// neither commutative nor symmetric in its arguments, so swapping the
+// current and previous element, or a wrong boundary element, changes the result
+struct weighted_difference
+{
+  __host__ __device__
+  int operator()(int curr, int prev) const
+  {
+    return 2 * curr - 3 * prev;
+  }
+};
+
+std::vector<size_t> tbb_adjacent_difference_sizes()
+{
+  using thrust::system::detail::internal::small_elementwise_size;
+
+  std::vector<size_t> sizes;
+  sizes.push_back(small_elementwise_size - 1);
+  sizes.push_back(small_elementwise_size);
+  sizes.push_back(small_elementwise_size + 1);
+  sizes.push_back(small_elementwise_size + 17);
+  sizes.push_back((1 << 20) + 7);
+  return sizes;
+}
+
+void TestTbbAdjacentDifference(void)
+{
+  std::vector<size_t> sizes = tbb_adjacent_difference_sizes();
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const size_t n = sizes[k];
+
+    thrust::host_vector<int> input = unittest::random_integers<int>(n);
+    thrust::transform(input.begin(), input.end(), input.begin(), thrust::placeholders::_1 % 1000);
+
+    thrust::host_vector<int> reference(n);
+    std::adjacent_difference(input.begin(), input.end(), reference.begin());
+
+    thrust::host_vector<int> output(n);
+    thrust::host_vector<int>::iterator result =
+      thrust::adjacent_difference(thrust::tbb::par, input.begin(), input.end(), output.begin());
+
+    ASSERT_EQUAL(result - output.begin(), static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(output, reference);
+  }
+}
+DECLARE_UNITTEST(TestTbbAdjacentDifference);
+
+void TestTbbAdjacentDifferenceNonCommutative(void)
+{
+  std::vector<size_t> sizes = tbb_adjacent_difference_sizes();
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const size_t n = sizes[k];
+
+    thrust::host_vector<int> input = unittest::random_integers<int>(n);
+    thrust::transform(input.begin(), input.end(), input.begin(), thrust::placeholders::_1 % 1000);
+
+    thrust::host_vector<int> reference(n);
+    std::adjacent_difference(input.begin(), input.end(), reference.begin(), weighted_difference());
+
+    thrust::host_vector<int> output(n);
+    thrust::adjacent_difference(thrust::tbb::par, input.begin(), input.end(), output.begin(), weighted_difference());
+
+    ASSERT_EQUAL(output, reference);
+  }
+}
+DECLARE_UNITTEST(TestTbbAdjacentDifferenceNonCommutative);
+
+void TestTbbAdjacentDifferenceInPlace(void)
+{
+  std::vector<size_t> sizes = tbb_adjacent_difference_sizes();
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const size_t n = sizes[k];
+
+    thrust::host_vector<int> data = unittest::random_integers<int>(n);
+    thrust::transform(data.begin(), data.end(), data.begin(), thrust::placeholders::_1 % 1000);
+
+    // every interval boundary reads an element which another interval overwrites
+    thrust::host_vector<int> reference(n);
+    std::adjacent_difference(data.begin(), data.end(), reference.begin(), weighted_difference());
+
+    thrust::host_vector<int>::iterator result =
+      thrust::adjacent_difference(thrust::tbb::par, data.begin(), data.end(), data.begin(), weighted_difference());
+
+    ASSERT_EQUAL(result - data.begin(), static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(data, reference);
+  }
+}
+DECLARE_UNITTEST(TestTbbAdjacentDifferenceInPlace);
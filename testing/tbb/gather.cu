@@ -0,0 +1,147 @@
+#include <unittest/unittest.h>
+
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <vector>
+
+// maps position i to an index of a range of n elements, either i itself or
+// n - 1 - i, and records any position outside the map, such as one read by
+// a prefetch past the end
+struct checked_index
+{
+  int n;
+  bool reverse;
+  int *out_of_range;
+
+  __host__ __device__
+  int operator()(int i) const
+  {
+    if(i < 0 || i >= n)
+    {
+      *out_of_range = 1;
+      return 0;
+    }
+
+    return reverse ? n - 1 - i : i;
+  }
+};
+
+typedef thrust::transform_iterator<checked_index, thrust::counting_iterator<int> > checked_map;
+
+std::vector<int> tbb_gather_sizes()
+{
+  using thrust::system::detail::internal::small_elementwise_size;
+
+  std::vector<int> sizes;
+  sizes.push_back(small_elementwise_size - 1);
+  sizes.push_back(small_elementwise_size);
+  sizes.push_back(small_elementwise_size + 1);
+  sizes.push_back((1 << 18) + 3);
+  return sizes;
+}
+
+void TestTbbGather(void)
+{
+  std::vector<int> sizes = tbb_gather_sizes();
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input(n);
+    thrust::sequence(input.begin(), input.end(), 10);
+
+    for(int reverse = 0; reverse < 2; ++reverse)
+    {
+      int out_of_range = 0;
+      checked_index f = {n, reverse != 0, &out_of_range};
+      checked_map map(thrust::counting_iterator<int>(0), f);
+
+      thrust::host_vector<int> output(n, -1);
+      thrust::host_vector<int>::iterator result =
+        thrust::gather(thrust::tbb::par, map, map + n, input.begin(), output.begin());
+
+      ASSERT_EQUAL(result - output.begin(), n);
+      ASSERT_EQUAL(out_of_range, 0);
+
+      thrust::host_vector<int> reference(n);
+      for(int i = 0; i < n; ++i)
+      {
+        reference[i] = input[reverse ? n - 1 - i : i];
+      }
+      ASSERT_EQUAL(output, reference);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTbbGather);
+
+void TestTbbGatherRandomMap(void)
+{
+  const int n = (1 << 18) + 3;
+
+  thrust::host_vector<int> input = unittest::random_integers<int>(n);
+  thrust::host_vector<int> map   = unittest::random_integers<int>(n);
+  for(int i = 0; i < n; ++i)
+  {
+    map[i] = static_cast<unsigned int>(map[i]) % n;
+  }
+
+  thrust::host_vector<int> output(n);
+  thrust::gather(thrust::tbb::par, map.begin(), map.end(), input.begin(), output.begin());
+
+  thrust::host_vector<int> reference(n);
+  for(int i = 0; i < n; ++i)
+  {
+    reference[i] = input[map[i]];
+  }
+  ASSERT_EQUAL(output, reference);
+}
+DECLARE_UNITTEST(TestTbbGatherRandomMap);
+
+void TestTbbGatherIf(void)
+{
+  std::vector<int> sizes = tbb_gather_sizes();
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const int n = sizes[k];
+
+    thrust::host_vector<int> input(n);
+    thrust::sequence(input.begin(), input.end(), 10);
+
+    thrust::host_vector<int> stencil(n);
+    for(int i = 0; i < n; ++i)
+    {
+      stencil[i] = i % 3 == 0;
+    }
+
+    for(int reverse = 0; reverse < 2; ++reverse)
+    {
+      int out_of_range = 0;
+      checked_index f = {n, reverse != 0, &out_of_range};
+      checked_map map(thrust::counting_iterator<int>(0), f);
+
+      thrust::host_vector<int> output(n, -1);
+      thrust::gather_if(thrust::tbb::par, map, map + n, stencil.begin(), input.begin(), output.begin());
+
+      ASSERT_EQUAL(out_of_range, 0);
+
+      thrust::host_vector<int> reference(n, -1);
+      for(int i = 0; i < n; ++i)
+      {
+        if(stencil[i])
+        {
+          reference[i] = input[reverse ? n - 1 - i : i];
+        }
+      }
+      ASSERT_EQUAL(output, reference);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTbbGatherIf);
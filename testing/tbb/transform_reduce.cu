@@ -0,0 +1,106 @@
+#include <unittest/unittest.h>
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/transform_reduce.h>
+
+#include <vector>
+
+// the affine map x -> a * x + b
+struct affine
+{
+  unsigned int a;
+  unsigned int b;
+};
+
+// odd multipliers, so that the product of many of them does not vanish
+// modulo 2^32 and turn every composition into a constant map
+struct make_affine
+{
+  __host__ __device__
+  affine operator()(int i) const
+  {
+    affine f = {2 * static_cast<unsigned int>(i % 7) + 1, static_cast<unsigned int>(i % 13)};
+    return f;
+  }
+};
+
+// applies f, then g. associative, but not commutative, so the partial
+// results of the intervals have to be combined in order
+struct compose
+{
+  __host__ __device__
+  affine operator()(const affine &f, const affine &g) const
+  {
+    affine h = {g.a * f.a, g.a * f.b + g.b};
+    return h;
+  }
+};
+
+struct square_mod_1000
+{
+  __host__ __device__
+  long long operator()(int x) const
+  {
+    return static_cast<long long>(x % 1000) * (x % 1000);
+  }
+};
+
+void TestTbbTransformReduceNonCommutative(void)
+{
+  using thrust::system::detail::internal::small_reduce_size;
+
+  std::vector<size_t> sizes;
+  sizes.push_back(small_reduce_size - 1);
+  sizes.push_back(small_reduce_size);
+  sizes.push_back(small_reduce_size + 1);
+  sizes.push_back((1 << 20) + 7);
+
+  for(size_t k = 0; k < sizes.size(); ++k)
+  {
+    const size_t n = sizes[k];
+
+    thrust::host_vector<int> input(n);
+    thrust::sequence(input.begin(), input.end());
+
+    const affine init = {3, 5};
+
+    affine reference = init;
+    for(size_t i = 0; i < n; ++i)
+    {
+      reference = compose()(reference, make_affine()(input[i]));
+    }
+
+    affine result =
+      thrust::transform_reduce(thrust::tbb::par, input.begin(), input.end(), make_affine(), init, compose());
+
+    ASSERT_EQUAL(result.a, reference.a);
+    ASSERT_EQUAL(result.b, reference.b);
+  }
+}
+DECLARE_UNITTEST(TestTbbTransformReduceNonCommutative);
+
+void TestTbbTransformReduce(void)
+{
+  const size_t n = (1 << 20) + 7;
+
+  thrust::host_vector<int> input = unittest::random_integers<int>(n);
+
+  long long reference = 0;
+  for(size_t i = 0; i < n; ++i)
+  {
+    reference += static_cast<long long>(input[i] % 1000) * (input[i] % 1000);
+  }
+
+  long long result = thrust::transform_reduce(thrust::tbb::par,
+                                              input.begin(),
+                                              input.end(),
+                                              square_mod_1000(),
+                                              0ll,
+                                              thrust::plus<long long>());
+
+  ASSERT_EQUAL(result, reference);
+}
+DECLARE_UNITTEST(TestTbbTransformReduce);
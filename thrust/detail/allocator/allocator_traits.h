@@ -25,6 +25,7 @@
 #include <thrust/detail/type_traits/has_nested_type.h>
 #include <thrust/detail/type_traits/has_member_function.h>
 #include <thrust/detail/type_traits.h>
+#include <thrust/growth_policy.h>
 
 #include <thrust/detail/memory_wrapper.h>
 
@@ -53,6 +54,7 @@ __THRUST_DEFINE_HAS_NESTED_TYPE(has_propagate_on_container_copy_assignment, prop
 __THRUST_DEFINE_HAS_NESTED_TYPE(has_propagate_on_container_move_assignment, propagate_on_container_move_assignment)
 __THRUST_DEFINE_HAS_NESTED_TYPE(has_propagate_on_container_swap, propagate_on_container_swap)
 __THRUST_DEFINE_HAS_NESTED_TYPE(has_system_type, system_type)
+__THRUST_DEFINE_HAS_NESTED_TYPE(has_growth_policy, growth_policy)
 __THRUST_DEFINE_HAS_NESTED_TYPE(has_is_always_equal, is_always_equal)
 __THRUST_DEFINE_HAS_MEMBER_FUNCTION(has_member_system_impl, system)
 
@@ -169,6 +171,12 @@ template<typename T>
   typedef typename T::system_type type;
 };
 
+template<typename T>
+  struct nested_growth_policy
+{
+  typedef typename T::growth_policy type;
+};
+
 template<typename Alloc>
   struct has_member_system
 {
@@ -435,6 +443,28 @@ template<typename Alloc>
 };
 
 
+// the growth policy of containers using Alloc
+template<typename Alloc>
+  struct allocator_growth_policy
+{
+  typedef typename eval_if<
+    allocator_traits_detail::has_growth_policy<Alloc>::value,
+    allocator_traits_detail::nested_growth_policy<Alloc>,
+    identity_<thrust::geometric_growth<> >
+  >::type type;
+};
+
+
+// attempts to resize the allocation p of n elements to new_n elements in place,
+// with the allocator's try_expand() member if it has one
+template<typename Alloc>
+__host__ __device__
+  bool allocator_try_expand(Alloc &a,
+                            typename allocator_traits<Alloc>::pointer p,
+                            typename allocator_traits<Alloc>::size_type n,
+                            typename allocator_traits<Alloc>::size_type new_n);
+
+
 } // end detail
 THRUST_NAMESPACE_END
 
@@ -350,6 +350,50 @@ __host__ __device__
 }
 
 
+__THRUST_DEFINE_IS_CALL_POSSIBLE(has_member_try_expand_impl, try_expand)
+
+template<typename Alloc>
+  class has_member_try_expand
+{
+  typedef typename allocator_traits<Alloc>::pointer   pointer;
+  typedef typename allocator_traits<Alloc>::size_type size_type;
+
+  public:
+    typedef typename has_member_try_expand_impl<Alloc, bool(pointer,size_type,size_type)>::type type;
+    static const bool value = type::value;
+};
+
+__thrust_exec_check_disable__
+template<typename Alloc>
+__host__ __device__
+  typename enable_if<
+    has_member_try_expand<Alloc>::value,
+    bool
+  >::type
+    try_expand(Alloc &a,
+               typename allocator_traits<Alloc>::pointer p,
+               typename allocator_traits<Alloc>::size_type n,
+               typename allocator_traits<Alloc>::size_type new_n)
+{
+  return a.try_expand(p, n, new_n);
+}
+
+template<typename Alloc>
+__host__ __device__
+  typename disable_if<
+    has_member_try_expand<Alloc>::value,
+    bool
+  >::type
+    try_expand(Alloc &,
+               typename allocator_traits<Alloc>::pointer,
+               typename allocator_traits<Alloc>::size_type,
+               typename allocator_traits<Alloc>::size_type)
+{
+  // allocations cannot be resized in place
+  return false;
+}
+
+
 } // end allocator_traits_detail
 
 
@@ -458,6 +502,16 @@ __host__ __device__
   return allocator_traits_detail::system(a);
 }
 
+template<typename Alloc>
+__host__ __device__
+  bool allocator_try_expand(Alloc &a,
+                            typename allocator_traits<Alloc>::pointer p,
+                            typename allocator_traits<Alloc>::size_type n,
+                            typename allocator_traits<Alloc>::size_type new_n)
+{
+  return allocator_traits_detail::try_expand(a, p, n, new_n);
+}
+
 
 } // end detail
 THRUST_NAMESPACE_END
@@ -109,6 +109,11 @@ template<typename T, typename Alloc>
     __host__ __device__
     void deallocate();
 
+    // resizes the allocation to n elements without moving it, if the allocator
+    // supports it; returns whether it did
+    __host__ __device__
+    bool try_expand(size_type n);
+
     __host__ __device__
     void swap(contiguous_storage &x);
 
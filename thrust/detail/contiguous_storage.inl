@@ -228,6 +228,20 @@ __host__ __device__
   } // end if
 } // end contiguous_storage::deallocate()
 
+template<typename T, typename Alloc>
+__host__ __device__
+  bool contiguous_storage<T,Alloc>
+    ::try_expand(size_type n)
+{
+  if(size() > 0 && allocator_try_expand(m_allocator, m_begin.base(), size(), n))
+  {
+    m_size = n;
+    return true;
+  } // end if
+
+  return false;
+} // end contiguous_storage::try_expand()
+
 template<typename T, typename Alloc>
 __host__ __device__
   void contiguous_storage<T,Alloc>
@@ -0,0 +1,234 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/error_code.h>
+#include <thrust/system/system_error.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <future>
+#include <random>
+#include <string>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+namespace external_sort_detail
+{
+
+inline void throw_io_error(const char *what)
+{
+  throw thrust::system_error(errno, thrust::generic_category(), what);
+}
+
+
+// a name for a spill file which does not collide with the files of other
+// calls, in this process or in others sharing the directory
+inline std::string unique_spill_name()
+{
+  static const unsigned long long process_id = std::random_device()();
+  static std::atomic<unsigned long long> counter(0);
+
+  return "thrust_external_sort_" + std::to_string(process_id) + "_" + std::to_string(counter++) + ".tmp";
+}
+
+
+// a temporary file holding the sorted runs of one pass back to back; the file
+// is deleted when it is destroyed. Keeping all runs in one file bounds the
+// number of open files regardless of the number of runs
+template<typename T>
+class spill_file
+{
+public:
+  explicit spill_file(const std::string &directory)
+    : m_file(nullptr), m_path(), m_size(0)
+  {
+    if(directory.empty())
+    {
+      m_file = std::tmpfile();
+    }
+    else
+    {
+      m_path = directory + "/" + unique_spill_name();
+      m_file = std::fopen(m_path.c_str(), "w+b");
+    }
+
+    if(m_file == nullptr)
+    {
+      throw_io_error("external_sort: failed to create a temporary file");
+    }
+  }
+
+  spill_file(const spill_file &) = delete;
+  spill_file &operator=(const spill_file &) = delete;
+
+  ~spill_file()
+  {
+    std::fclose(m_file);
+
+    if(!m_path.empty())
+    {
+      std::remove(m_path.c_str());
+    }
+  }
+
+  // the number of elements in the file
+  std::size_t size() const
+  {
+    return m_size;
+  }
+
+  void append(const T *data, std::size_t n)
+  {
+    if(n > 0 && std::fwrite(data, sizeof(T), n, m_file) != n)
+    {
+      throw_io_error("external_sort: failed to write a temporary file");
+    }
+
+    m_size += n;
+  }
+
+  // reads the n elements starting at element offset; the file must not be
+  // appended to concurrently
+  void read(std::size_t offset, T *data, std::size_t n)
+  {
+    if(n == 0)
+    {
+      return;
+    }
+
+    if(seek(offset) != 0)
+    {
+      throw_io_error("external_sort: failed to seek a temporary file");
+    }
+
+    if(std::fread(data, sizeof(T), n, m_file) != n)
+    {
+      throw_io_error("external_sort: failed to read a temporary file");
+    }
+  }
+
+private:
+  // spill files may exceed the range of long
+  int seek(std::size_t offset)
+  {
+#if defined(_WIN32)
+    return _fseeki64(m_file, static_cast<long long>(offset * sizeof(T)), SEEK_SET);
+#else
+    return fseeko(m_file, static_cast<off_t>(offset * sizeof(T)), SEEK_SET);
+#endif
+  }
+
+  std::FILE  *m_file;
+  std::string m_path;
+  std::size_t m_size;
+};
+
+
+// a sorted run: a range of elements of a spill file
+struct run
+{
+  std::size_t offset;
+  std::size_t size;
+};
+
+
+// runs one job at a time on a background thread, so that writing a buffer
+// overlaps with filling the next one. submit waits for the previous job, so
+// with two buffers in rotation a buffer is never refilled while it is being
+// written
+class async_writer
+{
+public:
+  async_writer() = default;
+
+  async_writer(const async_writer &) = delete;
+  async_writer &operator=(const async_writer &) = delete;
+
+  ~async_writer()
+  {
+    // errors are only reported through wait
+    if(m_pending.valid())
+    {
+      m_pending.wait();
+    }
+  }
+
+  template<typename Job>
+  void submit(Job job)
+  {
+    wait();
+    m_pending = std::async(std::launch::async, std::move(job));
+  }
+
+  // waits for the pending job, rethrowing its exception
+  void wait()
+  {
+    if(m_pending.valid())
+    {
+      m_pending.get();
+    }
+  }
+
+private:
+  std::future<void> m_pending;
+};
+
+
+// calls source until buffer is full or source reports the end of the input
+template<typename T, typename Source>
+std::size_t fill(Source &source, T *buffer, std::size_t capacity, bool &exhausted)
+{
+  std::size_t n = 0;
+
+  while(n < capacity)
+  {
+    const std::size_t count = source(buffer + n, capacity - n);
+
+    if(count == 0)
+    {
+      exhausted = true;
+      break;
+    }
+
+    n += count;
+  }
+
+  return n;
+}
+
+
+// merge buffers smaller than this make the merge bound by the latency of
+// reads, so the number of runs merged at once is limited to keep them larger
+static const std::size_t min_merge_block_bytes = 1 << 16;
+
+} // end external_sort_detail
+
+} // end detail
+
+THRUST_NAMESPACE_END
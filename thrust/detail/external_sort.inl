@@ -0,0 +1,325 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/external_sort.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/pair.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/multiway_merge.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+namespace external_sort_detail
+{
+
+// merges the runs [runs, runs + num_runs) of file and passes the result to
+// sink in blocks. Every run is read through a buffer, and a block is cut from
+// the buffered elements which are known to precede everything still on disk:
+// the run whose last buffered element is smallest bounds the block, and ties
+// are broken by run index as in the stable multiway_merge
+template<typename T, typename DerivedPolicy, typename Sink, typename StrictWeakOrdering>
+void merge_runs(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                spill_file<T> &file,
+                const run *runs,
+                std::size_t num_runs,
+                std::size_t budget,
+                Sink &sink,
+                StrictWeakOrdering comp)
+{
+  // num_runs input buffers and two output buffers
+  const std::size_t capacity = (std::max)(budget / (num_runs + 2), std::size_t(1));
+
+  std::vector<T> storage(capacity * (num_runs + 2));
+
+  std::vector<T *>          buffers(num_runs);
+  std::vector<std::size_t>  positions(num_runs, 0);
+  std::vector<std::size_t>  sizes(num_runs, 0);
+  std::vector<std::size_t>  read(num_runs, 0);
+
+  std::vector<T *>          begins(num_runs);
+  std::vector<std::size_t>  counts(num_runs);
+  std::vector<std::size_t>  splits(num_runs);
+  std::vector<thrust::pair<T *, T *> > parts(num_runs);
+
+  auto drained = [&](std::size_t i)
+  {
+    return read[i] == runs[i].size;
+  };
+
+  // moves the unconsumed elements of run i to the front of its buffer and
+  // tops it up from the file
+  auto refill = [&](std::size_t i)
+  {
+    const std::size_t remaining = sizes[i] - positions[i];
+    std::memmove(buffers[i], buffers[i] + positions[i], remaining * sizeof(T));
+
+    const std::size_t n = (std::min)(capacity - remaining, runs[i].size - read[i]);
+    file.read(runs[i].offset + read[i], buffers[i] + remaining, n);
+
+    positions[i] = 0;
+    sizes[i]     = remaining + n;
+    read[i]     += n;
+  };
+
+  for(std::size_t i = 0; i < num_runs; ++i)
+  {
+    buffers[i] = storage.data() + i * capacity;
+    refill(i);
+  }
+
+  async_writer writer;
+  T           *outputs[2] = {storage.data() + num_runs * capacity, storage.data() + (num_runs + 1) * capacity};
+  int          current    = 0;
+
+  while(true)
+  {
+    // refilling at half capacity keeps the blocks large without moving
+    // much data
+    for(std::size_t i = 0; i < num_runs; ++i)
+    {
+      if(!drained(i) && sizes[i] - positions[i] <= capacity / 2)
+      {
+        refill(i);
+      }
+    }
+
+    // a run which is not drained has a full buffer after the refill above,
+    // so its last buffered element exists
+    std::size_t bound = num_runs;
+    for(std::size_t i = 0; i < num_runs; ++i)
+    {
+      if(!drained(i) && (bound == num_runs || comp(buffers[i][sizes[i] - 1], buffers[bound][sizes[bound] - 1])))
+      {
+        bound = i;
+      }
+    }
+
+    std::size_t total = 0;
+    for(std::size_t i = 0; i < num_runs; ++i)
+    {
+      T *first = buffers[i] + positions[i];
+      T *last  = buffers[i] + sizes[i];
+
+      if(bound != num_runs)
+      {
+        const T &limit = buffers[bound][sizes[bound] - 1];
+
+        // the unread elements of earlier runs are greater than limit, and
+        // those of later runs follow it in the stable order
+        last = i <= bound ? std::upper_bound(first, last, limit, comp)
+                          : std::lower_bound(first, last, limit, comp);
+      }
+
+      begins[i] = first;
+      counts[i] = last - first;
+      total += counts[i];
+    }
+
+    if(total == 0)
+    {
+      break;
+    }
+
+    if(total > capacity)
+    {
+      thrust::system::detail::internal::multiway_merge_detail::split_runs(
+        begins.data(), counts.data(), num_runs, capacity, splits.data(), comp);
+      counts.swap(splits);
+      total = capacity;
+    }
+
+    for(std::size_t i = 0; i < num_runs; ++i)
+    {
+      parts[i] = thrust::make_pair(begins[i], begins[i] + counts[i]);
+      positions[i] += counts[i];
+    }
+
+    T *output = outputs[current];
+    thrust::multiway_merge(exec, parts.begin(), parts.end(), output, comp);
+
+    writer.submit([&sink, output, total] { sink(output, total); });
+    current ^= 1;
+  }
+
+  writer.wait();
+}
+
+} // end external_sort_detail
+
+} // end detail
+
+
+template<typename T, typename DerivedPolicy, typename Source, typename Sink, typename StrictWeakOrdering>
+external_sort_statistics external_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       Source source,
+                                       Sink sink,
+                                       const external_sort_options &options,
+                                       StrictWeakOrdering comp)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "external_sort requires trivially copyable elements");
+
+  using namespace thrust::detail::external_sort_detail;
+
+  typedef spill_file<T>                file_type;
+  typedef std::unique_ptr<file_type>   file_pointer;
+
+  external_sort_statistics statistics;
+
+  // the budget in elements; the input is sorted in two alternating chunks
+  const std::size_t budget = (std::max)(options.memory_budget / sizeof(T), std::size_t(2));
+  const std::size_t chunk  = budget / 2;
+
+  file_pointer     file;
+  std::vector<run> runs;
+
+  {
+    std::vector<T> buffers[2] = {std::vector<T>(chunk), std::vector<T>(chunk)};
+
+    async_writer writer;
+    bool         exhausted = false;
+    int          current   = 0;
+
+    while(!exhausted)
+    {
+      T *buffer = buffers[current].data();
+
+      const std::size_t n = fill(source, buffer, chunk, exhausted);
+      if(n == 0)
+      {
+        break;
+      }
+
+      thrust::sort(exec, buffer, buffer + n, comp);
+
+      // the whole input fits into memory
+      if(runs.empty() && exhausted)
+      {
+        statistics.num_elements = n;
+        sink(const_cast<const T *>(buffer), n);
+        return statistics;
+      }
+
+      if(!file)
+      {
+        file.reset(new file_type(options.temp_directory));
+      }
+
+      runs.push_back(run{statistics.num_elements, n});
+      statistics.num_elements += n;
+
+      // the write of this buffer overlaps with reading and sorting the
+      // other one
+      file_type *target = file.get();
+      writer.submit([target, buffer, n] { target->append(buffer, n); });
+      current ^= 1;
+    }
+
+    writer.wait();
+  }
+
+  if(runs.empty())
+  {
+    return statistics;
+  }
+
+  statistics.num_runs      = runs.size();
+  statistics.bytes_spilled = file->size() * sizeof(T);
+
+  std::size_t max_ways = options.max_merge_ways;
+  if(max_ways == 0)
+  {
+    const std::size_t block = (std::max)(min_merge_block_bytes / sizeof(T), std::size_t(1));
+    max_ways                = budget / block > 2 ? budget / block - 2 : 0;
+  }
+  max_ways = (std::max)(max_ways, std::size_t(2));
+
+  // merge groups of runs into longer runs of a new file until a single pass
+  // remains
+  while(runs.size() > max_ways)
+  {
+    file_pointer     merged_file(new file_type(options.temp_directory));
+    std::vector<run> merged_runs;
+
+    file_type *target = merged_file.get();
+    auto append = [target](const T *data, std::size_t n) { target->append(data, n); };
+
+    for(std::size_t first = 0; first < runs.size(); first += max_ways)
+    {
+      const std::size_t count  = (std::min)(max_ways, runs.size() - first);
+      const std::size_t offset = merged_file->size();
+
+      merge_runs(exec, *file, runs.data() + first, count, budget, append, comp);
+
+      merged_runs.push_back(run{offset, merged_file->size() - offset});
+    }
+
+    statistics.bytes_spilled += merged_file->size() * sizeof(T);
+    ++statistics.num_merge_passes;
+
+    file.swap(merged_file);
+    runs.swap(merged_runs);
+  }
+
+  merge_runs(exec, *file, runs.data(), runs.size(), budget, sink, comp);
+  ++statistics.num_merge_passes;
+
+  return statistics;
+}
+
+
+template<typename T, typename DerivedPolicy, typename Source, typename Sink>
+external_sort_statistics external_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       Source source,
+                                       Sink sink,
+                                       const external_sort_options &options)
+{
+  return thrust::external_sort<T>(exec, source, sink, options, thrust::less<T>());
+}
+
+
+template<typename T, typename Source, typename Sink, typename StrictWeakOrdering>
+external_sort_statistics external_sort(Source source,
+                                       Sink sink,
+                                       const external_sort_options &options,
+                                       StrictWeakOrdering comp)
+{
+  return thrust::external_sort<T>(thrust::host, source, sink, options, comp);
+}
+
+
+template<typename T, typename Source, typename Sink>
+external_sort_statistics external_sort(Source source,
+                                       Sink sink,
+                                       const external_sort_options &options)
+{
+  return thrust::external_sort<T>(thrust::host, source, sink, options, thrust::less<T>());
+}
+
+THRUST_NAMESPACE_END
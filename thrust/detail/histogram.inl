@@ -0,0 +1,202 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/adl/histogram.h>
+
+THRUST_NAMESPACE_BEGIN
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  OutputIterator histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  using thrust::system::detail::generic::histogram_even;
+  return histogram_even(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  OutputIterator histogram_even(InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type  System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_even(select_system(system1,system2), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  OutputIterator histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  using thrust::system::detail::generic::histogram_range;
+  return histogram_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  OutputIterator histogram_range(InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type  System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_range(select_system(system1,system2), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+
+__thrust_exec_check_disable__
+template<int NumChannels,
+         int NumActiveChannels,
+         typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  void multi_histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                            InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels])
+{
+  using thrust::system::detail::generic::multi_histogram_even;
+  return multi_histogram_even<NumChannels>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histograms, num_levels, lower_level, upper_level);
+} // end multi_histogram_even()
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  void multi_histogram_even(InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels])
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type  System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multi_histogram_even<NumChannels,NumActiveChannels>(select_system(system1,system2), first, last, histograms, num_levels, lower_level, upper_level);
+} // end multi_histogram_even()
+
+
+__thrust_exec_check_disable__
+template<int NumChannels,
+         int NumActiveChannels,
+         typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  void multi_histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels])
+{
+  using thrust::system::detail::generic::multi_histogram_range;
+  return multi_histogram_range<NumChannels>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, histograms, levels_first, levels_last);
+} // end multi_histogram_range()
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  void multi_histogram_range(InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels])
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type  System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multi_histogram_range<NumChannels,NumActiveChannels>(select_system(system1,system2), first, last, histograms, levels_first, levels_last);
+} // end multi_histogram_range()
+
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,211 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/system/detail/adl/multiway_merge.h>
+
+THRUST_NAMESPACE_BEGIN
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result)
+{
+  using thrust::system::detail::generic::multiway_merge;
+  return multiway_merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), runs_first, runs_last, result);
+} // end multiway_merge()
+
+
+template<typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator multiway_merge(RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type run_type;
+
+  typedef typename thrust::iterator_system<typename run_type::first_type>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type                System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multiway_merge(select_system(system1, system2), runs_first, runs_last, result);
+} // end multiway_merge()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  OutputIterator multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::multiway_merge;
+  return multiway_merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), runs_first, runs_last, result, comp);
+} // end multiway_merge()
+
+
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    multiway_merge(RandomAccessIterator runs_first,
+                   RandomAccessIterator runs_last,
+                   OutputIterator result,
+                   StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type run_type;
+
+  typedef typename thrust::iterator_system<typename run_type::first_type>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type                System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::multiway_merge(select_system(system1, system2), runs_first, runs_last, result, comp);
+} // end multiway_merge()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result)
+{
+  using thrust::system::detail::generic::multiway_merge_by_key;
+  return multiway_merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result);
+} // end multiway_merge_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type run_type;
+
+  typedef typename thrust::iterator_system<typename run_type::first_type>::type                               System1;
+  typedef typename thrust::iterator_system<typename thrust::iterator_value<RandomAccessIterator2>::type>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type                                             System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type                                             System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::multiway_merge_by_key(select_system(system1, system2, system3, system4), keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result);
+} // end multiway_merge_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::multiway_merge_by_key;
+  return multiway_merge_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result, comp);
+} // end multiway_merge_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    multiway_merge_by_key(RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type run_type;
+
+  typedef typename thrust::iterator_system<typename run_type::first_type>::type                               System1;
+  typedef typename thrust::iterator_system<typename thrust::iterator_value<RandomAccessIterator2>::type>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type                                             System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type                                             System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::multiway_merge_by_key(select_system(system1, system2, system3, system4), keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result, comp);
+} // end multiway_merge_by_key()
+
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,341 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp14_required.h>
+
+#if THRUST_CPP_DIALECT >= 2014
+
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/optional.h>
+
+#include <type_traits>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace pipeline_detail
+{
+
+
+// the first stage of every pipeline passes input elements through by value
+template<typename T>
+struct identity_stage
+{
+  __host__ __device__
+  T operator()(const T &x) const
+  {
+    return x;
+  }
+};
+
+
+// the value type produced by Stage for elements of type T
+template<typename Stage, typename T>
+struct stage_result
+{
+  typedef typename std::decay<
+    decltype(std::declval<const Stage &>()(std::declval<const T &>()))
+  >::type type;
+};
+
+
+// applies f to the output of an unfiltered stage
+template<typename Function, typename Stage>
+struct transform_stage
+{
+  mutable Function f;
+  Stage stage;
+
+  __host__ __device__
+  transform_stage(Function f, Stage stage)
+    : f(f), stage(stage)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename T>
+  __host__ __device__
+  auto operator()(const T &x) const
+  {
+    return f(stage(x));
+  }
+};
+
+
+// drops elements of an unfiltered stage for which pred is false, wrapping
+// the survivors in an optional
+template<typename Predicate, typename Stage>
+struct filter_stage
+{
+  mutable Predicate pred;
+  Stage stage;
+
+  __host__ __device__
+  filter_stage(Predicate pred, Stage stage)
+    : pred(pred), stage(stage)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename T>
+  __host__ __device__
+  thrust::optional<typename stage_result<Stage,T>::type>
+    operator()(const T &x) const
+  {
+    typedef typename stage_result<Stage,T>::type value_type;
+
+    value_type value = stage(x);
+
+    return pred(value) ? thrust::optional<value_type>(std::move(value))
+                       : thrust::optional<value_type>();
+  }
+};
+
+
+// applies f to the surviving elements of a filtered stage
+template<typename Function, typename Stage>
+struct filtered_transform_stage
+{
+  mutable Function f;
+  Stage stage;
+
+  __host__ __device__
+  filtered_transform_stage(Function f, Stage stage)
+    : f(f), stage(stage)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename T>
+  __host__ __device__
+  auto operator()(const T &x) const
+  {
+    auto value = stage(x);
+
+    typedef typename std::decay<decltype(f(*value))>::type result_type;
+
+    return value ? thrust::optional<result_type>(f(*value))
+                 : thrust::optional<result_type>();
+  }
+};
+
+
+// drops the surviving elements of a filtered stage for which pred is false
+template<typename Predicate, typename Stage>
+struct filtered_filter_stage
+{
+  mutable Predicate pred;
+  Stage stage;
+
+  __host__ __device__
+  filtered_filter_stage(Predicate pred, Stage stage)
+    : pred(pred), stage(stage)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename T>
+  __host__ __device__
+  auto operator()(const T &x) const
+  {
+    auto value = stage(x);
+
+    if(value && !pred(*value))
+    {
+      value = thrust::nullopt;
+    }
+
+    return value;
+  }
+};
+
+
+// converts the output of a filtered stage to the reduction type
+template<typename OutputType, typename Stage>
+struct reduce_stage
+{
+  Stage stage;
+
+  __host__ __device__
+  reduce_stage(Stage stage)
+    : stage(stage)
+  {}
+
+  template<typename T>
+  __host__ __device__
+  thrust::optional<OutputType> operator()(const T &x) const
+  {
+    auto value = stage(x);
+
+    return value ? thrust::optional<OutputType>(OutputType(*value))
+                 : thrust::optional<OutputType>();
+  }
+};
+
+
+// lifts a reduction operator to optionals, treating an empty optional as
+// the identity
+template<typename OutputType, typename BinaryFunction>
+struct optional_reduce_op
+{
+  mutable BinaryFunction binary_op;
+
+  __host__ __device__
+  optional_reduce_op(BinaryFunction binary_op)
+    : binary_op(binary_op)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  thrust::optional<OutputType> operator()(const thrust::optional<OutputType> &lhs,
+                                          const thrust::optional<OutputType> &rhs) const
+  {
+    if(!lhs) return rhs;
+    if(!rhs) return lhs;
+
+    return thrust::optional<OutputType>(OutputType(binary_op(*lhs, *rhs)));
+  }
+};
+
+
+struct has_value
+{
+  template<typename T>
+  __host__ __device__
+  bool operator()(const thrust::optional<T> &x) const
+  {
+    return x.has_value();
+  }
+};
+
+
+struct unwrap_optional
+{
+  template<typename T>
+  __host__ __device__
+  T operator()(const thrust::optional<T> &x) const
+  {
+    return *x;
+  }
+};
+
+
+template<typename Function, typename Stage, bool Filtered>
+struct make_transform_stage
+{
+  typedef transform_stage<Function,Stage> type;
+};
+
+template<typename Function, typename Stage>
+struct make_transform_stage<Function,Stage,true>
+{
+  typedef filtered_transform_stage<Function,Stage> type;
+};
+
+
+template<typename Predicate, typename Stage, bool Filtered>
+struct make_filter_stage
+{
+  typedef filter_stage<Predicate,Stage> type;
+};
+
+template<typename Predicate, typename Stage>
+struct make_filter_stage<Predicate,Stage,true>
+{
+  typedef filtered_filter_stage<Predicate,Stage> type;
+};
+
+
+} // end pipeline_detail
+
+
+// a lazy sequence of stages over [first, last). no stage is evaluated until
+// the pipeline is terminated by reduced, counted or copied, which then run
+// as a single traversal of the input
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered>
+class pipeline_view
+{
+  public:
+    typedef DerivedPolicy policy_type;
+    typedef Iterator      iterator;
+    typedef Stage         stage_type;
+
+    static const bool is_filtered = Filtered;
+
+    __host__ __device__
+    pipeline_view(const DerivedPolicy &exec, Iterator first, Iterator last, Stage stage)
+      : m_exec(exec), m_first(first), m_last(last), m_stage(stage)
+    {}
+
+    __host__ __device__
+    DerivedPolicy &policy() const { return m_exec; }
+
+    __host__ __device__
+    Iterator begin() const { return m_first; }
+
+    __host__ __device__
+    Iterator end() const { return m_last; }
+
+    __host__ __device__
+    Stage stage() const { return m_stage; }
+
+  private:
+    mutable DerivedPolicy m_exec;
+    Iterator m_first;
+    Iterator m_last;
+    Stage m_stage;
+};
+
+
+template<typename Function>
+struct transformed_adaptor
+{
+  Function f;
+};
+
+
+template<typename Predicate>
+struct filtered_adaptor
+{
+  Predicate pred;
+};
+
+
+template<typename OutputType, typename BinaryFunction>
+struct reduced_adaptor
+{
+  OutputType init;
+  BinaryFunction binary_op;
+};
+
+
+struct counted_adaptor
+{};
+
+
+template<typename OutputIterator>
+struct copied_adaptor
+{
+  OutputIterator result;
+};
+
+
+} // end detail
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2014
+
@@ -0,0 +1,272 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/pipeline.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace pipeline_detail
+{
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, typename OutputType, typename BinaryFunction>
+__host__ __device__
+OutputType reduce(const pipeline_view<DerivedPolicy,Iterator,Stage,false> &p,
+                  const reduced_adaptor<OutputType,BinaryFunction> &stage)
+{
+  return thrust::transform_reduce(p.policy(), p.begin(), p.end(), p.stage(), stage.init, stage.binary_op);
+}
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, typename OutputType, typename BinaryFunction>
+__host__ __device__
+OutputType reduce(const pipeline_view<DerivedPolicy,Iterator,Stage,true> &p,
+                  const reduced_adaptor<OutputType,BinaryFunction> &stage)
+{
+  // filtered-out elements become empty optionals, which the lifted operator
+  // treats as the identity, so no identity element is required of binary_op
+  thrust::optional<OutputType> result =
+    thrust::transform_reduce(p.policy(),
+                             p.begin(),
+                             p.end(),
+                             reduce_stage<OutputType,Stage>(p.stage()),
+                             thrust::optional<OutputType>(),
+                             optional_reduce_op<OutputType,BinaryFunction>(stage.binary_op));
+
+  return result ? OutputType(stage.binary_op(stage.init, *result)) : stage.init;
+}
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage>
+__host__ __device__
+typename thrust::iterator_difference<Iterator>::type
+  count(const pipeline_view<DerivedPolicy,Iterator,Stage,false> &p)
+{
+  return thrust::distance(p.begin(), p.end());
+}
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage>
+__host__ __device__
+typename thrust::iterator_difference<Iterator>::type
+  count(const pipeline_view<DerivedPolicy,Iterator,Stage,true> &p)
+{
+  return thrust::count_if(p.policy(),
+                          thrust::make_transform_iterator(p.begin(), p.stage()),
+                          thrust::make_transform_iterator(p.end(), p.stage()),
+                          has_value());
+}
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, typename OutputIterator>
+__host__ __device__
+OutputIterator copy(const pipeline_view<DerivedPolicy,Iterator,Stage,false> &p,
+                    OutputIterator result)
+{
+  return thrust::transform(p.policy(), p.begin(), p.end(), result, p.stage());
+}
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, typename OutputIterator>
+__host__ __device__
+OutputIterator copy(const pipeline_view<DerivedPolicy,Iterator,Stage,true> &p,
+                    OutputIterator result)
+{
+  // unwrap the surviving optionals as they are written
+  return thrust::copy_if(p.policy(),
+                         thrust::make_transform_iterator(p.begin(), p.stage()),
+                         thrust::make_transform_iterator(p.end(), p.stage()),
+                         thrust::make_transform_output_iterator(result, unwrap_optional()),
+                         has_value()).base();
+}
+
+
+} // end pipeline_detail
+} // end detail
+
+
+template<typename DerivedPolicy, typename InputIterator>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  InputIterator,
+  thrust::detail::pipeline_detail::identity_stage<typename thrust::iterator_value<InputIterator>::type>,
+  false
+>
+  pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+           InputIterator first,
+           InputIterator last)
+{
+  typedef thrust::detail::pipeline_detail::identity_stage<typename thrust::iterator_value<InputIterator>::type> stage_type;
+  typedef thrust::detail::pipeline_view<DerivedPolicy,InputIterator,stage_type,false> result_type;
+
+  return result_type(thrust::detail::derived_cast(exec), first, last, stage_type());
+} // end pipeline()
+
+
+template<typename InputIterator>
+__host__ __device__
+thrust::detail::pipeline_view<
+  typename thrust::iterator_system<InputIterator>::type,
+  InputIterator,
+  thrust::detail::pipeline_detail::identity_stage<typename thrust::iterator_value<InputIterator>::type>,
+  false
+>
+  pipeline(InputIterator first,
+           InputIterator last)
+{
+  typedef typename thrust::iterator_system<InputIterator>::type System;
+  System system;
+
+  return thrust::pipeline(system, first, last);
+} // end pipeline()
+
+
+template<typename UnaryFunction>
+__host__ __device__
+thrust::detail::transformed_adaptor<UnaryFunction>
+  transformed(UnaryFunction f)
+{
+  thrust::detail::transformed_adaptor<UnaryFunction> result = {f};
+  return result;
+} // end transformed()
+
+
+template<typename Predicate>
+__host__ __device__
+thrust::detail::filtered_adaptor<Predicate>
+  filtered(Predicate pred)
+{
+  thrust::detail::filtered_adaptor<Predicate> result = {pred};
+  return result;
+} // end filtered()
+
+
+template<typename OutputType, typename BinaryFunction>
+__host__ __device__
+thrust::detail::reduced_adaptor<OutputType,BinaryFunction>
+  reduced(OutputType init, BinaryFunction binary_op)
+{
+  thrust::detail::reduced_adaptor<OutputType,BinaryFunction> result = {init, binary_op};
+  return result;
+} // end reduced()
+
+
+template<typename OutputType>
+__host__ __device__
+thrust::detail::reduced_adaptor<OutputType,thrust::plus<OutputType> >
+  reduced(OutputType init)
+{
+  return thrust::reduced(init, thrust::plus<OutputType>());
+} // end reduced()
+
+
+__host__ __device__
+inline thrust::detail::counted_adaptor counted()
+{
+  return thrust::detail::counted_adaptor();
+} // end counted()
+
+
+template<typename OutputIterator>
+__host__ __device__
+thrust::detail::copied_adaptor<OutputIterator>
+  copied(OutputIterator result)
+{
+  thrust::detail::copied_adaptor<OutputIterator> adaptor = {result};
+  return adaptor;
+} // end copied()
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename UnaryFunction>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  Iterator,
+  typename thrust::detail::pipeline_detail::make_transform_stage<UnaryFunction,Stage,Filtered>::type,
+  Filtered
+>
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::transformed_adaptor<UnaryFunction> stage)
+{
+  typedef typename thrust::detail::pipeline_detail::make_transform_stage<UnaryFunction,Stage,Filtered>::type stage_type;
+  typedef thrust::detail::pipeline_view<DerivedPolicy,Iterator,stage_type,Filtered> result_type;
+
+  return result_type(p.policy(), p.begin(), p.end(), stage_type(stage.f, p.stage()));
+} // end operator|()
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename Predicate>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  Iterator,
+  typename thrust::detail::pipeline_detail::make_filter_stage<Predicate,Stage,Filtered>::type,
+  true
+>
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::filtered_adaptor<Predicate> stage)
+{
+  typedef typename thrust::detail::pipeline_detail::make_filter_stage<Predicate,Stage,Filtered>::type stage_type;
+  typedef thrust::detail::pipeline_view<DerivedPolicy,Iterator,stage_type,true> result_type;
+
+  return result_type(p.policy(), p.begin(), p.end(), stage_type(stage.pred, p.stage()));
+} // end operator|()
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename OutputType, typename BinaryFunction>
+__host__ __device__
+OutputType
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::reduced_adaptor<OutputType,BinaryFunction> stage)
+{
+  return thrust::detail::pipeline_detail::reduce(p, stage);
+} // end operator|()
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered>
+__host__ __device__
+typename thrust::iterator_difference<Iterator>::type
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::counted_adaptor)
+{
+  return thrust::detail::pipeline_detail::count(p);
+} // end operator|()
+
+
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename OutputIterator>
+__host__ __device__
+OutputIterator
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::copied_adaptor<OutputIterator> stage)
+{
+  return thrust::detail::pipeline_detail::copy(p, stage.result);
+} // end operator|()
+
+
+THRUST_NAMESPACE_END
+
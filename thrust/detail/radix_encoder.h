@@ -0,0 +1,273 @@
+/*
+ *  Copyright 2008-2021 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/functional.h>
+#include <thrust/tuple.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+
+#include <limits>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+
+// radix_encoder maps a key to an unsigned integer whose ordering matches
+// the ordering of the key, so keys may be radix sorted digit by digit
+template <typename T>
+struct radix_encoder : public thrust::identity<T>
+{};
+
+
+template <>
+struct radix_encoder<char> : public thrust::unary_function<char, unsigned char>
+{
+  __host__ __device__
+  unsigned char operator()(char x) const
+  {
+    if(std::numeric_limits<char>::is_signed)
+    {
+      return static_cast<unsigned char>(x) ^ static_cast<unsigned char>(1) << (8 * sizeof(unsigned char) - 1);
+    }
+    else
+    {
+      return x;
+    }
+  }
+};
+
+template <>
+struct radix_encoder<signed char> : public thrust::unary_function<signed char, unsigned char>
+{
+  __host__ __device__
+  unsigned char operator()(signed char x) const
+  {
+    return static_cast<unsigned char>(x) ^ static_cast<unsigned char>(1) << (8 * sizeof(unsigned char) - 1);
+  }
+};
+
+template <>
+struct radix_encoder<short> : public thrust::unary_function<short, unsigned short>
+{
+  __host__ __device__
+  unsigned short operator()(short x) const
+  {
+    return static_cast<unsigned short>(x) ^ static_cast<unsigned short>(1) << (8 * sizeof(unsigned short) - 1);
+  }
+};
+
+template <>
+struct radix_encoder<int> : public thrust::unary_function<int, unsigned int>
+{
+  __host__ __device__
+  unsigned int operator()(int x) const
+  {
+    return static_cast<unsigned int>(x) ^ static_cast<unsigned int>(1) << (8 * sizeof(unsigned int) - 1);
+  }
+};
+
+template <>
+struct radix_encoder<long> : public thrust::unary_function<long, unsigned long>
+{
+  __host__ __device__
+  unsigned long operator()(long x) const
+  {
+    return x ^ static_cast<unsigned long>(1) << (8 * sizeof(unsigned long) - 1);
+  }
+};
+
+template <>
+struct radix_encoder<long long> : public thrust::unary_function<long long, unsigned long long>
+{
+  __host__ __device__
+  unsigned long long operator()(long long x) const
+  {
+    return x ^ static_cast<unsigned long long>(1) << (8 * sizeof(unsigned long long) - 1);
+  }
+};
+
+// ideally we'd use uint32 here and uint64 below
+template <>
+struct radix_encoder<float> : public thrust::unary_function<float, thrust::detail::uint32_t>
+{
+  __host__ __device__
+  thrust::detail::uint32_t operator()(float x) const
+  {
+    union { float f; thrust::detail::uint32_t i; } u;
+    u.f = x;
+    thrust::detail::uint32_t mask = -static_cast<thrust::detail::int32_t>(u.i >> 31) | (static_cast<thrust::detail::uint32_t>(1) << 31);
+    return u.i ^ mask;
+  }
+};
+
+template <>
+struct radix_encoder<double> : public thrust::unary_function<double, thrust::detail::uint64_t>
+{
+  __host__ __device__
+  thrust::detail::uint64_t operator()(double x) const
+  {
+    union { double f; thrust::detail::uint64_t i; } u;
+    u.f = x;
+    thrust::detail::uint64_t mask = -static_cast<thrust::detail::int64_t>(u.i >> 63) | (static_cast<thrust::detail::uint64_t>(1) << 63);
+    return u.i ^ mask;
+  }
+};
+
+
+// the number of bits in the encoded representation of T
+template <typename T>
+struct radix_encoded_bits
+  : thrust::detail::integral_constant<
+      unsigned int,
+      8 * sizeof(typename radix_encoder<T>::result_type)
+    >
+{};
+
+
+// returns bits [begin_bit, end_bit) of x, shifted down to bit 0;
+// the bit range is clamped to the width of x
+template <typename Unsigned>
+__host__ __device__
+Unsigned radix_bit_field(Unsigned x, int begin_bit, int end_bit)
+{
+  const int num_bits = 8 * sizeof(Unsigned);
+
+  if(end_bit > num_bits) end_bit = num_bits;
+  if(begin_bit < 0)      begin_bit = 0;
+
+  if(begin_bit >= end_bit)
+  {
+    return Unsigned(0);
+  }
+
+  const int width = end_bit - begin_bit;
+
+  x = static_cast<Unsigned>(x >> begin_bit);
+
+  return (width < num_bits) ? static_cast<Unsigned>(x & ((Unsigned(1) << width) - 1)) : x;
+}
+
+
+// radix_tuple_fields walks the fields [I, N) of a decomposed key, the first
+// field being the most significant one
+template <typename Tuple,
+          unsigned int I = 0,
+          unsigned int N = thrust::tuple_size<Tuple>::value>
+struct radix_tuple_fields
+{
+  typedef typename thrust::detail::remove_cv<
+    typename thrust::detail::remove_reference<
+      typename thrust::tuple_element<I, Tuple>::type
+    >::type
+  >::type field_type;
+
+  typedef radix_tuple_fields<Tuple, I + 1, N> rest;
+
+  static const unsigned int num_bits = radix_encoded_bits<field_type>::value + rest::num_bits;
+
+  // concatenates the encoded fields; the caller guarantees that num_bits
+  // fit in Unsigned
+  template <typename Unsigned>
+  __host__ __device__
+  static Unsigned encode(const Tuple &t)
+  {
+    const Unsigned x = static_cast<Unsigned>(radix_encoder<field_type>()(thrust::get<I>(t)));
+
+    return static_cast<Unsigned>(x << rest::num_bits) | rest::template encode<Unsigned>(t);
+  }
+
+  // lexicographic comparison of the encoded fields, which needs no
+  // bound on num_bits
+  __host__ __device__
+  static bool less(const Tuple &lhs, const Tuple &rhs)
+  {
+    radix_encoder<field_type> encode;
+
+    const typename radix_encoder<field_type>::result_type x = encode(thrust::get<I>(lhs));
+    const typename radix_encoder<field_type>::result_type y = encode(thrust::get<I>(rhs));
+
+    return (x < y) || (!(y < x) && rest::less(lhs, rhs));
+  }
+};
+
+template <typename Tuple, unsigned int N>
+struct radix_tuple_fields<Tuple, N, N>
+{
+  static const unsigned int num_bits = 0;
+
+  template <typename Unsigned>
+  __host__ __device__
+  static Unsigned encode(const Tuple &)
+  {
+    return Unsigned(0);
+  }
+
+  __host__ __device__
+  static bool less(const Tuple &, const Tuple &)
+  {
+    return false;
+  }
+};
+
+
+// encodes a key as the concatenation of the encoded fields returned by
+// Decomposer; keys of more than 64 bits are not radix sortable, but may
+// still be compared with radix_tuple_fields::less
+template <typename Key, typename Decomposer>
+struct decomposed_radix_encoder
+{
+  typedef typename thrust::detail::remove_cv<
+    typename thrust::detail::remove_reference<
+      decltype(std::declval<const Decomposer &>()(std::declval<const Key &>()))
+    >::type
+  >::type tuple_type;
+
+  typedef radix_tuple_fields<tuple_type> fields;
+
+  static const unsigned int num_bits = fields::num_bits;
+
+  typedef thrust::detail::integral_constant<bool, (num_bits <= 64)> is_radix_sortable;
+
+  typedef typename thrust::detail::conditional<
+    (num_bits <= 32),
+    thrust::detail::uint32_t,
+    thrust::detail::uint64_t
+  >::type result_type;
+
+  Decomposer decompose;
+
+  __host__ __device__
+  decomposed_radix_encoder(Decomposer decompose)
+    : decompose(decompose)
+  {}
+
+  __host__ __device__
+  result_type operator()(const Key &key) const
+  {
+    return fields::template encode<result_type>(decompose(key));
+  }
+};
+
+
+} // end namespace detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,351 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/adl/segmented_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_reduce()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_reduce(RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_reduce(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_reduce()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, init, binary_op);
+} // end segmented_reduce()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_reduce(RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_reduce(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, init, binary_op);
+} // end segmented_reduce()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_transform_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                            RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::segmented_transform_reduce;
+  return segmented_transform_reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, unary_op, init, binary_op);
+} // end segmented_transform_reduce()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_transform_reduce(RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_transform_reduce(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, unary_op, init, binary_op);
+} // end segmented_transform_reduce()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_min_element;
+  return segmented_min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_min_element()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_min_element(RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_min_element(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_min_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  using thrust::system::detail::generic::segmented_min_element;
+  return segmented_min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, comp);
+} // end segmented_min_element()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    segmented_min_element(RandomAccessIterator first,
+                          BeginOffsetIterator begin_offsets_first,
+                          BeginOffsetIterator begin_offsets_last,
+                          EndOffsetIterator end_offsets_first,
+                          OutputIterator result,
+                          BinaryPredicate comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_min_element(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, comp);
+} // end segmented_min_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_max_element;
+  return segmented_max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_max_element()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_max_element(RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_max_element(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_max_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  using thrust::system::detail::generic::segmented_max_element;
+  return segmented_max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, comp);
+} // end segmented_max_element()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    segmented_max_element(RandomAccessIterator first,
+                          BeginOffsetIterator begin_offsets_first,
+                          BeginOffsetIterator begin_offsets_last,
+                          EndOffsetIterator end_offsets_first,
+                          OutputIterator result,
+                          BinaryPredicate comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_max_element(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, comp);
+} // end segmented_max_element()
+
+THRUST_NAMESPACE_END
+
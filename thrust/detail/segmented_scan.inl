@@ -0,0 +1,117 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/segmented_scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/segmented_scan.h>
+#include <thrust/system/detail/adl/segmented_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  void segmented_inclusive_scan(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_inclusive_scan;
+  return segmented_inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_inclusive_scan()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  void segmented_inclusive_scan(RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_inclusive_scan(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result);
+} // end segmented_inclusive_scan()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+__host__ __device__
+  void segmented_inclusive_scan(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result,
+                                AssociativeOperator binary_op)
+{
+  using thrust::system::detail::generic::segmented_inclusive_scan;
+  return segmented_inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, binary_op);
+} // end segmented_inclusive_scan()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    segmented_inclusive_scan(RandomAccessIterator first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             OutputIterator result,
+                             AssociativeOperator binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type       System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_inclusive_scan(select_system(system1, system2), first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, binary_op);
+} // end segmented_inclusive_scan()
+
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,364 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/adl/segmented_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void segmented_sort(RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::segmented_sort(select_system(system), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort(RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::segmented_sort(select_system(system), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::stable_segmented_sort;
+  return stable_segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end stable_segmented_sort()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void stable_segmented_sort(RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::stable_segmented_sort(select_system(system), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end stable_segmented_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::stable_segmented_sort;
+  return stable_segmented_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort()
+
+
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort(RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::stable_segmented_sort(select_system(system), keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort_by_key(select_system(system1,system2), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end segmented_sort_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  return segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort_by_key(select_system(system1,system2), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::stable_segmented_sort_by_key;
+  return stable_segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end stable_segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void stable_segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::stable_segmented_sort_by_key(select_system(system1,system2), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first);
+} // end stable_segmented_sort_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::stable_segmented_sort_by_key;
+  return stable_segmented_sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::stable_segmented_sort_by_key(select_system(system1,system2), keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort_by_key()
+
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,401 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/selection.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/selection.h>
+#include <thrust/system/detail/adl/selection.h>
+
+THRUST_NAMESPACE_BEGIN
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last);
+} // end nth_element()
+
+
+template<typename RandomAccessIterator>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last);
+} // end nth_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last, comp);
+} // end nth_element()
+
+
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    nth_element(RandomAccessIterator first,
+                RandomAccessIterator nth,
+                RandomAccessIterator last,
+                StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last, comp);
+} // end nth_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last);
+} // end partial_sort()
+
+
+template<typename RandomAccessIterator>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last);
+} // end partial_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last, comp);
+} // end partial_sort()
+
+
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    partial_sort(RandomAccessIterator first,
+                 RandomAccessIterator middle,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last, comp);
+} // end partial_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+  RandomAccessIterator2 partial_sort_copy(RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last,
+                                          StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    RandomAccessIterator2
+  >::type
+    partial_sort_copy(RandomAccessIterator1 first,
+                      RandomAccessIterator1 last,
+                      RandomAccessIterator2 result_first,
+                      RandomAccessIterator2 result_last,
+                      StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result);
+} // end top_k()
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+  RandomAccessIterator2 top_k(RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result);
+} // end top_k()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result,
+                              StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result, comp);
+} // end top_k()
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    RandomAccessIterator2
+  >::type
+    top_k(RandomAccessIterator1 first,
+          RandomAccessIterator1 last,
+          typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+          RandomAccessIterator2 result,
+          StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result, comp);
+} // end top_k()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result)
+{
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, k, keys_result, values_result);
+} // end top_k_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator3>::type System3;
+  typedef typename thrust::iterator_system<RandomAccessIterator4>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(select_system(system1, system2, system3, system4), keys_first, keys_last, values_first, k, keys_result, values_result);
+} // end top_k_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, k, keys_result, values_result, comp);
+} // end top_k_by_key()
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+  >::type
+    top_k_by_key(RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator3>::type System3;
+  typedef typename thrust::iterator_system<RandomAccessIterator4>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(select_system(system1, system2, system3, system4), keys_first, keys_last, values_first, k, keys_result, values_result, comp);
+} // end top_k_by_key()
+
+THRUST_NAMESPACE_END
+
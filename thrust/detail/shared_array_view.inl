@@ -0,0 +1,196 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/shared_array_view.h>
+
+#include <atomic>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+template<typename T, typename Alloc>
+shared_array_view<T, Alloc>::shared_array_view() noexcept
+  : m_storage()
+{
+}
+
+template<typename T, typename Alloc>
+shared_array_view<T, Alloc>::shared_array_view(storage_type &&v)
+  : m_storage(std::make_shared<storage_type>(std::move(v)))
+{
+}
+
+template<typename T, typename Alloc>
+shared_array_view<T, Alloc>::shared_array_view(const storage_type &v)
+  : m_storage(std::make_shared<storage_type>(v))
+{
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::size_type shared_array_view<T, Alloc>::size() const
+{
+  return m_storage ? m_storage->size() : 0;
+}
+
+template<typename T, typename Alloc>
+bool shared_array_view<T, Alloc>::empty() const
+{
+  return size() == 0;
+}
+
+template<typename T, typename Alloc>
+long shared_array_view<T, Alloc>::use_count() const noexcept
+{
+  return m_storage.use_count();
+}
+
+template<typename T, typename Alloc>
+bool shared_array_view<T, Alloc>::unique() const noexcept
+{
+  return m_storage != nullptr && !shared();
+}
+
+template<typename T, typename Alloc>
+bool shared_array_view<T, Alloc>::shared() const noexcept
+{
+  if(use_count() > 1)
+  {
+    return true;
+  }
+
+  // use_count is a relaxed load. Views released on other threads decremented
+  // the count with release semantics, so acquire their reads of the elements
+  // before this view writes to them
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  return false;
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::allocator_type shared_array_view<T, Alloc>::get_allocator() const
+{
+  return m_storage->get_allocator();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_iterator shared_array_view<T, Alloc>::begin() const
+{
+  // an empty view refers to no storage
+  if(!m_storage)
+  {
+    return const_iterator();
+  }
+
+  const storage_type &storage = *m_storage;
+  return storage.begin();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_iterator shared_array_view<T, Alloc>::cbegin() const
+{
+  return begin();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_iterator shared_array_view<T, Alloc>::end() const
+{
+  return begin() + size();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_iterator shared_array_view<T, Alloc>::cend() const
+{
+  return end();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_pointer shared_array_view<T, Alloc>::data() const
+{
+  return begin().base();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::const_reference shared_array_view<T, Alloc>::operator[](size_type n) const
+{
+  return begin()[n];
+}
+
+template<typename T, typename Alloc>
+void shared_array_view<T, Alloc>::detach()
+{
+  if(shared())
+  {
+    const storage_type &source = *m_storage;
+    m_storage = std::make_shared<storage_type>(source);
+  }
+}
+
+template<typename T, typename Alloc>
+template<typename DerivedPolicy>
+void shared_array_view<T, Alloc>::detach(const thrust::detail::execution_policy_base<DerivedPolicy> &exec)
+{
+  if(shared())
+  {
+    const storage_type &source = *m_storage;
+
+    std::shared_ptr<storage_type> clone = std::make_shared<storage_type>(source.get_allocator());
+    clone->assign(exec, source.begin(), source.end());
+
+    m_storage = std::move(clone);
+  }
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::mutable_iterator shared_array_view<T, Alloc>::mutable_begin()
+{
+  detach();
+  return m_storage ? m_storage->begin() : mutable_iterator();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::mutable_iterator shared_array_view<T, Alloc>::mutable_end()
+{
+  return mutable_begin() + size();
+}
+
+template<typename T, typename Alloc>
+typename shared_array_view<T, Alloc>::mutable_pointer shared_array_view<T, Alloc>::mutable_data()
+{
+  return mutable_begin().base();
+}
+
+template<typename T, typename Alloc>
+void shared_array_view<T, Alloc>::reset() noexcept
+{
+  m_storage.reset();
+}
+
+template<typename T, typename Alloc>
+void shared_array_view<T, Alloc>::swap(shared_array_view &other) noexcept
+{
+  m_storage.swap(other.m_storage);
+}
+
+template<typename T, typename Alloc>
+shared_array_view<T, Alloc> make_shared_array_view(thrust::detail::vector_base<T, Alloc> &&v)
+{
+  return shared_array_view<T, Alloc>(std::move(v));
+}
+
+THRUST_NAMESPACE_END
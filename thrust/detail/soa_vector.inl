@@ -0,0 +1,415 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/soa_vector.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/detail/raw_pointer_cast.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector()
+  : soa_vector(Alloc())
+{
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector(const Alloc &alloc)
+  : m_allocator(alloc), m_data(), m_size(0), m_capacity(0)
+{
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector(size_type n, const Alloc &alloc)
+  : soa_vector(n, value_type(), alloc)
+{
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector(size_type n, const value_type &value, const Alloc &alloc)
+  : soa_vector(alloc)
+{
+  resize(n, value);
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector(const soa_vector &other)
+  : m_allocator(other.m_allocator), m_data(), m_size(0), m_capacity(0)
+{
+  *this = other;
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::soa_vector(soa_vector &&other) noexcept
+  : m_allocator(other.m_allocator), m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+{
+  other.m_data     = storage_pointer();
+  other.m_size     = 0;
+  other.m_capacity = 0;
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc>::~soa_vector()
+{
+  deallocate();
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc> &soa_vector<Tuple, Alloc>::operator=(const soa_vector &other)
+{
+  if(this != &other)
+  {
+    if(other.m_size > m_capacity)
+    {
+      // nothing needs to be kept, so allocate the new block without copying
+      m_size = 0;
+      reallocate(other.m_size);
+    }
+
+    if(other.m_size > 0)
+    {
+      thrust::copy(system(), other.begin(), other.end(), begin());
+    }
+    m_size = other.m_size;
+  }
+
+  return *this;
+}
+
+template<typename Tuple, typename Alloc>
+soa_vector<Tuple, Alloc> &soa_vector<Tuple, Alloc>::operator=(soa_vector &&other) noexcept
+{
+  swap(other);
+  return *this;
+}
+
+template<typename Tuple, typename Alloc>
+template<typename InputIterator>
+void soa_vector<Tuple, Alloc>::assign(InputIterator first, InputIterator last)
+{
+  const size_type n = thrust::distance(first, last);
+
+  if(n > m_capacity)
+  {
+    m_size = 0;
+    reallocate(n);
+  }
+
+  thrust::copy(first, last, begin());
+  m_size = n;
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::size_type soa_vector<Tuple, Alloc>::max_size() const
+{
+  // the bytes of one element, including the padding between the columns of
+  // a block holding a single element, which bounds the padding of any block
+  return storage_traits::max_size(m_allocator) / column_offset(num_columns, 1) * unit_size;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::reserve(size_type n)
+{
+  if(n > m_capacity)
+  {
+    reallocate(n);
+  }
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::resize(size_type new_size)
+{
+  resize(new_size, value_type());
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::resize(size_type new_size, const value_type &x)
+{
+  if(new_size > m_size)
+  {
+    grow(new_size);
+
+    // a single pass writes every column of the new elements
+    thrust::fill(system(), begin() + m_size, begin() + new_size, x);
+  }
+
+  m_size = new_size;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::shrink_to_fit()
+{
+  if(m_capacity > m_size)
+  {
+    reallocate(m_size);
+  }
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::push_back(const value_type &x)
+{
+  grow(m_size + 1);
+  begin()[m_size] = x;
+  ++m_size;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::pop_back()
+{
+  --m_size;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::clear()
+{
+  m_size = 0;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::swap(soa_vector &other)
+{
+  using std::swap;
+  swap(m_allocator, other.m_allocator);
+  swap(m_data, other.m_data);
+  swap(m_size, other.m_size);
+  swap(m_capacity, other.m_capacity);
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::allocator_type soa_vector<Tuple, Alloc>::get_allocator() const
+{
+  return allocator_type(m_allocator);
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::iterator soa_vector<Tuple, Alloc>::begin()
+{
+  return begin_in(m_data, m_capacity, column_indices());
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::const_iterator soa_vector<Tuple, Alloc>::begin() const
+{
+  return begin_in(column_indices());
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::const_iterator soa_vector<Tuple, Alloc>::cbegin() const
+{
+  return begin();
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::iterator soa_vector<Tuple, Alloc>::end()
+{
+  return begin() + m_size;
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::const_iterator soa_vector<Tuple, Alloc>::end() const
+{
+  return begin() + m_size;
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::const_iterator soa_vector<Tuple, Alloc>::cend() const
+{
+  return end();
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::reference soa_vector<Tuple, Alloc>::operator[](size_type n)
+{
+  return begin()[n];
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::const_reference soa_vector<Tuple, Alloc>::operator[](size_type n) const
+{
+  return begin()[n];
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t I>
+auto soa_vector<Tuple, Alloc>::column() -> column_pointer<I>
+{
+  return column_in<I>(m_data, m_capacity);
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t I>
+auto soa_vector<Tuple, Alloc>::column() const -> const_column_pointer<I>
+{
+  return column_in<I>(m_data, m_capacity);
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t... I>
+auto soa_vector<Tuple, Alloc>::columns() -> columns_iterator<I...>
+{
+  return thrust::make_zip_iterator(column<I>()...);
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t... I>
+auto soa_vector<Tuple, Alloc>::columns() const -> const_columns_iterator<I...>
+{
+  return thrust::make_zip_iterator(column<I>()...);
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::size_type
+soa_vector<Tuple, Alloc>::column_offset(size_type column, size_type capacity)
+{
+  return column_offset(column, capacity, column_indices());
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t... I>
+typename soa_vector<Tuple, Alloc>::size_type
+soa_vector<Tuple, Alloc>::column_offset(size_type column, size_type capacity, thrust::index_sequence<I...>)
+{
+  const size_type sizes[]      = {sizeof(column_value_type<I>)...};
+  const size_type alignments[] = {alignof(column_value_type<I>)...};
+
+  size_type offset = 0;
+  for(size_type i = 0; i < column; ++i)
+  {
+    offset += capacity * sizes[i];
+
+    // start the next column at its alignment
+    if(i + 1 < num_columns)
+    {
+      offset = (offset + alignments[i + 1] - 1) / alignments[i + 1] * alignments[i + 1];
+    }
+  }
+
+  return offset;
+}
+
+template<typename Tuple, typename Alloc>
+typename soa_vector<Tuple, Alloc>::size_type
+soa_vector<Tuple, Alloc>::block_units(size_type capacity)
+{
+  return (column_offset(num_columns, capacity) + unit_size - 1) / unit_size;
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t I>
+auto soa_vector<Tuple, Alloc>::column_in(storage_pointer data, size_type capacity) -> column_pointer<I>
+{
+  if(capacity == 0)
+  {
+    return column_pointer<I>();
+  }
+
+  unsigned char *raw = reinterpret_cast<unsigned char *>(thrust::raw_pointer_cast(data));
+  return column_pointer<I>(reinterpret_cast<column_value_type<I> *>(raw + column_offset(I, capacity)));
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t... I>
+typename soa_vector<Tuple, Alloc>::iterator
+soa_vector<Tuple, Alloc>::begin_in(storage_pointer data, size_type capacity, thrust::index_sequence<I...>)
+{
+  return thrust::make_zip_iterator(column_in<I>(data, capacity)...);
+}
+
+template<typename Tuple, typename Alloc>
+template<std::size_t... I>
+typename soa_vector<Tuple, Alloc>::const_iterator
+soa_vector<Tuple, Alloc>::begin_in(thrust::index_sequence<I...>) const
+{
+  return thrust::make_zip_iterator(column<I>()...);
+}
+
+template<typename Tuple, typename Alloc>
+typename thrust::detail::allocator_system<typename soa_vector<Tuple, Alloc>::storage_allocator>::get_result_type
+soa_vector<Tuple, Alloc>::system()
+{
+  return thrust::detail::allocator_system<storage_allocator>::get(m_allocator);
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::reallocate(size_type new_capacity)
+{
+  if(new_capacity > max_size())
+  {
+    throw std::length_error("soa_vector: capacity exceeds max_size().");
+  }
+
+  storage_pointer new_data = storage_pointer();
+  if(new_capacity > 0)
+  {
+    new_data = storage_traits::allocate(m_allocator, block_units(new_capacity));
+  }
+
+  if(m_size > 0)
+  {
+    try
+    {
+      thrust::copy(system(), begin(), end(), begin_in(new_data, new_capacity, column_indices()));
+    }
+    catch(...)
+    {
+      storage_traits::deallocate(m_allocator, new_data, block_units(new_capacity));
+      throw;
+    }
+  }
+
+  deallocate();
+  m_data     = new_data;
+  m_capacity = new_capacity;
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::grow(size_type new_size)
+{
+  if(new_size > m_capacity)
+  {
+    if(new_size > max_size())
+    {
+      throw std::length_error("soa_vector: size exceeds max_size().");
+    }
+
+    // at least double the size, as vector_base does
+    size_type new_capacity = (std::max)(new_size, m_size + m_size);
+    reallocate((std::min)(new_capacity, max_size()));
+  }
+}
+
+template<typename Tuple, typename Alloc>
+void soa_vector<Tuple, Alloc>::deallocate()
+{
+  if(m_capacity > 0)
+  {
+    storage_traits::deallocate(m_allocator, m_data, block_units(m_capacity));
+  }
+
+  m_data     = storage_pointer();
+  m_capacity = 0;
+}
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,189 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+namespace stream_pipeline_detail
+{
+
+// a buffer handed from one stage to the next, with the number of valid
+// elements in it
+struct batch
+{
+  std::size_t buffer;
+  std::size_t size;
+};
+
+
+// the first exception thrown by any of the stages
+class pipeline_error
+{
+  typedef std::lock_guard<std::mutex> lock_t;
+
+public:
+  pipeline_error()
+    : m_error()
+  {}
+
+  void set(std::exception_ptr error)
+  {
+    lock_t lock(m_mutex);
+
+    if(!m_error)
+    {
+      m_error = error;
+    }
+  }
+
+  void rethrow()
+  {
+    if(m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+private:
+  std::mutex         m_mutex;
+  std::exception_ptr m_error;
+};
+
+
+// an unbounded FIFO of batches between two stages. The number of buffers
+// bounds its length. pop blocks until a batch arrives, and returns false once
+// the queue is closed and empty or the pipeline is aborted
+class batch_queue
+{
+  typedef std::unique_lock<std::mutex> lock_t;
+
+public:
+  batch_queue()
+    : m_batches(), m_closed(false), m_aborted(false)
+  {}
+
+  batch_queue(const batch_queue &) = delete;
+  batch_queue &operator=(const batch_queue &) = delete;
+
+  void push(batch b)
+  {
+    {
+      lock_t lock(m_mutex);
+      m_batches.push_back(b);
+    }
+    m_ready.notify_one();
+  }
+
+  bool pop(batch &b)
+  {
+    lock_t lock(m_mutex);
+    m_ready.wait(lock, [this] { return m_aborted || m_closed || !m_batches.empty(); });
+
+    if(m_aborted || m_batches.empty())
+    {
+      return false;
+    }
+
+    b = m_batches.front();
+    m_batches.pop_front();
+    return true;
+  }
+
+  // no more batches will be pushed
+  void close()
+  {
+    {
+      lock_t lock(m_mutex);
+      m_closed = true;
+    }
+    m_ready.notify_all();
+  }
+
+  // wakes up all waiters and makes pop fail from now on
+  void abort()
+  {
+    {
+      lock_t lock(m_mutex);
+      m_aborted = true;
+    }
+    m_ready.notify_all();
+  }
+
+private:
+  std::mutex              m_mutex;
+  std::condition_variable m_ready;
+  std::deque<batch>       m_batches;
+  bool                    m_closed;
+  bool                    m_aborted;
+};
+
+
+// accumulates the time spent in the calls of one stage
+class stage_timer
+{
+  typedef std::chrono::steady_clock clock;
+
+public:
+  stage_timer()
+    : m_seconds(0)
+  {}
+
+  template<typename Function>
+  auto operator()(Function f) -> decltype(f())
+  {
+    const clock::time_point start = clock::now();
+
+    struct record
+    {
+      ~record()
+      {
+        *seconds += std::chrono::duration<double>(clock::now() - start).count();
+      }
+
+      double           *seconds;
+      clock::time_point start;
+    } r = {&m_seconds, start};
+
+    return f();
+  }
+
+  double seconds() const
+  {
+    return m_seconds;
+  }
+
+private:
+  double m_seconds;
+};
+
+} // end stream_pipeline_detail
+
+} // end detail
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,227 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/stream_pipeline.h>
+#include <thrust/mr/new.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+namespace stream_pipeline_detail
+{
+
+// the buffers of one pipeline, allocated together when it starts and
+// returned to the resource when it ends
+template<typename T>
+class buffer_set
+{
+public:
+  buffer_set(thrust::mr::memory_resource<> *resource, std::size_t num_buffers, std::size_t capacity)
+    : m_resource(resource), m_buffers(), m_bytes(capacity * sizeof(T))
+  {
+    m_buffers.reserve(num_buffers);
+
+    try
+    {
+      for(std::size_t i = 0; i < num_buffers; ++i)
+      {
+        m_buffers.push_back(static_cast<T *>(m_resource->allocate(m_bytes, alignof(T))));
+      }
+    }
+    catch(...)
+    {
+      release();
+      throw;
+    }
+  }
+
+  buffer_set(const buffer_set &) = delete;
+  buffer_set &operator=(const buffer_set &) = delete;
+
+  ~buffer_set()
+  {
+    release();
+  }
+
+  T *operator[](std::size_t i) const
+  {
+    return m_buffers[i];
+  }
+
+private:
+  void release()
+  {
+    for(T *buffer : m_buffers)
+    {
+      m_resource->deallocate(buffer, m_bytes, alignof(T));
+    }
+    m_buffers.clear();
+  }
+
+  thrust::mr::memory_resource<> *m_resource;
+  std::vector<T *>               m_buffers;
+  std::size_t                    m_bytes;
+};
+
+} // end stream_pipeline_detail
+
+} // end detail
+
+
+template<typename T, typename DerivedPolicy, typename Source, typename Compute, typename Sink>
+stream_pipeline_statistics stream_pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                           Source source,
+                                           Compute compute,
+                                           Sink sink,
+                                           const stream_pipeline_options &options)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "stream_pipeline requires trivially copyable elements");
+
+  using namespace thrust::detail::stream_pipeline_detail;
+
+  typedef std::chrono::steady_clock clock;
+
+  const clock::time_point start = clock::now();
+
+  const std::size_t capacity    = (std::max)(options.batch_size, std::size_t(1));
+  const std::size_t num_buffers = (std::max)(options.num_buffers, std::size_t(1));
+
+  thrust::mr::memory_resource<> *resource = options.resource;
+  if(resource == nullptr)
+  {
+    resource = thrust::mr::get_global_resource<thrust::mr::new_delete_resource>();
+  }
+
+  buffer_set<T> buffers(resource, num_buffers, capacity);
+
+  // free buffers go to the ingest stage, ingested batches to the compute
+  // stage and computed batches to the drain stage, which frees them again
+  batch_queue free, ingested, computed;
+  for(std::size_t i = 0; i < num_buffers; ++i)
+  {
+    free.push(batch{i, 0});
+  }
+
+  pipeline_error error;
+  stage_timer    ingest_timer, compute_timer, drain_timer;
+
+  stream_pipeline_statistics statistics;
+
+  // stops every stage after a failure; stages blocked in pop wake up and
+  // return
+  auto abort = [&](std::exception_ptr e)
+  {
+    error.set(e);
+    free.abort();
+    ingested.abort();
+    computed.abort();
+  };
+
+  std::thread ingest_thread([&]
+  {
+    try
+    {
+      batch b;
+      while(free.pop(b))
+      {
+        T *buffer = buffers[b.buffer];
+
+        const std::size_t n = ingest_timer([&] { return source(buffer, capacity); });
+        if(n == 0)
+        {
+          break;
+        }
+
+        statistics.num_elements += n;
+        ingested.push(batch{b.buffer, n});
+      }
+    }
+    catch(...)
+    {
+      abort(std::current_exception());
+    }
+
+    ingested.close();
+  });
+
+  std::thread drain_thread([&]
+  {
+    try
+    {
+      batch b;
+      while(computed.pop(b))
+      {
+        const T *data = buffers[b.buffer];
+
+        drain_timer([&] { sink(data, b.size); });
+
+        statistics.num_drained += b.size;
+        free.push(batch{b.buffer, 0});
+      }
+    }
+    catch(...)
+    {
+      abort(std::current_exception());
+    }
+  });
+
+  try
+  {
+    batch b;
+    while(ingested.pop(b))
+    {
+      T *first = buffers[b.buffer];
+      T *last  = first + b.size;
+
+      T *result = compute_timer([&] { return compute(thrust::detail::derived_cast(exec), first, last); });
+
+      ++statistics.num_batches;
+      computed.push(batch{b.buffer, static_cast<std::size_t>(result - first)});
+    }
+  }
+  catch(...)
+  {
+    abort(std::current_exception());
+  }
+
+  computed.close();
+
+  ingest_thread.join();
+  drain_thread.join();
+
+  error.rethrow();
+
+  statistics.ingest_seconds  = ingest_timer.seconds();
+  statistics.compute_seconds = compute_timer.seconds();
+  statistics.drain_seconds   = drain_timer.seconds();
+  statistics.elapsed_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+  return statistics;
+}
+
+THRUST_NAMESPACE_END
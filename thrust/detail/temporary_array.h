@@ -40,19 +40,154 @@ THRUST_NAMESPACE_END
 #include <thrust/detail/contiguous_storage.h>
 #include <thrust/detail/allocator/temporary_allocator.h>
 #include <thrust/detail/allocator/no_throw_allocator.h>
+#include <thrust/detail/alignment.h>
 #include <thrust/detail/memory_wrapper.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+
+#include <cstddef>
+
+// The number of bytes of the inline buffer which temporary arrays of host
+// systems use instead of allocating when the array fits in it. 0 disables
+// the inline buffer.
+#ifndef THRUST_TEMPORARY_ARRAY_INLINE_BYTES
+#define THRUST_TEMPORARY_ARRAY_INLINE_BYTES 2048
+#endif
 
 THRUST_NAMESPACE_BEGIN
 namespace detail
 {
 
 
+namespace temporary_array_detail
+{
+
+
+// temporary arrays of the cpp system and the systems derived from it, i.e.
+// omp and tbb, keep small arrays in an inline buffer. Device code never uses
+// these systems, so the buffer never lands on a device stack
+template<typename T, typename System>
+  struct has_inline_buffer
+    : integral_constant<
+        bool,
+        (THRUST_TEMPORARY_ARRAY_INLINE_BYTES > 0) &&
+        (THRUST_ALIGNOF(T) <= THRUST_ALIGNOF(thrust::detail::max_align_t)) &&
+        is_base_of<thrust::system::cpp::detail::execution_policy<System>, System>::value
+      >
+{};
+
+
+template<typename T, typename System, bool = has_inline_buffer<T,System>::value>
+  class inline_buffer
+{
+  public:
+    __host__ __device__
+    inline_buffer() : m_in_use(false) {}
+
+    // returns the buffer if n elements fit and it is not in use, else null
+    __host__ __device__
+    T *acquire(std::size_t n)
+    {
+      if(m_in_use || n > capacity)
+      {
+        return 0;
+      }
+
+      m_in_use = true;
+      return reinterpret_cast<T*>(&m_storage);
+    }
+
+    // returns whether p is the buffer
+    __host__ __device__
+    bool release(T *p)
+    {
+      if(p != reinterpret_cast<T*>(&m_storage))
+      {
+        return false;
+      }
+
+      m_in_use = false;
+      return true;
+    }
+
+  private:
+    static const std::size_t capacity = THRUST_TEMPORARY_ARRAY_INLINE_BYTES / sizeof(T);
+
+    bool m_in_use;
+    typename thrust::detail::aligned_storage<
+      THRUST_TEMPORARY_ARRAY_INLINE_BYTES,
+      THRUST_ALIGNOF(thrust::detail::max_align_t)
+    >::type m_storage;
+};
+
+
+template<typename T, typename System>
+  class inline_buffer<T,System,false>
+{
+  public:
+    __host__ __device__
+    T *acquire(std::size_t) { return 0; }
+
+    __host__ __device__
+    bool release(T *) { return false; }
+};
+
+
+// a temporary_allocator which first tries the inline buffer of its array
+template<typename T, typename System>
+  class inline_temporary_allocator
+    : public temporary_allocator<T,System>
+{
+  private:
+    typedef temporary_allocator<T,System> super_t;
+
+    inline_buffer<T,System> *m_buffer;
+
+  public:
+    typedef typename super_t::pointer   pointer;
+    typedef typename super_t::size_type size_type;
+
+    inline __host__ __device__
+    inline_temporary_allocator(thrust::execution_policy<System> &system,
+                               inline_buffer<T,System> *buffer)
+      : super_t(system),
+        m_buffer(buffer)
+    {}
+
+    __host__ __device__
+    pointer allocate(size_type cnt)
+    {
+      if(T *p = m_buffer->acquire(cnt))
+      {
+        return pointer(p);
+      }
+
+      return super_t::allocate(cnt);
+    }
+
+    __host__ __device__
+    void deallocate(pointer p, size_type n)
+    {
+      if(!m_buffer->release(thrust::raw_pointer_cast(p)))
+      {
+        super_t::deallocate(p, n);
+      }
+    }
+};
+
+
+} // end temporary_array_detail
+
+
+// the inline buffer is the first base, so that it is constructed before the
+// storage allocates from it and destroyed after the storage returns it
 template<typename T, typename System>
   class temporary_array
-    : public contiguous_storage<
+    : private temporary_array_detail::inline_buffer<T,System>,
+      public contiguous_storage<
                T,
                no_throw_allocator<
-                 temporary_allocator<T,System>
+                 temporary_array_detail::inline_temporary_allocator<T,System>
                >
              >
 {
@@ -60,12 +195,20 @@ template<typename T, typename System>
     typedef contiguous_storage<
       T,
       no_throw_allocator<
-        temporary_allocator<T,System>
+        temporary_array_detail::inline_temporary_allocator<T,System>
       >
     > super_t;
 
+    typedef temporary_array_detail::inline_buffer<T,System> buffer_type;
+
     // to help out the constructor
-    typedef no_throw_allocator<temporary_allocator<T,System> > alloc_type;
+    typedef no_throw_allocator<temporary_array_detail::inline_temporary_allocator<T,System> > alloc_type;
+
+    __host__ __device__
+    static alloc_type make_allocator(thrust::execution_policy<System> &system, buffer_type *buffer)
+    {
+      return alloc_type(temporary_array_detail::inline_temporary_allocator<T,System>(system, buffer));
+    }
 
   public:
     typedef typename super_t::size_type size_type;
@@ -108,6 +251,12 @@ template<typename T, typename System>
 
     __host__ __device__
     ~temporary_array();
+
+    // the storage may live in the inline buffer of this array, which swapping
+    // would hand to another array while its allocator keeps releasing into
+    // this one
+    __host__ __device__
+    void swap(temporary_array &) = delete;
 }; // end temporary_array
 
 
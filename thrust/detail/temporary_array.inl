@@ -65,7 +65,7 @@ template<typename T, typename System>
 __host__ __device__
   temporary_array<T,System>
     ::temporary_array(thrust::execution_policy<System> &system)
-      :super_t(alloc_type(temporary_allocator<T,System>(system)))
+      :super_t(make_allocator(system, static_cast<buffer_type*>(this)))
 {
 } // end temporary_array::temporary_array()
 
@@ -74,7 +74,7 @@ template<typename T, typename System>
 __host__ __device__
   temporary_array<T,System>
     ::temporary_array(thrust::execution_policy<System> &system, size_type n)
-      :super_t(n, alloc_type(temporary_allocator<T,System>(system)))
+      :super_t(n, make_allocator(system, static_cast<buffer_type*>(this)))
 {
   temporary_array_detail::construct_values<T>(*this, n);
 } // end temporary_array::temporary_array()
@@ -84,7 +84,7 @@ template<typename T, typename System>
 __host__ __device__
   temporary_array<T,System>
     ::temporary_array(int, thrust::execution_policy<System> &system, size_type n)
-      :super_t(n, alloc_type(temporary_allocator<T,System>(system)))
+      :super_t(n, make_allocator(system, static_cast<buffer_type*>(this)))
 {
   // avoid initialization
   ;
@@ -98,7 +98,7 @@ template<typename T, typename System>
       ::temporary_array(thrust::execution_policy<System> &system,
                         InputIterator first,
                         size_type n)
-        : super_t(alloc_type(temporary_allocator<T,System>(system)))
+        : super_t(make_allocator(system, static_cast<buffer_type*>(this)))
 {
   super_t::allocate(n);
 
@@ -114,7 +114,7 @@ template<typename T, typename System>
                         thrust::execution_policy<InputSystem> &input_system,
                         InputIterator first,
                         size_type n)
-        : super_t(alloc_type(temporary_allocator<T,System>(system)))
+        : super_t(make_allocator(system, static_cast<buffer_type*>(this)))
 {
   super_t::allocate(n);
 
@@ -129,7 +129,7 @@ template<typename T, typename System>
       ::temporary_array(thrust::execution_policy<System> &system,
                         InputIterator first,
                         InputIterator last)
-        : super_t(alloc_type(temporary_allocator<T,System>(system)))
+        : super_t(make_allocator(system, static_cast<buffer_type*>(this)))
 {
   super_t::allocate(thrust::distance(first,last));
 
@@ -145,7 +145,7 @@ template<typename T, typename System>
                         thrust::execution_policy<InputSystem> &input_system,
                         InputIterator first,
                         InputIterator last)
-        : super_t(alloc_type(temporary_allocator<T,System>(system)))
+        : super_t(make_allocator(system, static_cast<buffer_type*>(this)))
 {
   super_t::allocate(thrust::distance(first,last));
 
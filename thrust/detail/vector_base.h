@@ -28,6 +28,8 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/config.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/iterator/detail/any_system_tag.h>
 #include <vector>
 
 THRUST_NAMESPACE_BEGIN
@@ -35,6 +37,39 @@ THRUST_NAMESPACE_BEGIN
 namespace detail
 {
 
+namespace vector_base_detail
+{
+
+// the allocator constructs elements itself if it has a construct() member, except
+// for std::allocator, whose construct() only invokes T's constructor
+template<typename Alloc, typename T>
+  struct constructs_via_allocator
+    : or_<
+        allocator_traits_detail::has_member_construct1<Alloc,T>,
+        allocator_traits_detail::has_member_construct2<Alloc,T,T>
+      >
+{};
+
+template<typename U, typename T>
+  struct constructs_via_allocator<std::allocator<U>, T>
+    : false_type
+{};
+
+// an execution policy may perform bulk operations on the elements of a vector_base
+// in place of the allocator's system if it can access both the storage and the
+// input range, and the allocator does not construct elements itself
+template<typename Executor, typename T, typename Alloc, typename InputSystem>
+  struct executor_applies
+    : integral_constant<
+        bool,
+        is_convertible<Executor, typename allocator_system<Alloc>::type>::value &&
+        (is_convertible<Executor, InputSystem>::value || is_same<InputSystem, thrust::any_system_tag>::value) &&
+        !constructs_via_allocator<Alloc,T>::value
+      >
+{};
+
+} // end vector_base_detail
+
 template<typename T, typename Alloc>
   class vector_base
 {
@@ -177,6 +212,47 @@ template<typename T, typename Alloc>
     template<typename InputIterator>
     vector_base(InputIterator first, InputIterator last, const Alloc &alloc);
 
+    /*! This constructor creates a vector_base with default-constructed
+     *  elements, constructing them with the given execution policy.
+     *  \param exec The execution policy to use for constructing the elements.
+     *  \param n The number of elements to create.
+     *
+     *  Bulk operations on the elements fall back to the system of the allocator
+     *  if \p exec cannot access the storage, or if the allocator constructs
+     *  elements with its own \c construct member.
+     */
+    template<typename DerivedPolicy>
+    vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n);
+
+    /*! This constructor creates a vector_base with copies of an exemplar
+     *  element, constructing them with the given execution policy.
+     *  \param exec The execution policy to use for constructing the elements.
+     *  \param n The number of elements to initially create.
+     *  \param value An element to copy.
+     */
+    template<typename DerivedPolicy>
+    vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n, const value_type &value);
+
+    /*! This constructor builds a vector_base from a range, copying it with
+     *  the given execution policy.
+     *  \param exec The execution policy to use for copying the range.
+     *  \param first The beginning of the range.
+     *  \param last The end of the range.
+     *
+     *  The range is copied with \p exec only if \p exec can access it;
+     *  otherwise it is transferred as if no policy was given.
+     */
+    template<typename DerivedPolicy, typename InputIterator>
+    vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last);
+
+    /*! Copy constructor copies from an exemplar vector_base with different
+     *  type with the given execution policy.
+     *  \param exec The execution policy to use for copying.
+     *  \param v The vector_base to copy.
+     */
+    template<typename DerivedPolicy, typename OtherT, typename OtherAlloc>
+    vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, const vector_base<OtherT, OtherAlloc> &v);
+
     /*! The destructor erases the elements.
      */
     ~vector_base(void);
@@ -204,6 +280,25 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements,
+     *  constructing new elements with the given execution policy.
+     *  \param exec The execution policy to use for constructing new elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     */
+    template<typename DerivedPolicy>
+    void resize(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type new_size);
+
+    /*! \brief Resizes this vector_base to the specified number of elements,
+     *  populating new elements with the given execution policy.
+     *  \param exec The execution policy to use for populating new elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \param x Data with which new elements should be populated.
+     *  \throw std::length_error If n exceeds max_size().
+     */
+    template<typename DerivedPolicy>
+    void resize(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type new_size, const value_type &x);
+
     /*! Returns the number of elements in this vector_base.
      */
     size_type size(void) const;
@@ -443,6 +538,44 @@ template<typename T, typename Alloc>
     template<typename InputIterator>
     void assign(InputIterator first, InputIterator last);
 
+    /*! This method inserts a copy of an exemplar value to a range at the
+     *  specified position in this vector_base, with the given execution policy.
+     *  \param exec The execution policy to use for moving and constructing elements.
+     *  \param position The insertion position
+     *  \param n The number of insertions to perform.
+     *  \param x The value to replicate and insert.
+     */
+    template<typename DerivedPolicy>
+    void insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, iterator position, size_type n, const T &x);
+
+    /*! This method inserts a copy of an input range at the specified position
+     *  in this vector_base, with the given execution policy.
+     *  \param exec The execution policy to use for copying the range.
+     *  \param position The insertion position.
+     *  \param first The beginning of the range to copy.
+     *  \param last  The end of the range to copy.
+     */
+    template<typename DerivedPolicy, typename InputIterator>
+    void insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, iterator position, InputIterator first, InputIterator last);
+
+    /*! This version of \p assign replicates a given exemplar
+     *  \p n times into this vector_base, with the given execution policy.
+     *  \param exec The execution policy to use for filling the elements.
+     *  \param n The number of times to copy \p x.
+     *  \param x The exemplar element to replicate.
+     */
+    template<typename DerivedPolicy>
+    void assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n, const T &x);
+
+    /*! This version of \p assign makes this vector_base a copy of a given input range,
+     *  copied with the given execution policy.
+     *  \param exec The execution policy to use for copying the range.
+     *  \param first The beginning of the range to copy.
+     *  \param last  The end of the range to copy.
+     */
+    template<typename DerivedPolicy, typename InputIterator>
+    void assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last);
+
     /*! This method returns a copy of this vector's allocator.
      *  \return A copy of the alloctor used by this vector.
      */
@@ -456,72 +589,133 @@ template<typename T, typename Alloc>
     size_type m_size;
 
   private:
+    // the executor of bulk operations on elements when no execution policy is given: they are
+    // dispatched on the systems of the iterators involved and of the allocator
+    struct default_executor {};
+
     // these methods resolve the ambiguity of the constructor template of form (Iterator, Iterator)
-    template<typename IteratorOrIntegralType>
-      void init_dispatch(IteratorOrIntegralType begin, IteratorOrIntegralType end, false_type);
+    template<typename Executor, typename IteratorOrIntegralType>
+      void init_dispatch(const Executor &exec, IteratorOrIntegralType begin, IteratorOrIntegralType end, false_type);
 
-    template<typename IteratorOrIntegralType>
-      void init_dispatch(IteratorOrIntegralType n, IteratorOrIntegralType value, true_type);
+    template<typename Executor, typename IteratorOrIntegralType>
+      void init_dispatch(const Executor &exec, IteratorOrIntegralType n, IteratorOrIntegralType value, true_type);
 
-    template<typename InputIterator>
-      void range_init(InputIterator first, InputIterator last);
+    template<typename Executor, typename InputIterator>
+      void range_init(const Executor &exec, InputIterator first, InputIterator last);
 
-    template<typename InputIterator>
-      void range_init(InputIterator first, InputIterator last, thrust::incrementable_traversal_tag);
+    template<typename Executor, typename InputIterator>
+      void range_init(const Executor &exec, InputIterator first, InputIterator last, thrust::incrementable_traversal_tag);
 
-    template<typename ForwardIterator>
-      void range_init(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
+    template<typename Executor, typename ForwardIterator>
+      void range_init(const Executor &exec, ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
 
-    void default_init(size_type n);
+    template<typename Executor>
+      void default_init(const Executor &exec, size_type n);
 
-    void fill_init(size_type n, const T &x);
+    template<typename Executor>
+      void fill_init(const Executor &exec, size_type n, const T &x);
 
     // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
-    template<typename InputIteratorOrIntegralType>
-      void insert_dispatch(iterator position, InputIteratorOrIntegralType first, InputIteratorOrIntegralType last, false_type);
+    template<typename Executor, typename InputIteratorOrIntegralType>
+      void insert_dispatch(const Executor &exec, iterator position, InputIteratorOrIntegralType first, InputIteratorOrIntegralType last, false_type);
 
     // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
-    template<typename InputIteratorOrIntegralType>
-      void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
+    template<typename Executor, typename InputIteratorOrIntegralType>
+      void insert_dispatch(const Executor &exec, iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
     // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    template<typename Executor>
+      void append(const Executor &exec, size_type n);
 
     // this method performs insertion from a fill value
-    void fill_insert(iterator position, size_type n, const T &x);
+    template<typename Executor>
+      void fill_insert(const Executor &exec, iterator position, size_type n, const T &x);
 
     // this method performs insertion from a range
-    template<typename InputIterator>
-      void copy_insert(iterator position, InputIterator first, InputIterator last);
+    template<typename Executor, typename InputIterator>
+      void copy_insert(const Executor &exec, iterator position, InputIterator first, InputIterator last);
 
     // these methods resolve the ambiguity of the assign() template of form (InputIterator, InputIterator)
-    template<typename InputIterator>
-      void assign_dispatch(InputIterator first, InputIterator last, false_type);
+    template<typename Executor, typename InputIterator>
+      void assign_dispatch(const Executor &exec, InputIterator first, InputIterator last, false_type);
 
     // these methods resolve the ambiguity of the assign() template of form (InputIterator, InputIterator)
-    template<typename Integral>
-      void assign_dispatch(Integral n, Integral x, true_type);
+    template<typename Executor, typename Integral>
+      void assign_dispatch(const Executor &exec, Integral n, Integral x, true_type);
 
     // this method performs assignment from a range
-    template<typename InputIterator>
-      void range_assign(InputIterator first, InputIterator last);
+    template<typename Executor, typename InputIterator>
+      void range_assign(const Executor &exec, InputIterator first, InputIterator last);
 
     // this method performs assignment from a range of RandomAccessIterators
-    template<typename RandomAccessIterator>
-      void range_assign(RandomAccessIterator first, RandomAccessIterator last, thrust::random_access_traversal_tag);
+    template<typename Executor, typename RandomAccessIterator>
+      void range_assign(const Executor &exec, RandomAccessIterator first, RandomAccessIterator last, thrust::random_access_traversal_tag);
 
     // this method performs assignment from a range of InputIterators
-    template<typename InputIterator>
-      void range_assign(InputIterator first, InputIterator last, thrust::incrementable_traversal_tag);
+    template<typename Executor, typename InputIterator>
+      void range_assign(const Executor &exec, InputIterator first, InputIterator last, thrust::incrementable_traversal_tag);
 
     // this method performs assignment from a fill value
-    void fill_assign(size_type n, const T &x);
+    template<typename Executor>
+      void fill_assign(const Executor &exec, size_type n, const T &x);
 
     // this method allocates new storage and construct copies the given range
-    template<typename ForwardIterator>
-    void allocate_and_copy(size_type requested_size,
+    template<typename Executor, typename ForwardIterator>
+    void allocate_and_copy(const Executor &exec,
+                           size_type requested_size,
                            ForwardIterator first, ForwardIterator last,
                            storage_type &new_storage);
+
+    // this method computes the capacity of storage replacing the current storage
+    // which has to hold required elements, according to the allocator's growth policy
+    size_type grown_capacity(size_type required) const;
+
+    // these methods perform the bulk operations on elements, with the executor if it applies to
+    // the input system, and as if no execution policy was given otherwise
+    template<typename Executor, typename InputIterator>
+      iterator bulk_uninitialized_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result);
+
+    template<typename Executor, typename InputIterator>
+      iterator bulk_uninitialized_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result, true_type);
+
+    template<typename Executor, typename InputIterator>
+      iterator bulk_uninitialized_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result, false_type);
+
+    template<typename Executor>
+      void bulk_uninitialized_fill_n(const Executor &exec, iterator first, size_type n, const T &x);
+
+    template<typename Executor>
+      void bulk_uninitialized_fill_n(const Executor &exec, iterator first, size_type n, const T &x, true_type);
+
+    template<typename Executor>
+      void bulk_uninitialized_fill_n(const Executor &exec, iterator first, size_type n, const T &x, false_type);
+
+    template<typename Executor>
+      void bulk_default_construct_n(const Executor &exec, iterator first, size_type n);
+
+    template<typename Executor>
+      void bulk_default_construct_n(const Executor &exec, iterator first, size_type n, true_type);
+
+    template<typename Executor>
+      void bulk_default_construct_n(const Executor &exec, iterator first, size_type n, false_type);
+
+    template<typename Executor, typename InputIterator>
+      iterator bulk_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result);
+
+    template<typename Executor, typename InputIterator>
+      iterator bulk_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result, true_type);
+
+    template<typename Executor, typename InputIterator>
+      iterator bulk_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result, false_type);
+
+    template<typename Executor>
+      iterator bulk_fill_n(const Executor &exec, iterator first, size_type n, const T &x);
+
+    template<typename Executor>
+      iterator bulk_fill_n(const Executor &exec, iterator first, size_type n, const T &x, true_type);
+
+    template<typename Executor>
+      iterator bulk_fill_n(const Executor &exec, iterator first, size_type n, const T &x, false_type);
 }; // end vector_base
 
 } // end detail
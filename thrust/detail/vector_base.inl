@@ -27,6 +27,9 @@
 #include <thrust/detail/minmax.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/fill.h>
+#include <thrust/uninitialized_copy.h>
+#include <thrust/uninitialized_fill.h>
 
 #include <stdexcept>
 
@@ -59,7 +62,7 @@ template<typename T, typename Alloc>
       :m_storage(),
        m_size(0)
 {
-  default_init(n);
+  default_init(default_executor(), n);
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -68,7 +71,7 @@ template<typename T, typename Alloc>
       :m_storage(alloc),
        m_size(0)
 {
-  default_init(n);
+  default_init(default_executor(), n);
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -77,7 +80,7 @@ template<typename T, typename Alloc>
       :m_storage(),
        m_size(0)
 {
-  fill_init(n,value);
+  fill_init(default_executor(), n, value);
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -86,7 +89,7 @@ template<typename T, typename Alloc>
       :m_storage(alloc),
        m_size(0)
 {
-  fill_init(n,value);
+  fill_init(default_executor(), n, value);
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -95,7 +98,7 @@ template<typename T, typename Alloc>
       :m_storage(copy_allocator_t(), v.m_storage),
        m_size(0)
 {
-  range_init(v.begin(), v.end());
+  range_init(default_executor(), v.begin(), v.end());
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -104,7 +107,7 @@ template<typename T, typename Alloc>
       :m_storage(alloc),
        m_size(0)
 {
-  range_init(v.begin(), v.end());
+  range_init(default_executor(), v.begin(), v.end());
 } // end vector_base::vector_base()
 
 #if THRUST_CPP_DIALECT >= 2011
@@ -160,7 +163,7 @@ template<typename T, typename Alloc>
         :m_storage(),
          m_size(0)
 {
-  range_init(v.begin(), v.end());
+  range_init(default_executor(), v.begin(), v.end());
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -181,7 +184,7 @@ template<typename T, typename Alloc>
         :m_storage(),
          m_size(0)
 {
-  range_init(v.begin(), v.end());
+  range_init(default_executor(), v.begin(), v.end());
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -196,65 +199,71 @@ template<typename T, typename Alloc>
 } // end vector_base::operator=()
 
 template<typename T, typename Alloc>
-  template<typename IteratorOrIntegralType>
+  template<typename Executor, typename IteratorOrIntegralType>
     void vector_base<T,Alloc>
-      ::init_dispatch(IteratorOrIntegralType n,
+      ::init_dispatch(const Executor &exec,
+                      IteratorOrIntegralType n,
                       IteratorOrIntegralType value,
                       true_type)
 {
-  fill_init(n,value);
+  fill_init(exec, n, value);
 } // end vector_base::init_dispatch()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::default_init(size_type n)
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::default_init(const Executor &exec, size_type n)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.default_construct_n(begin(), size());
+    bulk_default_construct_n(exec, begin(), size());
   } // end if
 } // end vector_base::default_init()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::fill_init(size_type n, const T &x)
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::fill_init(const Executor &exec, size_type n, const T &x)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.uninitialized_fill_n(begin(), size(), x);
+    bulk_uninitialized_fill_n(exec, begin(), size(), x);
   } // end if
 } // end vector_base::fill_init()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::init_dispatch(InputIterator first,
+      ::init_dispatch(const Executor &exec,
+                      InputIterator first,
                       InputIterator last,
                       false_type)
 {
-  range_init(first, last);
+  range_init(exec, first, last);
 } // end vector_base::init_dispatch()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::range_init(InputIterator first,
+      ::range_init(const Executor &exec,
+                   InputIterator first,
                    InputIterator last)
 {
-  range_init(first, last,
+  range_init(exec, first, last,
     typename thrust::iterator_traversal<InputIterator>::type());
 } // end vector_base::range_init()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::range_init(InputIterator first,
+      ::range_init(const Executor &,
+                   InputIterator first,
                    InputIterator last,
                    thrust::incrementable_traversal_tag)
 {
@@ -263,15 +272,16 @@ template<typename T, typename Alloc>
 } // end vector_base::range_init()
 
 template<typename T, typename Alloc>
-  template<typename ForwardIterator>
+  template<typename Executor, typename ForwardIterator>
     void vector_base<T,Alloc>
-      ::range_init(ForwardIterator first,
+      ::range_init(const Executor &exec,
+                   ForwardIterator first,
                    ForwardIterator last,
                    thrust::random_access_traversal_tag)
 {
   size_type new_size = thrust::distance(first, last);
 
-  allocate_and_copy(new_size, first, last, m_storage);
+  allocate_and_copy(exec, new_size, first, last, m_storage);
   m_size    = new_size;
 } // end vector_base::range_init()
 
@@ -287,7 +297,7 @@ template<typename T, typename Alloc>
   // we need to interpret this call as (size_type, value_type)
   typedef thrust::detail::is_integral<InputIterator> Integer;
 
-  init_dispatch(first, last, Integer());
+  init_dispatch(default_executor(), first, last, Integer());
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -303,7 +313,57 @@ template<typename T, typename Alloc>
   // we need to interpret this call as (size_type, value_type)
   typedef thrust::detail::is_integral<InputIterator> Integer;
 
-  init_dispatch(first, last, Integer());
+  init_dispatch(default_executor(), first, last, Integer());
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy>
+    vector_base<T,Alloc>
+      ::vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    size_type n)
+        :m_storage(),
+         m_size(0)
+{
+  default_init(thrust::detail::derived_cast(exec), n);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy>
+    vector_base<T,Alloc>
+      ::vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    size_type n,
+                    const value_type &value)
+        :m_storage(),
+         m_size(0)
+{
+  fill_init(thrust::detail::derived_cast(exec), n, value);
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy, typename InputIterator>
+    vector_base<T,Alloc>
+      ::vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    InputIterator first,
+                    InputIterator last)
+        :m_storage(),
+         m_size(0)
+{
+  // check the type of InputIterator: if it's an integral type,
+  // we need to interpret this call as (exec, size_type, value_type)
+  typedef thrust::detail::is_integral<InputIterator> Integer;
+
+  init_dispatch(thrust::detail::derived_cast(exec), first, last, Integer());
+} // end vector_base::vector_base()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy, typename OtherT, typename OtherAlloc>
+    vector_base<T,Alloc>
+      ::vector_base(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    const vector_base<OtherT,OtherAlloc> &v)
+        :m_storage(),
+         m_size(0)
+{
+  range_init(thrust::detail::derived_cast(exec), v.begin(), v.end());
 } // end vector_base::vector_base()
 
 template<typename T, typename Alloc>
@@ -318,7 +378,7 @@ template<typename T, typename Alloc>
   } // end if
   else
   {
-    append(new_size - size());
+    append(default_executor(), new_size - size());
   } // end else
 } // end vector_base::resize()
 
@@ -338,6 +398,43 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy>
+    void vector_base<T,Alloc>
+      ::resize(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               size_type new_size)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(thrust::detail::derived_cast(exec), new_size - size());
+  } // end else
+} // end vector_base::resize()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy>
+    void vector_base<T,Alloc>
+      ::resize(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               size_type new_size,
+               const value_type &x)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    fill_insert(thrust::detail::derived_cast(exec), end(), new_size - size(), x);
+  } // end else
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   typename vector_base<T,Alloc>::size_type
     vector_base<T,Alloc>
@@ -366,6 +463,12 @@ template<typename T, typename Alloc>
     // do not exceed maximum storage
     new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
 
+    // grow the storage in place if the allocator is able to
+    if(m_storage.try_expand(new_capacity))
+    {
+      return;
+    } // end if
+
     // create new storage
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -407,6 +510,17 @@ template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::shrink_to_fit(void)
 {
+  if(capacity() == size())
+  {
+    return;
+  } // end if
+
+  // shrink the storage in place if the allocator is able to
+  if(size() > 0 && m_storage.try_expand(size()))
+  {
+    return;
+  } // end if
+
   // use the swap trick
   vector_base(*this).swap(*this);
 } // end vector_base::shrink_to_fit()
@@ -660,7 +774,7 @@ template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::assign(size_type n, const T &x)
 {
-  fill_assign(n, x);
+  fill_assign(default_executor(), n, x);
 } // end vector_base::assign()
 
 template<typename T, typename Alloc>
@@ -672,7 +786,29 @@ template<typename T, typename Alloc>
   // type of InputIterator
   typedef typename thrust::detail::is_integral<InputIterator> integral;
 
-  assign_dispatch(first, last, integral());
+  assign_dispatch(default_executor(), first, last, integral());
+} // end vector_base::assign()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy>
+    void vector_base<T,Alloc>
+      ::assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               size_type n, const T &x)
+{
+  fill_assign(thrust::detail::derived_cast(exec), n, x);
+} // end vector_base::assign()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy, typename InputIterator>
+    void vector_base<T,Alloc>
+      ::assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               InputIterator first, InputIterator last)
+{
+  // we could have received assign(exec, n, x), so disambiguate on the
+  // type of InputIterator
+  typedef typename thrust::detail::is_integral<InputIterator> integral;
+
+  assign_dispatch(thrust::detail::derived_cast(exec), first, last, integral());
 } // end vector_base::assign()
 
 template<typename T, typename Alloc>
@@ -704,7 +840,7 @@ template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::insert(iterator position, size_type n, const T &x)
 {
-  fill_insert(position, n, x);
+  fill_insert(default_executor(), position, n, x);
 } // end vector_base::insert()
 
 template<typename T, typename Alloc>
@@ -716,45 +852,68 @@ template<typename T, typename Alloc>
   // type of InputIterator
   typedef typename thrust::detail::is_integral<InputIterator> integral;
 
-  insert_dispatch(position, first, last, integral());
+  insert_dispatch(default_executor(), position, first, last, integral());
 } // end vector_base::insert()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename DerivedPolicy>
+    void vector_base<T,Alloc>
+      ::insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               iterator position, size_type n, const T &x)
+{
+  fill_insert(thrust::detail::derived_cast(exec), position, n, x);
+} // end vector_base::insert()
+
+template<typename T, typename Alloc>
+  template<typename DerivedPolicy, typename InputIterator>
     void vector_base<T,Alloc>
-      ::assign_dispatch(InputIterator first, InputIterator last, false_type)
+      ::insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               iterator position, InputIterator first, InputIterator last)
 {
-  range_assign(first, last);
+  // we could have received insert(exec, position, n, x), so disambiguate on the
+  // type of InputIterator
+  typedef typename thrust::detail::is_integral<InputIterator> integral;
+
+  insert_dispatch(thrust::detail::derived_cast(exec), position, first, last, integral());
+} // end vector_base::insert()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    void vector_base<T,Alloc>
+      ::assign_dispatch(const Executor &exec, InputIterator first, InputIterator last, false_type)
+{
+  range_assign(exec, first, last);
 } // end vector_base::assign_dispatch()
 
 template<typename T, typename Alloc>
-  template<typename Integral>
+  template<typename Executor, typename Integral>
     void vector_base<T,Alloc>
-      ::assign_dispatch(Integral n, Integral x, true_type)
+      ::assign_dispatch(const Executor &exec, Integral n, Integral x, true_type)
 {
-  fill_assign(n, x);
+  fill_assign(exec, n, x);
 } // end vector_base::assign_dispatch()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type)
+      ::insert_dispatch(const Executor &exec, iterator position, InputIterator first, InputIterator last, false_type)
 {
-  copy_insert(position, first, last);
+  copy_insert(exec, position, first, last);
 } // end vector_base::insert_dispatch()
 
 template<typename T, typename Alloc>
-  template<typename Integral>
+  template<typename Executor, typename Integral>
     void vector_base<T,Alloc>
-      ::insert_dispatch(iterator position, Integral n, Integral x, true_type)
+      ::insert_dispatch(const Executor &exec, iterator position, Integral n, Integral x, true_type)
 {
-  fill_insert(position, n, x);
+  fill_insert(exec, position, n, x);
 } // end vector_base::insert_dispatch()
 
 template<typename T, typename Alloc>
-  template<typename ForwardIterator>
+  template<typename Executor, typename ForwardIterator>
     void vector_base<T,Alloc>
-      ::copy_insert(iterator position,
+      ::copy_insert(const Executor &exec,
+                    iterator position,
                     ForwardIterator first,
                     ForwardIterator last)
 {
@@ -773,7 +932,7 @@ template<typename T, typename Alloc>
       {
         // construct copy n displaced elements to new elements
         // following the insertion
-        m_storage.uninitialized_copy(end() - num_new_elements, end(), end());
+        bulk_uninitialized_copy(exec, end() - num_new_elements, end(), end());
 
         // extend the size
         m_size += num_new_elements;
@@ -784,7 +943,7 @@ template<typename T, typename Alloc>
         thrust::detail::overlapped_copy(position, old_end - num_new_elements, old_end - copy_length);
 
         // finally, copy the range to the insertion point
-        thrust::copy(first, last, position);
+        bulk_copy(exec, first, last, position);
       } // end if
       else
       {
@@ -792,19 +951,19 @@ template<typename T, typename Alloc>
         thrust::advance(mid, num_displaced_elements);
 
         // construct copy new elements at the end of the vector
-        m_storage.uninitialized_copy(mid, last, end());
+        bulk_uninitialized_copy(exec, mid, last, end());
 
         // extend the size
         m_size += num_new_elements - num_displaced_elements;
 
         // construct copy the displaced elements
-        m_storage.uninitialized_copy(position, old_end, end());
+        bulk_uninitialized_copy(exec, position, old_end, end());
 
         // extend the size
         m_size += num_displaced_elements;
 
         // copy to elements which already existed
-        thrust::copy(first, mid, position);
+        bulk_copy(exec, first, mid, position);
       } // end else
     } // end if
     else
@@ -812,19 +971,20 @@ template<typename T, typename Alloc>
       const size_type old_size = size();
 
       // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, num_new_elements);
-
-      // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      size_type new_capacity = grown_capacity(old_size + num_new_elements);
 
       if(new_capacity > max_size())
       {
         throw std::length_error("insert(): insertion exceeds max_size().");
       } // end if
 
+      // grow the storage in place if the allocator is able to
+      if(m_storage.try_expand(new_capacity))
+      {
+        copy_insert(exec, position, first, last);
+        return;
+      } // end if
+
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
       // record how many constructors we invoke in the try block below
@@ -834,14 +994,14 @@ template<typename T, typename Alloc>
       {
         // construct copy elements before the insertion to the beginning of the newly
         // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
+        new_end = bulk_uninitialized_copy(exec, begin(), position, new_storage.begin());
 
         // construct copy elements to insert
-        new_end = m_storage.uninitialized_copy(first, last, new_end);
+        new_end = bulk_uninitialized_copy(exec, first, last, new_end);
 
         // construct copy displaced elements from the old storage to the new storage
         // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        new_end = bulk_uninitialized_copy(exec, position, end(), new_end);
       } // end try
       catch(...)
       {
@@ -864,8 +1024,9 @@ template<typename T, typename Alloc>
 } // end vector_base::copy_insert()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::append(size_type n)
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::append(const Executor &exec, size_type n)
 {
   if(n != 0)
   {
@@ -874,7 +1035,7 @@ template<typename T, typename Alloc>
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      bulk_default_construct_n(exec, end(), n);
 
       // extend the size
       m_size += n;
@@ -884,13 +1045,14 @@ template<typename T, typename Alloc>
       const size_type old_size = size();
 
       // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, n);
-
-      // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
+      size_type new_capacity = grown_capacity(old_size + n);
 
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      // grow the storage in place if the allocator is able to
+      if(m_storage.try_expand(new_capacity))
+      {
+        append(exec, n);
+        return;
+      } // end if
 
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
@@ -901,10 +1063,10 @@ template<typename T, typename Alloc>
       try
       {
         // construct copy all elements into the newly allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
+        new_end = bulk_uninitialized_copy(exec, begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.default_construct_n(new_end, n);
+        bulk_default_construct_n(exec, new_end, n);
         new_end += n;
       } // end try
       catch(...)
@@ -928,8 +1090,9 @@ template<typename T, typename Alloc>
 } // end vector_base::append()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::fill_insert(iterator position, size_type n, const T &x)
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::fill_insert(const Executor &exec, iterator position, size_type n, const T &x)
 {
   if(n != 0)
   {
@@ -944,7 +1107,7 @@ template<typename T, typename Alloc>
       {
         // construct copy n displaced elements to new elements
         // following the insertion
-        m_storage.uninitialized_copy(end() - n, end(), end());
+        bulk_uninitialized_copy(exec, end() - n, end(), end());
 
         // extend the size
         m_size += n;
@@ -955,24 +1118,24 @@ template<typename T, typename Alloc>
         thrust::detail::overlapped_copy(position, old_end - n, old_end - copy_length);
 
         // finally, fill the range to the insertion point
-        thrust::fill_n(position, n, x);
+        bulk_fill_n(exec, position, n, x);
       } // end if
       else
       {
         // construct new elements at the end of the vector
-        m_storage.uninitialized_fill_n(end(), n - num_displaced_elements, x);
+        bulk_uninitialized_fill_n(exec, end(), n - num_displaced_elements, x);
 
         // extend the size
         m_size += n - num_displaced_elements;
 
         // construct copy the displaced elements
-        m_storage.uninitialized_copy(position, old_end, end());
+        bulk_uninitialized_copy(exec, position, old_end, end());
 
         // extend the size
         m_size += num_displaced_elements;
 
         // fill to elements which already existed
-        thrust::fill(position, old_end, x);
+        bulk_fill_n(exec, position, num_displaced_elements, x);
       } // end else
     } // end if
     else
@@ -980,19 +1143,20 @@ template<typename T, typename Alloc>
       const size_type old_size = size();
 
       // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, n);
-
-      // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      size_type new_capacity = grown_capacity(old_size + n);
 
       if(new_capacity > max_size())
       {
         throw std::length_error("insert(): insertion exceeds max_size().");
       } // end if
 
+      // grow the storage in place if the allocator is able to
+      if(m_storage.try_expand(new_capacity))
+      {
+        fill_insert(exec, position, n, x);
+        return;
+      } // end if
+
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
       // record how many constructors we invoke in the try block below
@@ -1002,15 +1166,15 @@ template<typename T, typename Alloc>
       {
         // construct copy elements before the insertion to the beginning of the newly
         // allocated storage
-        new_end = m_storage.uninitialized_copy(begin(), position, new_storage.begin());
+        new_end = bulk_uninitialized_copy(exec, begin(), position, new_storage.begin());
 
         // construct new elements to insert
-        m_storage.uninitialized_fill_n(new_end, n, x);
+        bulk_uninitialized_fill_n(exec, new_end, n, x);
         new_end += n;
 
         // construct copy displaced elements from the old storage to the new storage
         // remember [position, end()) refers to the old storage
-        new_end = m_storage.uninitialized_copy(position, end(), new_end);
+        new_end = bulk_uninitialized_copy(exec, position, end(), new_end);
       } // end try
       catch(...)
       {
@@ -1033,20 +1197,22 @@ template<typename T, typename Alloc>
 } // end vector_base::fill_insert()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::range_assign(InputIterator first,
+      ::range_assign(const Executor &exec,
+                     InputIterator first,
                      InputIterator last)
 {
   // dispatch on traversal
-  range_assign(first, last,
+  range_assign(exec, first, last,
     typename thrust::iterator_traversal<InputIterator>::type());
 } // end range_assign()
 
 template<typename T, typename Alloc>
-  template<typename InputIterator>
+  template<typename Executor, typename InputIterator>
     void vector_base<T,Alloc>
-      ::range_assign(InputIterator first,
+      ::range_assign(const Executor &exec,
+                     InputIterator first,
                      InputIterator last,
                      thrust::incrementable_traversal_tag)
 {
@@ -1068,23 +1234,25 @@ template<typename T, typename Alloc>
   else
   {
     // insert the rest of the input at the end of the vector
-    insert(end(), first, last);
+    copy_insert(exec, end(), first, last);
   } // end else
 } // end vector_base::range_assign()
 
 template<typename T, typename Alloc>
-  template<typename RandomAccessIterator>
+  template<typename Executor, typename RandomAccessIterator>
     void vector_base<T,Alloc>
-      ::range_assign(RandomAccessIterator first,
+      ::range_assign(const Executor &exec,
+                     RandomAccessIterator first,
                      RandomAccessIterator last,
                      thrust::random_access_traversal_tag)
 {
   const size_type n = thrust::distance(first, last);
 
-  if(n > capacity())
+  // reallocate, unless the allocator is able to grow the storage in place
+  if(n > capacity() && !m_storage.try_expand(grown_capacity(n)))
   {
     storage_type new_storage(copy_allocator_t(), m_storage);
-    allocate_and_copy(n, first, last, new_storage);
+    allocate_and_copy(exec, n, first, last, new_storage);
 
     // call destructors on the elements in the old storage
     m_storage.destroy(begin(), end());
@@ -1096,7 +1264,7 @@ template<typename T, typename Alloc>
   else if(size() >= n)
   {
     // we can already accomodate the new range
-    iterator new_end = thrust::copy(first, last, begin());
+    iterator new_end = bulk_copy(exec, first, last, begin());
 
     // destroy the elements we don't need
     m_storage.destroy(new_end, end());
@@ -1115,10 +1283,10 @@ template<typename T, typename Alloc>
     // copy to elements which already exist
     RandomAccessIterator mid = first;
     thrust::advance(mid, size());
-    thrust::copy(first, mid, begin());
+    bulk_copy(exec, first, mid, begin());
 
     // uninitialize_copy to elements which must be constructed
-    m_storage.uninitialized_copy(mid, last, end());
+    bulk_uninitialized_copy(exec, mid, last, end());
 
     // update size
     m_size = n;
@@ -1126,23 +1294,26 @@ template<typename T, typename Alloc>
 } // end vector_base::assign()
 
 template<typename T, typename Alloc>
-  void vector_base<T,Alloc>
-    ::fill_assign(size_type n, const T &x)
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::fill_assign(const Executor &exec, size_type n, const T &x)
 {
-  if(n > capacity())
+  // reallocate, unless the allocator is able to grow the storage in place
+  if(n > capacity() && !m_storage.try_expand(grown_capacity(n)))
   {
     // XXX we should also include a copy of the allocator:
     // vector_base<T,Alloc> temp(n, x, get_allocator());
-    vector_base<T,Alloc> temp(n, x);
+    vector_base<T,Alloc> temp;
+    temp.fill_init(exec, n, x);
     temp.swap(*this);
   } // end if
   else if(n > size())
   {
     // fill to existing elements
-    thrust::fill(begin(), end(), x);
+    bulk_fill_n(exec, begin(), size(), x);
 
     // construct uninitialized elements
-    m_storage.uninitialized_fill_n(end(), n - size(), x);
+    bulk_uninitialized_fill_n(exec, end(), n - size(), x);
 
     // adjust size
     m_size += (n - size());
@@ -1150,7 +1321,7 @@ template<typename T, typename Alloc>
   else
   {
     // fill to existing elements
-    iterator new_end = thrust::fill_n(begin(), n, x);
+    iterator new_end = bulk_fill_n(exec, begin(), n, x);
 
     // erase the elements after the fill
     erase(new_end, end());
@@ -1158,9 +1329,10 @@ template<typename T, typename Alloc>
 } // end vector_base::fill_assign()
 
 template<typename T, typename Alloc>
-  template<typename ForwardIterator>
+  template<typename Executor, typename ForwardIterator>
     void vector_base<T,Alloc>
-      ::allocate_and_copy(size_type requested_size,
+      ::allocate_and_copy(const Executor &exec,
+                          size_type requested_size,
                           ForwardIterator first, ForwardIterator last,
                           storage_type &new_storage)
 {
@@ -1170,8 +1342,8 @@ template<typename T, typename Alloc>
     return;
   } // end if
 
-  // allocate exponentially larger new storage
-  size_type allocated_size = thrust::max<size_type>(requested_size, 2 * capacity());
+  // storage which replaces existing storage grows by the growth policy
+  size_type allocated_size = capacity() == 0 ? requested_size : grown_capacity(requested_size);
 
   // do not exceed maximum storage
   allocated_size = thrust::min<size_type>(allocated_size, max_size());
@@ -1186,7 +1358,7 @@ template<typename T, typename Alloc>
   try
   {
     // construct the range to the newly allocated storage
-    m_storage.uninitialized_copy(first, last, new_storage.begin());
+    bulk_uninitialized_copy(exec, first, last, new_storage.begin());
   } // end try
   catch(...)
   {
@@ -1202,6 +1374,174 @@ template<typename T, typename Alloc>
   } // end catch
 } // end vector_base::allocate_and_copy()
 
+template<typename T, typename Alloc>
+  typename vector_base<T,Alloc>::size_type
+    vector_base<T,Alloc>
+      ::grown_capacity(size_type required) const
+{
+  typedef typename allocator_growth_policy<Alloc>::type growth_policy;
+
+  size_type new_capacity = static_cast<size_type>(growth_policy::next_capacity(capacity(), required, sizeof(T)));
+
+  // never allocate less than required
+  new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, required);
+
+  // do not exceed maximum storage
+  return thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+} // end vector_base::grown_capacity()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_uninitialized_copy(const Executor &exec,
+                                  InputIterator first, InputIterator last,
+                                  iterator result)
+{
+  typedef typename thrust::iterator_system<InputIterator>::type InputSystem;
+
+  return bulk_uninitialized_copy(exec, first, last, result,
+    vector_base_detail::executor_applies<Executor,T,Alloc,InputSystem>());
+} // end vector_base::bulk_uninitialized_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_uninitialized_copy(const Executor &exec,
+                                  InputIterator first, InputIterator last,
+                                  iterator result,
+                                  true_type)
+{
+  return thrust::uninitialized_copy(exec, first, last, result);
+} // end vector_base::bulk_uninitialized_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_uninitialized_copy(const Executor &,
+                                  InputIterator first, InputIterator last,
+                                  iterator result,
+                                  false_type)
+{
+  return m_storage.uninitialized_copy(first, last, result);
+} // end vector_base::bulk_uninitialized_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_uninitialized_fill_n(const Executor &exec, iterator first, size_type n, const T &x)
+{
+  bulk_uninitialized_fill_n(exec, first, n, x,
+    vector_base_detail::executor_applies<Executor,T,Alloc,thrust::any_system_tag>());
+} // end vector_base::bulk_uninitialized_fill_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_uninitialized_fill_n(const Executor &exec, iterator first, size_type n, const T &x, true_type)
+{
+  thrust::uninitialized_fill_n(exec, first, n, x);
+} // end vector_base::bulk_uninitialized_fill_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_uninitialized_fill_n(const Executor &, iterator first, size_type n, const T &x, false_type)
+{
+  m_storage.uninitialized_fill_n(first, n, x);
+} // end vector_base::bulk_uninitialized_fill_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_default_construct_n(const Executor &exec, iterator first, size_type n)
+{
+  // only trivially constructible elements may be value-initialized in bulk
+  typedef integral_constant<
+    bool,
+    vector_base_detail::executor_applies<Executor,T,Alloc,thrust::any_system_tag>::value &&
+    has_trivial_constructor<T>::value
+  > applies;
+
+  bulk_default_construct_n(exec, first, n, applies());
+} // end vector_base::bulk_default_construct_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_default_construct_n(const Executor &exec, iterator first, size_type n, true_type)
+{
+  thrust::uninitialized_fill_n(exec, first, n, T());
+} // end vector_base::bulk_default_construct_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    void vector_base<T,Alloc>
+      ::bulk_default_construct_n(const Executor &, iterator first, size_type n, false_type)
+{
+  m_storage.default_construct_n(first, n);
+} // end vector_base::bulk_default_construct_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result)
+{
+  typedef typename thrust::iterator_system<InputIterator>::type InputSystem;
+
+  return bulk_copy(exec, first, last, result,
+    vector_base_detail::executor_applies<Executor,T,Alloc,InputSystem>());
+} // end vector_base::bulk_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_copy(const Executor &exec, InputIterator first, InputIterator last, iterator result, true_type)
+{
+  return thrust::copy(exec, first, last, result);
+} // end vector_base::bulk_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor, typename InputIterator>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_copy(const Executor &, InputIterator first, InputIterator last, iterator result, false_type)
+{
+  return thrust::copy(first, last, result);
+} // end vector_base::bulk_copy()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_fill_n(const Executor &exec, iterator first, size_type n, const T &x)
+{
+  return bulk_fill_n(exec, first, n, x,
+    vector_base_detail::executor_applies<Executor,T,Alloc,thrust::any_system_tag>());
+} // end vector_base::bulk_fill_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_fill_n(const Executor &exec, iterator first, size_type n, const T &x, true_type)
+{
+  return thrust::fill_n(exec, first, n, x);
+} // end vector_base::bulk_fill_n()
+
+template<typename T, typename Alloc>
+  template<typename Executor>
+    typename vector_base<T,Alloc>::iterator
+      vector_base<T,Alloc>
+        ::bulk_fill_n(const Executor &, iterator first, size_type n, const T &x, false_type)
+{
+  return thrust::fill_n(first, n, x);
+} // end vector_base::bulk_fill_n()
+
 
 } // end detail
 
@@ -0,0 +1,330 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/external_sort.h
+ *  \brief Sorts sequences larger than memory by spilling sorted runs to disk
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/external_sort.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p external_sort_options controls the memory and disk usage of
+ *  \p external_sort.
+ */
+struct external_sort_options
+{
+  /*! The number of bytes of host memory \p external_sort may use for its
+   *  buffers. The input is sorted in chunks of half this size.
+   */
+  std::size_t memory_budget = std::size_t(256) << 20;
+
+  /*! The directory in which the sorted runs are stored. If empty, the runs
+   *  are stored in unnamed files created by \c std::tmpfile.
+   */
+  std::string temp_directory;
+
+  /*! The largest number of runs merged at once. If zero, the number is
+   *  derived from \p memory_budget so that every run is read in blocks of at
+   *  least 64 KiB. When there are more runs, they are first merged in groups
+   *  into longer runs.
+   */
+  std::size_t max_merge_ways = 0;
+};
+
+
+/*! \p external_sort_statistics describes the work done by a call to
+ *  \p external_sort.
+ */
+struct external_sort_statistics
+{
+  /*! The number of elements sorted. */
+  std::size_t num_elements = 0;
+
+  /*! The number of sorted runs spilled to disk. Zero if the input fit into
+   *  a single chunk.
+   */
+  std::size_t num_runs = 0;
+
+  /*! The number of merge passes, including the final one. */
+  std::size_t num_merge_passes = 0;
+
+  /*! The number of bytes written to temporary files. */
+  std::size_t bytes_spilled = 0;
+};
+
+
+/*! \p file_source reads elements of type \p T from a binary \c std::FILE
+ *  stream. It is a model of the \p Source concept of \p external_sort.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable.
+ */
+template<typename T>
+class file_source
+{
+public:
+  /*! Constructs a source which reads from the current position of \p file
+   *  to its end. \p file is not closed by the source.
+   */
+  explicit file_source(std::FILE *file)
+    : m_file(file)
+  {}
+
+  /*! Reads at most \p capacity elements into \p buffer.
+   *
+   *  \return The number of elements read, or zero at the end of the file.
+   *  \throw thrust::system_error If reading from the file fails.
+   */
+  std::size_t operator()(T *buffer, std::size_t capacity)
+  {
+    const std::size_t n = std::fread(buffer, sizeof(T), capacity, m_file);
+
+    if(n < capacity && std::ferror(m_file))
+    {
+      thrust::detail::external_sort_detail::throw_io_error("file_source: failed to read the input file");
+    }
+
+    return n;
+  }
+
+private:
+  std::FILE *m_file;
+};
+
+
+/*! \p file_sink writes elements of type \p T to a binary \c std::FILE
+ *  stream. It is a model of the \p Sink concept of \p external_sort.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable.
+ */
+template<typename T>
+class file_sink
+{
+public:
+  /*! Constructs a sink which writes at the current position of \p file.
+   *  \p file is not closed by the sink.
+   */
+  explicit file_sink(std::FILE *file)
+    : m_file(file)
+  {}
+
+  /*! Writes the \p n elements of \p data.
+   *
+   *  \throw thrust::system_error If writing to the file fails.
+   */
+  void operator()(const T *data, std::size_t n)
+  {
+    if(n > 0 && std::fwrite(data, sizeof(T), n, m_file) != n)
+    {
+      thrust::detail::external_sort_detail::throw_io_error("file_sink: failed to write the output file");
+    }
+  }
+
+private:
+  std::FILE *m_file;
+};
+
+
+/*! \p external_sort sorts a sequence which need not fit into memory. The
+ *  elements are pulled from \p source in chunks of half of
+ *  <tt>options.memory_budget</tt> bytes, and every chunk is sorted in memory
+ *  with \p thrust::sort using \p exec. Unless the whole input fits into one
+ *  chunk, every sorted chunk is then written to a temporary file in
+ *  <tt>options.temp_directory</tt>, on a background thread while the next
+ *  chunk is read and sorted. Finally, the runs are merged with a streaming
+ *  k-way merge, and the sorted sequence is pushed to \p sink. The temporary
+ *  files are deleted before \p external_sort returns.
+ *
+ *  \p source is called as <tt>source(buffer, capacity)</tt> with a
+ *  <tt>T*</tt> and a \c std::size_t. It stores up to \p capacity elements
+ *  in \p buffer and returns their number, or zero at the end of the input.
+ *  \p sink is called as <tt>sink(data, n)</tt> with a <tt>const T*</tt> and
+ *  a \c std::size_t, once per block of sorted output in order. Because
+ *  writes overlap with merging, \p sink may be called from a thread other
+ *  than the caller's, but never concurrently with itself.
+ *
+ *  \p external_sort is not guaranteed to be stable. The order of equivalent
+ *  elements taken from different chunks is preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec. The
+ *  buffers are in host memory, so \p exec must be a policy whose algorithms
+ *  may access host memory, such as \p thrust::host, \p thrust::cpp::par,
+ *  \p thrust::omp::par or \p thrust::tbb::par.
+ *
+ *  \param exec The execution policy used to sort the chunks and merge the runs.
+ *  \param source The function object producing the input.
+ *  \param sink The function object consuming the sorted output.
+ *  \param options The memory budget and temporary directory.
+ *  \param comp Comparison operator.
+ *  \return Statistics of the sort.
+ *  \throw thrust::system_error If creating, writing or reading a temporary
+ *         file fails. Exceptions thrown by \p source or \p sink are
+ *         propagated.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable and
+ *          default constructible.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam Source is a function object type with the signature described above.
+ *  \tparam Sink is a function object type with the signature described above.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p external_sort to
+ *  sort a binary file of integers, too large for memory, in descending
+ *  order using the \p thrust::omp::par execution policy:
+ *
+ *  \code
+ *  #include <thrust/external_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <cstdio>
+ *  ...
+ *  std::FILE *input  = std::fopen("keys.bin", "rb");
+ *  std::FILE *output = std::fopen("sorted.bin", "wb");
+ *
+ *  thrust::external_sort_options options;
+ *  options.memory_budget  = std::size_t(1) << 30;
+ *  options.temp_directory = "/scratch";
+ *
+ *  thrust::external_sort<int>(thrust::omp::par,
+ *                             thrust::file_source<int>(input),
+ *                             thrust::file_sink<int>(output),
+ *                             options,
+ *                             thrust::greater<int>());
+ *  \endcode
+ *
+ *  \see \c sort
+ *  \see \c multiway_merge
+ */
+template<typename T, typename DerivedPolicy, typename Source, typename Sink, typename StrictWeakOrdering>
+external_sort_statistics external_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       Source source,
+                                       Sink sink,
+                                       const external_sort_options &options,
+                                       StrictWeakOrdering comp);
+
+
+/*! \p external_sort sorts a sequence which need not fit into memory in
+ *  ascending order, as defined by <tt>operator<</tt>. See the overload
+ *  taking a comparator for the details.
+ *
+ *  \param exec The execution policy used to sort the chunks and merge the runs.
+ *  \param source The function object producing the input.
+ *  \param sink The function object consuming the sorted output.
+ *  \param options The memory budget and temporary directory.
+ *  \return Statistics of the sort.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable,
+ *          default constructible and <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *
+ *  \code
+ *  #include <thrust/external_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <vector>
+ *  ...
+ *  std::vector<int> input = {3, 1, 2};
+ *  std::vector<int> output;
+ *  std::size_t position = 0;
+ *
+ *  auto source = [&](int *buffer, std::size_t capacity)
+ *  {
+ *    std::size_t n = std::min(capacity, input.size() - position);
+ *    std::copy_n(input.begin() + position, n, buffer);
+ *    position += n;
+ *    return n;
+ *  };
+ *  auto sink = [&](const int *data, std::size_t n)
+ *  {
+ *    output.insert(output.end(), data, data + n);
+ *  };
+ *
+ *  thrust::external_sort<int>(thrust::host, source, sink, thrust::external_sort_options());
+ *  // output is now {1, 2, 3}
+ *  \endcode
+ */
+template<typename T, typename DerivedPolicy, typename Source, typename Sink>
+external_sort_statistics external_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       Source source,
+                                       Sink sink,
+                                       const external_sort_options &options);
+
+
+/*! \p external_sort sorts a sequence which need not fit into memory, using
+ *  the \p thrust::host execution policy. See the overload taking an
+ *  execution policy for the details.
+ *
+ *  \param source The function object producing the input.
+ *  \param sink The function object consuming the sorted output.
+ *  \param options The memory budget and temporary directory.
+ *  \param comp Comparison operator.
+ *  \return Statistics of the sort.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable and
+ *          default constructible.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ */
+template<typename T, typename Source, typename Sink, typename StrictWeakOrdering>
+external_sort_statistics external_sort(Source source,
+                                       Sink sink,
+                                       const external_sort_options &options,
+                                       StrictWeakOrdering comp);
+
+
+/*! \p external_sort sorts a sequence which need not fit into memory in
+ *  ascending order, using the \p thrust::host execution policy. See the
+ *  overload taking an execution policy and a comparator for the details.
+ *
+ *  \param source The function object producing the input.
+ *  \param sink The function object consuming the sorted output.
+ *  \param options The memory budget and temporary directory.
+ *  \return Statistics of the sort.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable,
+ *          default constructible and <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ */
+template<typename T, typename Source, typename Sink>
+external_sort_statistics external_sort(Source source,
+                                       Sink sink,
+                                       const external_sort_options &options);
+
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/external_sort.inl>
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -0,0 +1,148 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file growth_policy.h
+ *  \brief Policies deciding the new capacity of a vector which has to grow.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes Container Classes
+ *  \{
+ */
+
+/*! A growth policy decides how much storage a \p host_vector or \p device_vector
+ *  allocates when an insertion does not fit into its capacity. A vector uses the
+ *  policy named by the nested type \c growth_policy of its allocator, or
+ *  \p geometric_growth<> if the allocator has none.
+ *
+ *  A growth policy is a type with a static member function
+ *  <tt>std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t element_size)</tt>,
+ *  which returns the new capacity, in elements, for a vector of \p capacity
+ *  elements of \p element_size bytes which has to hold \p required elements.
+ *  Results smaller than \p required are raised to \p required, and results larger
+ *  than the \c max_size() of the vector are lowered to it.
+ *
+ *  The following code snippet demonstrates how to make a \p host_vector grow by
+ *  half of its capacity instead of doubling it.
+ *
+ *  \code
+ *  #include <thrust/growth_policy.h>
+ *  #include <thrust/host_vector.h>
+ *
+ *  template<typename T>
+ *  struct frugal_allocator : std::allocator<T>
+ *  {
+ *    typedef thrust::geometric_growth<3, 2> growth_policy;
+ *
+ *    template<typename U>
+ *    struct rebind { typedef frugal_allocator<U> other; };
+ *
+ *    frugal_allocator() {}
+ *
+ *    template<typename U>
+ *    frugal_allocator(const frugal_allocator<U> &) {}
+ *  };
+ *
+ *  thrust::host_vector<int, frugal_allocator<int> > vec;
+ *  \endcode
+ *
+ *  \tparam Numerator the numerator of the growth factor
+ *  \tparam Denominator the denominator of the growth factor
+ *
+ *  \see linear_growth
+ *  \see page_rounded_growth
+ */
+template<std::size_t Numerator = 2, std::size_t Denominator = 1>
+struct geometric_growth
+{
+    __host__ __device__
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        const std::size_t max_capacity = ~static_cast<std::size_t>(0);
+
+        std::size_t grown = max_capacity;
+        if (capacity / Denominator <= max_capacity / Numerator)
+        {
+            grown = capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator;
+        }
+
+        return grown < required ? required : grown;
+    }
+};
+
+/*! A growth policy which adds a fixed number of elements to the capacity, and
+ *  allocates whole multiples of \p Increment elements for larger insertions.
+ *  Memory overhead is bounded by \p Increment elements, at the price of a
+ *  reallocation every \p Increment insertions of single elements.
+ *
+ *  \tparam Increment the number of elements to grow by
+ *
+ *  \see geometric_growth
+ */
+template<std::size_t Increment>
+struct linear_growth
+{
+    __host__ __device__
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t)
+    {
+        if (required <= capacity + Increment)
+        {
+            return capacity + Increment;
+        }
+
+        return required + (Increment - required % Increment) % Increment;
+    }
+};
+
+/*! A growth policy which rounds the capacity computed by another policy up to
+ *  whole pages, so that the storage of a vector does not end with a partially
+ *  used page. This suits allocators which obtain memory in pages, such as
+ *  \p mr::locked_host_resource.
+ *
+ *  \tparam Base the growth policy computing the capacity to round up
+ *  \tparam PageBytes the size of a page, in bytes
+ *
+ *  \see geometric_growth
+ */
+template<typename Base = geometric_growth<>, std::size_t PageBytes = 4096>
+struct page_rounded_growth
+{
+    __host__ __device__
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required, std::size_t element_size)
+    {
+        const std::size_t n = Base::next_capacity(capacity, required, element_size);
+
+        if (element_size == 0 || n > (~static_cast<std::size_t>(0) - PageBytes) / element_size)
+        {
+            return n;
+        }
+
+        const std::size_t bytes = (n * element_size + PageBytes - 1) / PageBytes * PageBytes;
+        return bytes / element_size;
+    }
+};
+
+/*! \} // container_classes
+ */
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,370 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/histogram.h
+ *  \brief Counting the samples of a sequence which fall into a set of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ *  \addtogroup histograms Histograms
+ *  \ingroup reductions
+ *  \{
+ */
+
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt>
+ *  which fall into each of <tt>num_levels - 1</tt> bins of equal width
+ *  spanning <tt>[lower_level, upper_level)</tt>. The count of bin \c i is
+ *  written to <tt>*(histogram + i)</tt>. Samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of bin counts.
+ *  \param num_levels The number of bin boundaries, one more than the number of bins.
+ *  \param lower_level The inclusive lower boundary of the first bin.
+ *  \param upper_level The exclusive upper boundary of the last bin.
+ *  \return <tt>histogram + num_levels - 1</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \c InputIterator's \c value_type is convertible to \p Level.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is mutable, and whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to
+ *  count samples in four bins of width 2 using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[8] = {0.5f, 1.5f, 2.5f, 7.5f, 3.0f, 8.0f, -1.0f, 2.0f};
+ *  int counts[4];
+ *
+ *  thrust::histogram_even(thrust::host, samples, samples + 8, counts, 5, 0.0f, 8.0f);
+ *
+ *  // counts is now {2, 3, 0, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  OutputIterator histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level);
+
+
+/*! \p histogram_even counts the samples of the range <tt>[first, last)</tt>
+ *  which fall into each of <tt>num_levels - 1</tt> bins of equal width
+ *  spanning <tt>[lower_level, upper_level)</tt>. The count of bin \c i is
+ *  written to <tt>*(histogram + i)</tt>. Samples outside of
+ *  <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of bin counts.
+ *  \param num_levels The number of bin boundaries, one more than the number of bins.
+ *  \param lower_level The inclusive lower boundary of the first bin.
+ *  \param upper_level The exclusive upper boundary of the last bin.
+ *  \return <tt>histogram + num_levels - 1</tt>
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \c InputIterator's \c value_type is convertible to \p Level.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is mutable, and whose \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<int> samples(...);
+ *  thrust::device_vector<unsigned int> counts(256);
+ *
+ *  // one bin per value of a byte
+ *  thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 257, 0, 256);
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ */
+template<typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  OutputIterator histogram_even(InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level);
+
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt>
+ *  which fall into each of the bins whose boundaries are given by the sorted
+ *  range <tt>[levels_first, levels_last)</tt>. Bin \c i spans
+ *  <tt>[levels_first[i], levels_first[i+1])</tt> and its count is written to
+ *  <tt>*(histogram + i)</tt>. Samples outside of all bins are not counted.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of bin counts.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return <tt>histogram + (levels_last - levels_first) - 1</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \c InputIterator's \c value_type is comparable with \c LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is mutable, and whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is accessible from \p exec.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> is sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to
+ *  count samples in three bins of varying width using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int samples[8] = {0, 1, 5, 9, 10, 42, 99, 100};
+ *  int levels[4]  = {0, 2, 10, 100};
+ *  int counts[3];
+ *
+ *  thrust::histogram_range(thrust::host, samples, samples + 8, counts, levels, levels + 4);
+ *
+ *  // counts is now {2, 2, 3}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  OutputIterator histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last);
+
+
+/*! \p histogram_range counts the samples of the range <tt>[first, last)</tt>
+ *  which fall into each of the bins whose boundaries are given by the sorted
+ *  range <tt>[levels_first, levels_last)</tt>. Bin \c i spans
+ *  <tt>[levels_first[i], levels_first[i+1])</tt> and its count is written to
+ *  <tt>*(histogram + i)</tt>. Samples outside of all bins are not counted.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the sequence of bin counts.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return <tt>histogram + (levels_last - levels_first) - 1</tt>
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>,
+ *          and \c InputIterator's \c value_type is comparable with \c LevelIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is mutable, and whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          which is accessible from the system of \p InputIterator.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> is sorted in ascending order.
+ *
+ *  \see \p histogram_even
+ */
+template<typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  OutputIterator histogram_range(InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last);
+
+
+/*! \p multi_histogram_even computes a \p histogram_even of each of the first
+ *  \p NumActiveChannels channels of a sequence of interleaved samples, such
+ *  as the pixels of an RGBA image. The range <tt>[first, last)</tt> holds
+ *  <tt>(last - first) / NumChannels</tt> pixels of \p NumChannels samples
+ *  each; the histogram of channel \c c is written to \c histograms[c] using
+ *  \c num_levels[c], \c lower_level[c] and \c upper_level[c].
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginning of the bin counts of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param lower_level The inclusive lower boundary of each active channel.
+ *  \param upper_level The exclusive upper boundary of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved channels.
+ *  \tparam NumActiveChannels The number of leading channels to histogram.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  // two RGBA pixels; histogram only the colour channels
+ *  unsigned char pixels[8] = {255, 0, 0, 255,  0, 255, 128, 255};
+ *  int r[2], g[2], b[2];
+ *
+ *  int *histograms[3]  = {r, g, b};
+ *  int  num_levels[3]  = {3, 3, 3};
+ *  int  lower_level[3] = {0, 0, 0};
+ *  int  upper_level[3] = {256, 256, 256};
+ *
+ *  thrust::multi_histogram_even<4, 3>(thrust::host, pixels, pixels + 8, histograms, num_levels, lower_level, upper_level);
+ *
+ *  // r is {1, 1}, g is {1, 1}, b is {1, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ */
+template<int NumChannels,
+         int NumActiveChannels,
+         typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  void multi_histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                            InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels]);
+
+
+/*! \p multi_histogram_even computes a \p histogram_even of each of the first
+ *  \p NumActiveChannels channels of a sequence of interleaved samples.
+ *
+ *  \see \p multi_histogram_even
+ */
+template<int NumChannels,
+         int NumActiveChannels,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  void multi_histogram_even(InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels]);
+
+
+/*! \p multi_histogram_range computes a \p histogram_range of each of the
+ *  first \p NumActiveChannels channels of a sequence of interleaved samples.
+ *  The bin boundaries of channel \c c are given by
+ *  <tt>[levels_first[c], levels_last[c])</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of interleaved samples.
+ *  \param last The end of the sequence of interleaved samples.
+ *  \param histograms The beginning of the bin counts of each active channel.
+ *  \param levels_first The beginning of the bin boundaries of each active channel.
+ *  \param levels_last The end of the bin boundaries of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved channels.
+ *  \tparam NumActiveChannels The number of leading channels to histogram.
+ *
+ *  \see \p histogram_range
+ */
+template<int NumChannels,
+         int NumActiveChannels,
+         typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  void multi_histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels]);
+
+
+/*! \p multi_histogram_range computes a \p histogram_range of each of the
+ *  first \p NumActiveChannels channels of a sequence of interleaved samples.
+ *
+ *  \see \p multi_histogram_range
+ */
+template<int NumChannels,
+         int NumActiveChannels,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  void multi_histogram_range(InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels]);
+
+
+/*! \} // end histograms
+ *  \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
+
@@ -236,6 +236,56 @@ template<typename T, typename Alloc = std::allocator<T> >
     host_vector(InputIterator first, InputIterator last, const Alloc &alloc)
       :Parent(first, last, alloc) {}
 
+    /*! This constructor creates a \p host_vector with default-constructed
+     *  elements, constructing them with the given execution policy.
+     *  \param exec The execution policy to use for constructing the elements,
+     *         e.g. \p thrust::omp::par to construct them in parallel.
+     *  \param n The number of elements to create.
+     *
+     *  The policy is used only if it can access the memory of \p Alloc and
+     *  \p Alloc does not construct elements with a \c construct member of
+     *  its own; otherwise the elements are constructed as if no policy was given.
+     */
+    template<typename DerivedPolicy>
+    __host__
+    host_vector(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n)
+      :Parent(exec, n) {}
+
+    /*! This constructor creates a \p host_vector with copies of an exemplar
+     *  element, constructing them with the given execution policy.
+     *  \param exec The execution policy to use for constructing the elements.
+     *  \param n The number of elements to initially create.
+     *  \param value An element to copy.
+     */
+    template<typename DerivedPolicy>
+    __host__
+    host_vector(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n, const value_type &value)
+      :Parent(exec, n, value) {}
+
+    /*! This constructor builds a \p host_vector from a range, copying it
+     *  with the given execution policy.
+     *  \param exec The execution policy to use for copying the range.
+     *  \param first The beginning of the range.
+     *  \param last The end of the range.
+     *
+     *  A range which \p exec cannot access, e.g. one in device memory, is
+     *  transferred as if no policy was given.
+     */
+    template<typename DerivedPolicy, typename InputIterator>
+    __host__
+    host_vector(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last)
+      :Parent(exec, first, last) {}
+
+    /*! Copy construct from a \p vector_base whose element type is convertible
+     *  to \c T, copying it with the given execution policy.
+     *  \param exec The execution policy to use for copying.
+     *  \param v The \p vector_base to copy.
+     */
+    template<typename DerivedPolicy, typename OtherT, typename OtherAlloc>
+    __host__
+    host_vector(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, const detail::vector_base<OtherT,OtherAlloc> &v)
+      :Parent(exec, v) {}
+
 // declare these members for the purpose of Doxygenating them
 // they actually exist in a derived-from class
 #if 0
@@ -251,6 +301,16 @@ template<typename T, typename Alloc = std::allocator<T> >
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements,
+     *  populating new elements with the given execution policy.
+     *  \param exec The execution policy to use for populating new elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \param x Data with which new elements should be populated.
+     *  \throw std::length_error If n exceeds max_size().
+     */
+    template<typename DerivedPolicy>
+    void resize(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type new_size, const value_type &x = value_type());
+
     /*! Returns the number of elements in this vector.
      */
     size_type size(void) const;
@@ -490,6 +550,22 @@ template<typename T, typename Alloc = std::allocator<T> >
     template<typename InputIterator>
     void assign(InputIterator first, InputIterator last);
 
+    /*! These versions of \p insert and \p assign perform their bulk operations
+     *  on elements with the given execution policy, e.g. \p thrust::omp::par.
+     *  \param exec The execution policy to use.
+     */
+    template<typename DerivedPolicy>
+    void insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, iterator position, size_type n, const T &x);
+
+    template<typename DerivedPolicy, typename InputIterator>
+    void insert(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, iterator position, InputIterator first, InputIterator last);
+
+    template<typename DerivedPolicy>
+    void assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, size_type n, const T &x);
+
+    template<typename DerivedPolicy, typename InputIterator>
+    void assign(const thrust::detail::execution_policy_base<DerivedPolicy> &exec, InputIterator first, InputIterator last);
+
     /*! This method returns a copy of this vector's allocator.
      *  \return A copy of the alloctor used by this vector.
      */
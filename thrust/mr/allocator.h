@@ -139,6 +139,20 @@ public:
         return mem_res->do_deallocate(p, n * sizeof(T), THRUST_ALIGNOF(T));
     }
 
+    /*! Attempts to resize the storage of objects of type \p T pointed to by \p p without moving it, with
+     *      \p try_expand of the memory resource.
+     *
+     *  \param p pointer returned by a previous call to \p allocate
+     *  \param n number of elements of the storage
+     *  \param new_n the requested number of elements. If this succeeds, \p new_n is to be passed to \p deallocate.
+     *  \return whether the storage was resized.
+     */
+    __host__
+    bool try_expand(pointer p, size_type n, size_type new_n)
+    {
+        return mem_res->do_try_expand(p, n * sizeof(T), new_n * sizeof(T), THRUST_ALIGNOF(T));
+    }
+
     /*! Extracts the memory resource used by this allocator.
      *
      *  \return the memory resource used by this allocator.
@@ -0,0 +1,306 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A bump-pointer memory resource adaptor which releases memory only as a whole, and uses separate upstream
+ *  resources for memory allocation and bookkeeping.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/algorithm_wrapper.h>
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/pointer.h>
+
+#include <thrust/host_vector.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/allocator.h>
+
+#include <cassert>
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor which hands out memory from chunks obtained from \p Upstream by bumping a pointer, and
+ *      never reuses deallocated memory on its own, using \p Bookkeeper for the list of chunks.
+ *
+ *  The allocation strategy is the same as the one of \p monotonic_buffer_resource: constant time allocation from
+ *      geometrically growing chunks, no-op deallocation, and a \p release which keeps the largest chunk for reuse.
+ *      Unlike \p monotonic_buffer_resource, this version never reads or writes the memory obtained from \p Upstream;
+ *      only the pointers it returns are offset. It therefore works for upstream resources returning memory
+ *      inaccessible from the host, such as non-managed device memory. The resource is not synchronized.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating chunks
+ *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template<typename Upstream, typename Bookkeeper>
+class disjoint_monotonic_buffer_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator2<Upstream, Bookkeeper>
+{
+    typedef typename Upstream::pointer void_ptr;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+    struct chunk_descriptor
+    {
+        std::size_t size;
+        std::size_t alignment;
+        void_ptr pointer;
+    };
+
+    typedef thrust::host_vector<
+        chunk_descriptor,
+        allocator<chunk_descriptor, Bookkeeper>
+    > chunk_vector;
+
+public:
+    /*! Get the default size of the first chunk allocated from upstream. This function is exposed so that the size of
+     *      following chunks can be predicted.
+     */
+    static std::size_t get_default_initial_chunk_size()
+    {
+        return static_cast<std::size_t>(1) << 12;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param bookkeeper the upstream memory resource for bookkeeping
+     *  \param initial_chunk_size the size of the first chunk allocated from \p upstream
+     */
+    disjoint_monotonic_buffer_resource(Upstream * upstream, Bookkeeper * bookkeeper,
+        std::size_t initial_chunk_size = get_default_initial_chunk_size())
+        : m_upstream(upstream),
+        m_bookkeeper(bookkeeper),
+        m_initial_buffer(),
+        m_initial_size(0),
+        m_current(),
+        m_remaining(0),
+        m_next_chunk_size(initial_chunk_size),
+        m_chunks(m_bookkeeper)
+    {
+        assert(initial_chunk_size > 0);
+    }
+
+    /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+     *
+     *  \param initial_chunk_size the size of the first chunk allocated from upstream
+     */
+    disjoint_monotonic_buffer_resource(std::size_t initial_chunk_size = get_default_initial_chunk_size())
+        : m_upstream(get_global_resource<Upstream>()),
+        m_bookkeeper(get_global_resource<Bookkeeper>()),
+        m_initial_buffer(),
+        m_initial_size(0),
+        m_current(),
+        m_remaining(0),
+        m_next_chunk_size(initial_chunk_size),
+        m_chunks(m_bookkeeper)
+    {
+        assert(initial_chunk_size > 0);
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it is exhausted; the first chunk allocated from
+     *      \p upstream after that is twice the size of \p buffer.
+     *
+     *  \param buffer the initial buffer, which must outlive the resource
+     *  \param buffer_size the size of \p buffer in bytes
+     *  \param upstream the upstream memory resource for allocations
+     *  \param bookkeeper the upstream memory resource for bookkeeping
+     */
+    disjoint_monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size,
+        Upstream * upstream, Bookkeeper * bookkeeper)
+        : m_upstream(upstream),
+        m_bookkeeper(bookkeeper),
+        m_initial_buffer(buffer),
+        m_initial_size(buffer_size),
+        m_current(static_cast<char_ptr>(buffer)),
+        m_remaining(buffer_size),
+        m_next_chunk_size((std::max)(buffer_size * 2, get_default_initial_chunk_size())),
+        m_chunks(m_bookkeeper)
+    {
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it is exhausted. Upstream and bookkeeping resources
+     *      are obtained by calling \p get_global_resource for their types.
+     *
+     *  \param buffer the initial buffer, which must outlive the resource
+     *  \param buffer_size the size of \p buffer in bytes
+     */
+    disjoint_monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size)
+        : m_upstream(get_global_resource<Upstream>()),
+        m_bookkeeper(get_global_resource<Bookkeeper>()),
+        m_initial_buffer(buffer),
+        m_initial_size(buffer_size),
+        m_current(static_cast<char_ptr>(buffer)),
+        m_remaining(buffer_size),
+        m_next_chunk_size((std::max)(buffer_size * 2, get_default_initial_chunk_size())),
+        m_chunks(m_bookkeeper)
+    {
+    }
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~disjoint_monotonic_buffer_resource()
+    {
+        for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        {
+            deallocate_chunk(m_chunks[i]);
+        }
+    }
+
+    /*! Releases all memory allocated from the resource at once. Every chunk but the largest one is returned to
+     *      upstream, and the largest one is kept and reused for the following allocations. If no chunk was allocated
+     *      from upstream, the resource rewinds to the start of its initial buffer.
+     */
+    void release()
+    {
+        if (m_chunks.empty())
+        {
+            m_current = static_cast<char_ptr>(m_initial_buffer);
+            m_remaining = m_initial_size;
+            return;
+        }
+
+        std::size_t largest = 0;
+        for (std::size_t i = 1; i < m_chunks.size(); ++i)
+        {
+            if (m_chunks[i].size > m_chunks[largest].size)
+            {
+                largest = i;
+            }
+        }
+
+        chunk_descriptor kept = m_chunks[largest];
+        for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        {
+            if (i != largest)
+            {
+                deallocate_chunk(m_chunks[i]);
+            }
+        }
+
+        m_chunks.clear();
+        m_chunks.push_back(kept);
+
+        m_current = static_cast<char_ptr>(kept.pointer);
+        m_remaining = kept.size;
+    }
+
+    /*! Returns the number of bytes held by the resource, in its initial buffer and in chunks allocated from upstream.
+     */
+    std::size_t capacity() const
+    {
+        std::size_t ret = m_initial_size;
+
+        for (std::size_t i = 0; i < m_chunks.size(); ++i)
+        {
+            ret += m_chunks[i].size;
+        }
+
+        return ret;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        // zero-sized requests still get a unique address
+        bytes = (std::max)(bytes, static_cast<std::size_t>(1));
+
+        std::size_t padding = padding_for(m_current, alignment);
+        if (detail::pointer_traits<char_ptr>::get(m_current) == 0 || padding + bytes > m_remaining)
+        {
+            allocate_chunk(bytes, alignment);
+            padding = 0;
+        }
+
+        char_ptr ret = m_current + padding;
+        m_current = ret + bytes;
+        m_remaining -= padding + bytes;
+
+        return static_cast<void_ptr>(ret);
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // memory is only reclaimed by release
+        (void)p;
+        (void)n;
+        (void)alignment;
+    }
+
+private:
+    static std::size_t padding_for(char_ptr p, std::size_t alignment)
+    {
+        std::size_t address = reinterpret_cast<std::size_t>(detail::pointer_traits<char_ptr>::get(p));
+        return (alignment - address % alignment) % alignment;
+    }
+
+    void allocate_chunk(std::size_t bytes, std::size_t alignment)
+    {
+        std::size_t size = m_next_chunk_size;
+        while (size < bytes)
+        {
+            size *= 2;
+        }
+
+        chunk_descriptor chunk;
+        chunk.size = size;
+        chunk.alignment = (std::max)(alignment, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT));
+        chunk.pointer = m_upstream->do_allocate(chunk.size, chunk.alignment);
+        m_chunks.push_back(chunk);
+
+        m_current = static_cast<char_ptr>(chunk.pointer);
+        m_remaining = size;
+        m_next_chunk_size = size * 2;
+    }
+
+    void deallocate_chunk(const chunk_descriptor & chunk)
+    {
+        m_upstream->do_deallocate(chunk.pointer, chunk.size, chunk.alignment);
+    }
+
+    Upstream * m_upstream;
+    Bookkeeper * m_bookkeeper;
+
+    void_ptr m_initial_buffer;
+    std::size_t m_initial_size;
+
+    // the next free byte of the current chunk, and the number of bytes left in it
+    char_ptr m_current;
+    std::size_t m_remaining;
+
+    std::size_t m_next_chunk_size;
+
+    // all chunks allocated from upstream
+    chunk_vector m_chunks;
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -64,6 +64,12 @@ namespace mr
  *      both the upstream and the bookkeeper are of the same type, to allocate memory consistently, but separately for
  *      those two purposes.
  *
+ *  Oversized and overaligned blocks are found in constant expected time on deallocation, through a hash index of their
+ *      addresses. When they are cached, a request is served from the smallest cached block that fits it, found in
+ *      logarithmic expected time, and the rest of that block, if big enough, stays cached as a separate block; blocks
+ *      returned to the pool are merged with their cached neighbors from the same upstream allocation, so that many
+ *      differently sized large temporaries don't fragment the cache.
+ *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the user
  *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
  */
@@ -96,6 +102,9 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.size_classes_per_doubling = 1;
+        ret.idle_bytes_trim_threshold = 0;
+
         return ret;
     }
 
@@ -113,8 +122,13 @@ public:
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
-        m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized_blocks(m_bookkeeper),
+        m_free_oversized_slot(no_block),
+        m_oversized_index(m_bookkeeper),
+        m_indexed_oversized_count(0),
+        m_cached_oversized_root(no_block),
+        m_largest_oversized_alignment(0),
+        m_treap_seed(1)
     {
         assert(m_options.validate());
 
@@ -136,8 +150,13 @@ public:
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
-        m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized_blocks(m_bookkeeper),
+        m_free_oversized_slot(no_block),
+        m_oversized_index(m_bookkeeper),
+        m_indexed_oversized_count(0),
+        m_cached_oversized_root(no_block),
+        m_largest_oversized_alignment(0),
+        m_treap_seed(1)
     {
         assert(m_options.validate());
 
@@ -168,66 +187,43 @@ private:
         allocator<chunk_descriptor, Bookkeeper>
     > chunk_vector;
 
-    struct oversized_block_descriptor
+    static const std::size_t no_block = static_cast<std::size_t>(-1);
+
+    // an oversized/overaligned block, stored in a slot of m_oversized_blocks; the blocks of an upstream allocation
+    // tile it and are linked in address order, so that a block is split when a bigger cached block is reused for it,
+    // and coalesced with cached neighbors when returned to the pool
+    struct oversized_block
     {
+        // zero for an unused slot
         std::size_t size;
         std::size_t alignment;
         void_ptr pointer;
 
-        __host__ __device__
-        bool operator==(const oversized_block_descriptor & other) const
-        {
-            return size == other.size && alignment == other.alignment && pointer == other.pointer;
-        }
+        // the neighbors in the same upstream allocation
+        std::size_t previous;
+        std::size_t next;
 
-        __host__ __device__
-        bool operator<(const oversized_block_descriptor & other) const
-        {
-            return size < other.size || (size == other.size && alignment < other.alignment);
-        }
-    };
-
-    struct equal_pointers
-    {
-    public:
-        __host__ __device__
-        equal_pointers(void_ptr p) : p(p)
-        {
-        }
+        // the next block in the same bucket of the address index, or the next unused slot
+        std::size_t next_in_bucket;
 
-        __host__ __device__
-        bool operator()(const oversized_block_descriptor & desc) const
-        {
-            return desc.pointer == p;
-        }
+        // the children and the priority in the treap of cached blocks
+        std::size_t left;
+        std::size_t right;
+        std::size_t priority;
 
-    private:
-        void_ptr p;
-    };
-
-    struct matching_alignment
-    {
-    public:
-        __host__ __device__
-        matching_alignment(std::size_t requested) : requested(requested)
-        {
-        }
-
-        __host__ __device__
-        bool operator()(const oversized_block_descriptor & desc) const
-        {
-            return desc.alignment >= requested;
-        }
-
-    private:
-        std::size_t requested;
+        bool cached;
     };
 
     typedef thrust::host_vector<
-        oversized_block_descriptor,
-        allocator<oversized_block_descriptor, Bookkeeper>
+        oversized_block,
+        allocator<oversized_block, Bookkeeper>
     > oversized_block_vector;
 
+    typedef thrust::host_vector<
+        std::size_t,
+        allocator<std::size_t, Bookkeeper>
+    > index_vector;
+
     typedef thrust::host_vector<
         void_ptr,
         allocator<void_ptr, Bookkeeper>
@@ -275,10 +271,16 @@ private:
     pool_vector m_pools;
     // list of all allocations from upstream for the above
     chunk_vector m_allocated;
-    // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-    oversized_block_vector m_cached_oversized;
-    // list of all oversized/overaligned allocations from upstream
-    oversized_block_vector m_oversized;
+    // slots of all oversized/overaligned blocks, in use or cached, and the head of the list of unused slots
+    oversized_block_vector m_oversized_blocks;
+    std::size_t m_free_oversized_slot;
+    // buckets of the hash index of the blocks in use by address, for lookup on deallocation
+    index_vector m_oversized_index;
+    std::size_t m_indexed_oversized_count;
+    // the root of the treap of cached blocks, ordered by alignment and size, for best fit lookup
+    std::size_t m_cached_oversized_root;
+    std::size_t m_largest_oversized_alignment;
+    std::size_t m_treap_seed;
 
 public:
     /*! Releases all held memory to upstream.
@@ -301,18 +303,31 @@ public:
                 m_options.alignment);
         }
 
-        // deallocate cached oversized/overaligned memory
-        for (std::size_t i = 0; i < m_oversized.size(); ++i)
+        // deallocate oversized/overaligned memory, an upstream allocation being the sum of its blocks
+        for (std::size_t i = 0; i < m_oversized_blocks.size(); ++i)
         {
-            m_upstream->do_deallocate(
-                m_oversized[i].pointer,
-                m_oversized[i].size,
-                m_oversized[i].alignment);
+            const oversized_block & first = m_oversized_blocks[i];
+            if (first.size == 0 || first.previous != no_block)
+            {
+                continue;
+            }
+
+            std::size_t size = first.size;
+            for (std::size_t j = first.next; j != no_block; j = m_oversized_blocks[j].next)
+            {
+                size += m_oversized_blocks[j].size;
+            }
+
+            m_upstream->do_deallocate(first.pointer, size, first.alignment);
         }
 
         m_allocated.clear();
-        m_oversized.clear();
-        m_cached_oversized.clear();
+        m_oversized_blocks.clear();
+        m_free_oversized_slot = no_block;
+        m_oversized_index.clear();
+        m_indexed_oversized_count = 0;
+        m_cached_oversized_root = no_block;
+        m_largest_oversized_alignment = 0;
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -323,60 +338,55 @@ public:
         // an oversized and/or overaligned allocation requested; needs to be allocated separately
         if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
         {
-            oversized_block_descriptor oversized;
-            oversized.size = bytes;
-            oversized.alignment = alignment;
-
-            if (m_options.cache_oversized && !m_cached_oversized.empty())
+            if (m_options.cache_oversized && m_cached_oversized_root != no_block)
             {
-                typename oversized_block_vector::iterator it = thrust::lower_bound(
-                    thrust::seq,
-                    m_cached_oversized.begin(),
-                    m_cached_oversized.end(),
-                    oversized);
-
-                // if the size is bigger than the requested size by a factor
-                // bigger than or equal to the specified cutoff for size,
-                // allocate a new block
-                if (it != m_cached_oversized.end())
-                {
-                    std::size_t size_factor = (*it).size / bytes;
-                    if (size_factor >= m_options.cached_size_cutoff_factor)
-                    {
-                        it = m_cached_oversized.end();
-                    }
-                }
+                std::size_t slot = find_cached(bytes, alignment);
 
-                if (it != m_cached_oversized.end() && (*it).alignment < alignment)
+                if (slot != no_block)
                 {
-                    it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-                }
+                    m_cached_oversized_root = treap_erase(m_cached_oversized_root, slot);
+                    m_oversized_blocks[slot].cached = false;
 
-                // if the alignment is bigger than the requested one by a factor
-                // bigger than or equal to the specified cutoff for alignment,
-                // allocate a new block
-                if (it != m_cached_oversized.end())
-                {
-                    std::size_t alignment_factor = (*it).alignment / alignment;
-                    if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+                    // split off the rest of the block if it is big enough to serve oversized requests by itself;
+                    // the split keeps the alignment of the allocation
+                    std::size_t block_size = m_oversized_blocks[slot].size;
+                    std::size_t block_alignment = m_oversized_blocks[slot].alignment;
+                    std::size_t used = bytes + (block_alignment - bytes % block_alignment) % block_alignment;
+
+                    if (used < block_size && block_size - used >= m_options.largest_block_size)
                     {
-                        it = m_cached_oversized.end();
+                        std::size_t next = m_oversized_blocks[slot].next;
+                        std::size_t rest = new_oversized_block(
+                            block_size - used,
+                            block_alignment,
+                            static_cast<void_ptr>(static_cast<char_ptr>(m_oversized_blocks[slot].pointer) + used),
+                            slot,
+                            next);
+
+                        if (next != no_block)
+                        {
+                            m_oversized_blocks[next].previous = rest;
+                        }
+                        m_oversized_blocks[slot].next = rest;
+                        m_oversized_blocks[slot].size = used;
+
+                        cache(rest);
                     }
-                }
 
-                if (it != m_cached_oversized.end())
-                {
-                    oversized.pointer = (*it).pointer;
-                    m_cached_oversized.erase(it);
-                    return oversized.pointer;
+                    index_insert(slot);
+                    return m_oversized_blocks[slot].pointer;
                 }
             }
 
             // no fitting cached block found; allocate a new one that's just up to the specs
-            oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-            m_oversized.push_back(oversized);
+            void_ptr allocated = m_upstream->do_allocate(bytes, alignment);
+
+            std::size_t slot = new_oversized_block(bytes, alignment, allocated, no_block, no_block);
+            index_insert(slot);
 
-            return oversized.pointer;
+            m_largest_oversized_alignment = (std::max)(m_largest_oversized_alignment, alignment);
+
+            return allocated;
         }
 
         // the request is NOT for oversized and/or overaligned memory
@@ -453,21 +463,39 @@ public:
         // the deallocated block is oversized and/or overaligned
         if (n > m_options.largest_block_size || alignment > m_options.alignment)
         {
-            typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-            assert(it != m_oversized.end());
-
-            oversized_block_descriptor oversized = *it;
+            std::size_t slot = index_remove(p);
+            assert(slot != no_block);
 
-            if (m_options.cache_oversized)
+            if (!m_options.cache_oversized)
             {
-                typename oversized_block_vector::iterator position = lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-                m_cached_oversized.insert(position, oversized);
+                // blocks are only split when reused from the cache, so this one is a whole upstream allocation
+                std::size_t size = m_oversized_blocks[slot].size;
+                std::size_t block_alignment = m_oversized_blocks[slot].alignment;
+                void_ptr pointer = m_oversized_blocks[slot].pointer;
+                free_oversized_block(slot);
+
+                m_upstream->do_deallocate(pointer, size, block_alignment);
+
                 return;
             }
 
-            m_oversized.erase(it);
+            // coalesce the block with the cached blocks next to it in the same allocation
+            std::size_t next = m_oversized_blocks[slot].next;
+            if (next != no_block && m_oversized_blocks[next].cached)
+            {
+                m_cached_oversized_root = treap_erase(m_cached_oversized_root, next);
+                absorb_next(slot);
+            }
 
-            m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+            std::size_t previous = m_oversized_blocks[slot].previous;
+            if (previous != no_block && m_oversized_blocks[previous].cached)
+            {
+                m_cached_oversized_root = treap_erase(m_cached_oversized_root, previous);
+                absorb_next(previous);
+                slot = previous;
+            }
+
+            cache(slot);
 
             return;
         }
@@ -479,6 +507,280 @@ public:
 
         bucket.free_blocks.push_back(p);
     }
+
+private:
+    std::size_t new_oversized_block(std::size_t size, std::size_t alignment, void_ptr pointer,
+        std::size_t previous, std::size_t next)
+    {
+        oversized_block block;
+        block.size = size;
+        block.alignment = alignment;
+        block.pointer = pointer;
+        block.previous = previous;
+        block.next = next;
+        block.next_in_bucket = no_block;
+        block.left = no_block;
+        block.right = no_block;
+        block.priority = 0;
+        block.cached = false;
+
+        if (m_free_oversized_slot == no_block)
+        {
+            m_oversized_blocks.push_back(block);
+            return m_oversized_blocks.size() - 1;
+        }
+
+        std::size_t slot = m_free_oversized_slot;
+        m_free_oversized_slot = m_oversized_blocks[slot].next_in_bucket;
+        m_oversized_blocks[slot] = block;
+        return slot;
+    }
+
+    void free_oversized_block(std::size_t slot)
+    {
+        m_oversized_blocks[slot].size = 0;
+        m_oversized_blocks[slot].pointer = void_ptr();
+        m_oversized_blocks[slot].next_in_bucket = m_free_oversized_slot;
+        m_free_oversized_slot = slot;
+    }
+
+    // merges the block following the given one in its allocation into it
+    void absorb_next(std::size_t slot)
+    {
+        std::size_t next = m_oversized_blocks[slot].next;
+        std::size_t after = m_oversized_blocks[next].next;
+
+        m_oversized_blocks[slot].size += m_oversized_blocks[next].size;
+        m_oversized_blocks[slot].next = after;
+        if (after != no_block)
+        {
+            m_oversized_blocks[after].previous = slot;
+        }
+
+        free_oversized_block(next);
+    }
+
+    std::size_t index_bucket(void_ptr p) const
+    {
+        std::size_t hash = static_cast<std::size_t>(
+            reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p)));
+        hash ^= hash >> 17;
+        hash *= static_cast<std::size_t>(0x9e3779b97f4a7c15ull);
+        hash ^= hash >> 31;
+        return hash & (m_oversized_index.size() - 1);
+    }
+
+    void index_insert(std::size_t slot)
+    {
+        if (m_indexed_oversized_count >= m_oversized_index.size())
+        {
+            const std::size_t empty_bucket = no_block;
+
+            index_vector index(m_bookkeeper);
+            index.resize((std::max)(m_oversized_index.size() * 2, static_cast<std::size_t>(64)), empty_bucket);
+            m_oversized_index.swap(index);
+
+            for (std::size_t i = 0; i < index.size(); ++i)
+            {
+                for (std::size_t j = index[i]; j != no_block;)
+                {
+                    std::size_t next = m_oversized_blocks[j].next_in_bucket;
+                    std::size_t bucket = index_bucket(m_oversized_blocks[j].pointer);
+                    m_oversized_blocks[j].next_in_bucket = m_oversized_index[bucket];
+                    m_oversized_index[bucket] = j;
+                    j = next;
+                }
+            }
+        }
+
+        std::size_t bucket = index_bucket(m_oversized_blocks[slot].pointer);
+        m_oversized_blocks[slot].next_in_bucket = m_oversized_index[bucket];
+        m_oversized_index[bucket] = slot;
+        ++m_indexed_oversized_count;
+    }
+
+    // finds the block in use starting at the given pointer and removes it from the index
+    std::size_t index_remove(void_ptr p)
+    {
+        if (m_oversized_index.empty())
+        {
+            return no_block;
+        }
+
+        std::size_t * link = &m_oversized_index[index_bucket(p)];
+        while (*link != no_block && !(m_oversized_blocks[*link].pointer == p))
+        {
+            link = &m_oversized_blocks[*link].next_in_bucket;
+        }
+
+        std::size_t slot = *link;
+        if (slot != no_block)
+        {
+            *link = m_oversized_blocks[slot].next_in_bucket;
+            --m_indexed_oversized_count;
+        }
+
+        return slot;
+    }
+
+    // the order of cached blocks in the treap: by alignment, then by size, then by slot
+    bool cached_less(std::size_t lhs, std::size_t rhs) const
+    {
+        const oversized_block & l = m_oversized_blocks[lhs];
+        const oversized_block & r = m_oversized_blocks[rhs];
+
+        if (l.alignment != r.alignment)
+        {
+            return l.alignment < r.alignment;
+        }
+        if (l.size != r.size)
+        {
+            return l.size < r.size;
+        }
+        return lhs < rhs;
+    }
+
+    void cache(std::size_t slot)
+    {
+        // xorshift, so that the treap stays balanced in expectation
+        m_treap_seed ^= m_treap_seed << 13;
+        m_treap_seed ^= m_treap_seed >> 7;
+        m_treap_seed ^= m_treap_seed << 17;
+
+        oversized_block & block = m_oversized_blocks[slot];
+        block.cached = true;
+        block.left = no_block;
+        block.right = no_block;
+        block.priority = m_treap_seed;
+
+        m_cached_oversized_root = treap_insert(m_cached_oversized_root, slot);
+    }
+
+    std::size_t treap_insert(std::size_t root, std::size_t slot)
+    {
+        if (root == no_block)
+        {
+            return slot;
+        }
+
+        if (cached_less(slot, root))
+        {
+            std::size_t child = treap_insert(m_oversized_blocks[root].left, slot);
+            m_oversized_blocks[root].left = child;
+
+            if (m_oversized_blocks[child].priority > m_oversized_blocks[root].priority)
+            {
+                m_oversized_blocks[root].left = m_oversized_blocks[child].right;
+                m_oversized_blocks[child].right = root;
+                return child;
+            }
+        }
+        else
+        {
+            std::size_t child = treap_insert(m_oversized_blocks[root].right, slot);
+            m_oversized_blocks[root].right = child;
+
+            if (m_oversized_blocks[child].priority > m_oversized_blocks[root].priority)
+            {
+                m_oversized_blocks[root].right = m_oversized_blocks[child].left;
+                m_oversized_blocks[child].left = root;
+                return child;
+            }
+        }
+
+        return root;
+    }
+
+    std::size_t treap_merge(std::size_t lhs, std::size_t rhs)
+    {
+        if (lhs == no_block)
+        {
+            return rhs;
+        }
+        if (rhs == no_block)
+        {
+            return lhs;
+        }
+
+        if (m_oversized_blocks[lhs].priority > m_oversized_blocks[rhs].priority)
+        {
+            m_oversized_blocks[lhs].right = treap_merge(m_oversized_blocks[lhs].right, rhs);
+            return lhs;
+        }
+
+        m_oversized_blocks[rhs].left = treap_merge(lhs, m_oversized_blocks[rhs].left);
+        return rhs;
+    }
+
+    std::size_t treap_erase(std::size_t root, std::size_t slot)
+    {
+        assert(root != no_block);
+
+        if (root == slot)
+        {
+            std::size_t ret = treap_merge(m_oversized_blocks[slot].left, m_oversized_blocks[slot].right);
+            m_oversized_blocks[slot].cached = false;
+            return ret;
+        }
+
+        if (cached_less(slot, root))
+        {
+            m_oversized_blocks[root].left = treap_erase(m_oversized_blocks[root].left, slot);
+        }
+        else
+        {
+            m_oversized_blocks[root].right = treap_erase(m_oversized_blocks[root].right, slot);
+        }
+
+        return root;
+    }
+
+    // finds the smallest cached block which can serve the request, not bigger or more aligned than the cutoff factors
+    // allow; looks up every alignment from the requested one up to the cutoff once
+    std::size_t find_cached(std::size_t bytes, std::size_t alignment) const
+    {
+        std::size_t best = no_block;
+
+        for (std::size_t candidate_alignment = alignment;
+            candidate_alignment <= m_largest_oversized_alignment
+                && candidate_alignment / alignment < m_options.cached_alignment_cutoff_factor;
+            candidate_alignment <<= 1)
+        {
+            // the first cached block not ordered before (candidate_alignment, bytes)
+            std::size_t found = no_block;
+            for (std::size_t node = m_cached_oversized_root; node != no_block;)
+            {
+                const oversized_block & block = m_oversized_blocks[node];
+                if (block.alignment > candidate_alignment
+                    || (block.alignment == candidate_alignment && block.size >= bytes))
+                {
+                    found = node;
+                    node = block.left;
+                }
+                else
+                {
+                    node = block.right;
+                }
+            }
+
+            if (found == no_block || m_oversized_blocks[found].alignment != candidate_alignment)
+            {
+                continue;
+            }
+
+            if (m_oversized_blocks[found].size / bytes >= m_options.cached_size_cutoff_factor)
+            {
+                continue;
+            }
+
+            if (best == no_block || m_oversized_blocks[found].size < m_oversized_blocks[best].size)
+            {
+                best = found;
+            }
+        }
+
+        return best;
+    }
 };
 
 /*! \} // memory_resource
@@ -0,0 +1,229 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource that allocates page-locked host memory without any device runtime.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/pinned_pool.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cstddef>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define THRUST_MR_LOCKED_HOST_RESOURCE_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef THRUST_MR_LOCKED_HOST_RESOURCE_NOMINMAX
+#undef NOMINMAX
+#undef THRUST_MR_LOCKED_HOST_RESOURCE_NOMINMAX
+#endif
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource that allocates whole pages of host memory directly from the operating system and locks them
+ *      into physical memory, with \p mlock (\p VirtualLock on Windows).
+ *
+ *  Locked pages cannot be swapped out, which is what device runtimes require of host memory used for asynchronous
+ *      transfers. This resource does not register the memory with any device runtime, so it does not make transfers
+ *      faster by itself; it is the host-only stand-in for pinned memory resources such as
+ *      <tt>hip::universal_host_pinned_memory_resource</tt>, with the same cost structure: every allocation is a
+ *      system call, and the amount of memory that may be locked is limited (see \p RLIMIT_MEMLOCK). It is therefore
+ *      meant to be used as the upstream of a \p pinned_pool_resource.
+ *
+ *  Allocation sizes are rounded up to whole pages. An allocation which cannot be locked fails with \p bad_alloc.
+ */
+class locked_host_resource final : public memory_resource<>
+{
+public:
+    /*! Get the size of a page, the granularity of allocations of this resource.
+     */
+    static std::size_t page_size()
+    {
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<std::size_t>(info.dwPageSize);
+#else
+        return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    THRUST_NODISCARD void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        const std::size_t page = page_size();
+        bytes = round_up(bytes == 0 ? 1 : bytes, page);
+
+        // pages are the natural alignment; larger alignments are obtained by over-allocating and trimming the ends
+        const std::size_t extra = alignment > page ? alignment - page : 0;
+
+#if defined(_WIN32)
+        // VirtualAlloc returns memory aligned to the allocation granularity, which can only be trimmed as a whole
+        if (alignment > 65536)
+        {
+            throw thrust::system::detail::bad_alloc("locked_host_resource: unsupported alignment");
+        }
+        (void)extra;
+
+        void * p = VirtualAlloc(NULL, bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+        if (p == NULL)
+        {
+            throw thrust::system::detail::bad_alloc("locked_host_resource: VirtualAlloc failed");
+        }
+
+        if (!VirtualLock(p, bytes))
+        {
+            VirtualFree(p, 0, MEM_RELEASE);
+            throw thrust::system::detail::bad_alloc("locked_host_resource: VirtualLock failed");
+        }
+
+        return p;
+#else
+        void * mapped = mmap(NULL, bytes + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            throw thrust::system::detail::bad_alloc("locked_host_resource: mmap failed");
+        }
+
+        char * p = static_cast<char *>(mapped);
+        if (extra)
+        {
+            char * aligned = reinterpret_cast<char *>(round_up(reinterpret_cast<std::size_t>(p), alignment));
+            std::size_t head = aligned - p;
+            std::size_t tail = extra - head;
+
+            if (head)
+            {
+                munmap(p, head);
+            }
+            if (tail)
+            {
+                munmap(aligned + bytes, tail);
+            }
+
+            p = aligned;
+        }
+
+        if (mlock(p, bytes) != 0)
+        {
+            munmap(p, bytes);
+            throw thrust::system::detail::bad_alloc("locked_host_resource: mlock failed");
+        }
+
+        return p;
+#endif
+    }
+
+    void do_deallocate(void * p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        (void)alignment;
+
+#if defined(_WIN32)
+        (void)bytes;
+
+        VirtualFree(p, 0, MEM_RELEASE);
+#else
+        bytes = round_up(bytes == 0 ? 1 : bytes, page_size());
+
+        // unmapping the pages also unlocks them
+        munmap(p, bytes);
+#endif
+    }
+
+    /*! Resizes an allocation in place. Allocations shrink by unmapping their trailing pages. On Linux, they grow by
+     *      remapping them over the pages which follow them, if those are free, and locking the new pages.
+     */
+    bool do_try_expand(void * p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+    {
+        (void)alignment;
+
+        const std::size_t page = page_size();
+        bytes = round_up(bytes == 0 ? 1 : bytes, page);
+        new_bytes = round_up(new_bytes == 0 ? 1 : new_bytes, page);
+
+        if (new_bytes == bytes)
+        {
+            return true;
+        }
+
+#if defined(_WIN32)
+        (void)p;
+        return false;
+#else
+        char * begin = static_cast<char *>(p);
+
+        if (new_bytes < bytes)
+        {
+            // unmapping the trailing pages also unlocks them
+            return munmap(begin + new_bytes, bytes - new_bytes) == 0;
+        }
+
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+        // without MREMAP_MAYMOVE, the mapping is only extended if the following pages are free
+        if (mremap(p, bytes, new_bytes, 0) == MAP_FAILED)
+        {
+            return false;
+        }
+
+        if (mlock(begin + bytes, new_bytes - bytes) != 0)
+        {
+            munmap(begin + bytes, new_bytes - bytes);
+            return false;
+        }
+
+        return true;
+#else
+        return false;
+#endif
+#endif
+    }
+
+private:
+    static std::size_t round_up(std::size_t n, std::size_t granularity)
+    {
+        return (n + granularity - 1) / granularity * granularity;
+    }
+};
+
+/*! A pool of host memory locked with \p mlock, usable without a device runtime. On systems with a device, prefer the
+ *      pinned pool of the device system, e.g. <tt>hip::universal_host_pinned_pool_resource</tt>, which also registers
+ *      the memory with the runtime.
+ */
+typedef pinned_pool_resource<locked_host_resource> locked_host_pool_resource;
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
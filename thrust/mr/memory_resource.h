@@ -94,6 +94,21 @@ public:
         return do_is_equal(other);
     }
 
+    /*! Attempts to resize the allocation pointed to by \p p without moving it. If this succeeds, the allocation has
+     *      to be deallocated with a size of \p new_bytes.
+     *
+     *  \param p pointer to the allocation
+     *  \param bytes the current size of the allocation
+     *  \param new_bytes the requested size of the allocation
+     *  \param alignment the alignment of the allocation
+     *  \return whether the allocation was resized.
+     */
+    bool try_expand(pointer p, std::size_t bytes, std::size_t new_bytes,
+        std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+    {
+        return do_try_expand(p, bytes, new_bytes, alignment);
+    }
+
     /*! Allocates memory of size at least \p bytes and alignment at least \p alignment.
      *
      *  \param bytes size, in bytes, that is requested from this allocation
@@ -124,6 +139,21 @@ public:
     {
         return this == &other;
     }
+
+    /*! Attempts to resize the allocation pointed to by \p p without moving it. The default implementation never
+     *      succeeds; resources which can grow allocations in place, e.g. by remapping pages, override it.
+     *
+     *  \param p pointer to the allocation
+     *  \param bytes the current size of the allocation
+     *  \param new_bytes the requested size of the allocation
+     *  \param alignment the alignment of the allocation
+     *  \return whether the allocation was resized.
+     */
+    virtual bool do_try_expand(pointer p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment)
+    {
+        (void)p; (void)bytes; (void)new_bytes; (void)alignment;
+        return false;
+    }
 };
 
 template<>
@@ -154,6 +184,12 @@ public:
         return do_is_equal(other);
     }
 
+    bool try_expand(pointer p, std::size_t bytes, std::size_t new_bytes,
+        std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+    {
+        return do_try_expand(p, bytes, new_bytes, alignment);
+    }
+
     virtual pointer do_allocate(std::size_t bytes, std::size_t alignment) = 0;
     virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment) = 0;
     __host__ __device__
@@ -161,6 +197,11 @@ public:
     {
         return this == &other;
     }
+    virtual bool do_try_expand(pointer p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment)
+    {
+        (void)p; (void)bytes; (void)new_bytes; (void)alignment;
+        return false;
+    }
 
 #ifdef THRUST_STD_MR_NS
     // the above do_is_equal is a different function than the one from the standard memory resource
@@ -0,0 +1,336 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A bump-pointer memory resource adaptor which releases memory only as a whole, and embeds bookkeeping
+ *  information in the chunks it allocates.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/algorithm_wrapper.h>
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/raw_reference_cast.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor which hands out memory from chunks obtained from \p Upstream by bumping a pointer, and
+ *      never reuses deallocated memory on its own.
+ *
+ *  Allocation is constant time: it aligns and advances a pointer into the current chunk, and only when the chunk is
+ *      exhausted asks \p Upstream for a new one, each new chunk being twice as large as the previous one (or larger, if
+ *      a single request requires it). Deallocation does nothing. All memory is reclaimed at once by \p release, which
+ *      returns every chunk but the largest one to upstream and rewinds the resource to the start of the kept chunk, so
+ *      that a workload repeated after each \p release soon stops touching the upstream resource at all. This suits
+ *      code which makes a burst of short-lived allocations and frees all of them at the same point, like the
+ *      temporaries of a single request.
+ *
+ *  The resource may also be given an initial buffer, which is used before any memory is requested from upstream and
+ *      is never deallocated by the resource.
+ *
+ *  This version embeds a small descriptor at the end of every chunk, and therefore requires that memory allocated
+ *      from \p Upstream is accessible from the host. For upstream resources returning memory that is not, use
+ *      \p disjoint_monotonic_buffer_resource. The resource is not synchronized.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating chunks
+ */
+template<typename Upstream>
+class monotonic_buffer_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+    typedef typename Upstream::pointer void_ptr;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+    struct chunk_descriptor;
+
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<chunk_descriptor>::other chunk_descriptor_ptr;
+
+    struct chunk_descriptor
+    {
+        std::size_t size;
+        std::size_t alignment;
+        chunk_descriptor_ptr next;
+    };
+
+public:
+    /*! Get the default size of the first chunk allocated from upstream. This function is exposed so that the size of
+     *      following chunks can be predicted.
+     */
+    static std::size_t get_default_initial_chunk_size()
+    {
+        return static_cast<std::size_t>(1) << 12;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param initial_chunk_size the size of the first chunk allocated from \p upstream
+     */
+    monotonic_buffer_resource(Upstream * upstream, std::size_t initial_chunk_size = get_default_initial_chunk_size())
+        : m_upstream(upstream),
+        m_initial_buffer(),
+        m_initial_size(0),
+        m_current(),
+        m_remaining(0),
+        m_next_chunk_size(initial_chunk_size),
+        m_chunks()
+    {
+        assert(initial_chunk_size > 0);
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param initial_chunk_size the size of the first chunk allocated from upstream
+     */
+    monotonic_buffer_resource(std::size_t initial_chunk_size = get_default_initial_chunk_size())
+        : m_upstream(get_global_resource<Upstream>()),
+        m_initial_buffer(),
+        m_initial_size(0),
+        m_current(),
+        m_remaining(0),
+        m_next_chunk_size(initial_chunk_size),
+        m_chunks()
+    {
+        assert(initial_chunk_size > 0);
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it is exhausted; the first chunk allocated from
+     *      \p upstream after that is twice the size of \p buffer.
+     *
+     *  \param buffer the initial buffer, which must outlive the resource
+     *  \param buffer_size the size of \p buffer in bytes
+     *  \param upstream the upstream memory resource for allocations
+     */
+    monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size, Upstream * upstream)
+        : m_upstream(upstream),
+        m_initial_buffer(buffer),
+        m_initial_size(buffer_size),
+        m_current(static_cast<char_ptr>(buffer)),
+        m_remaining(buffer_size),
+        m_next_chunk_size((std::max)(buffer_size * 2, get_default_initial_chunk_size())),
+        m_chunks()
+    {
+    }
+
+    /*! Constructor. Allocations are served from \p buffer until it is exhausted. The upstream resource is obtained by
+     *      calling \p get_global_resource<Upstream>.
+     *
+     *  \param buffer the initial buffer, which must outlive the resource
+     *  \param buffer_size the size of \p buffer in bytes
+     */
+    monotonic_buffer_resource(void_ptr buffer, std::size_t buffer_size)
+        : m_upstream(get_global_resource<Upstream>()),
+        m_initial_buffer(buffer),
+        m_initial_size(buffer_size),
+        m_current(static_cast<char_ptr>(buffer)),
+        m_remaining(buffer_size),
+        m_next_chunk_size((std::max)(buffer_size * 2, get_default_initial_chunk_size())),
+        m_chunks()
+    {
+    }
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~monotonic_buffer_resource()
+    {
+        release_chunks(false);
+    }
+
+    /*! Releases all memory allocated from the resource at once. Every chunk but the largest one is returned to
+     *      upstream, and the largest one is kept and reused for the following allocations. If no chunk was allocated
+     *      from upstream, the resource rewinds to the start of its initial buffer.
+     */
+    void release()
+    {
+        release_chunks(true);
+    }
+
+    /*! Returns the number of bytes held by the resource, in its initial buffer and in chunks allocated from upstream.
+     */
+    std::size_t capacity() const
+    {
+        std::size_t ret = m_initial_size;
+
+        for (chunk_descriptor_ptr chunk = m_chunks;
+            detail::pointer_traits<chunk_descriptor_ptr>::get(chunk);
+            chunk = thrust::raw_reference_cast(*chunk).next)
+        {
+            ret += thrust::raw_reference_cast(*chunk).size;
+        }
+
+        return ret;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(detail::is_power_of_2(alignment));
+
+        // zero-sized requests still get a unique address
+        bytes = (std::max)(bytes, static_cast<std::size_t>(1));
+
+        std::size_t padding = padding_for(m_current, alignment);
+        if (detail::pointer_traits<char_ptr>::get(m_current) == 0 || padding + bytes > m_remaining)
+        {
+            allocate_chunk(bytes, alignment);
+            padding = 0;
+        }
+
+        char_ptr ret = m_current + padding;
+        m_current = ret + bytes;
+        m_remaining -= padding + bytes;
+
+        return static_cast<void_ptr>(ret);
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // memory is only reclaimed by release
+        (void)p;
+        (void)n;
+        (void)alignment;
+    }
+
+private:
+    static std::size_t padding_for(char_ptr p, std::size_t alignment)
+    {
+        std::size_t address = reinterpret_cast<std::size_t>(detail::pointer_traits<char_ptr>::get(p));
+        return (alignment - address % alignment) % alignment;
+    }
+
+    void allocate_chunk(std::size_t bytes, std::size_t alignment)
+    {
+        std::size_t size = m_next_chunk_size;
+        while (size < bytes)
+        {
+            size *= 2;
+        }
+
+        // keep the descriptor at the end of the chunk aligned
+        size += (THRUST_MR_DEFAULT_ALIGNMENT - size % THRUST_MR_DEFAULT_ALIGNMENT) % THRUST_MR_DEFAULT_ALIGNMENT;
+        alignment = (std::max)(alignment, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT));
+
+        void_ptr allocated = m_upstream->do_allocate(size + sizeof(chunk_descriptor), alignment);
+        chunk_descriptor_ptr chunk = static_cast<chunk_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(allocated) + size
+            )
+        );
+
+        chunk_descriptor desc;
+        desc.size = size;
+        desc.alignment = alignment;
+        desc.next = m_chunks;
+        *chunk = desc;
+        m_chunks = chunk;
+
+        m_current = static_cast<char_ptr>(allocated);
+        m_remaining = size;
+        m_next_chunk_size = size * 2;
+    }
+
+    void deallocate_chunk(chunk_descriptor_ptr chunk)
+    {
+        chunk_descriptor desc = *chunk;
+
+        void_ptr p = static_cast<void_ptr>(
+            static_cast<char_ptr>(
+                static_cast<void_ptr>(chunk)
+            ) - desc.size
+        );
+        m_upstream->do_deallocate(p, desc.size + sizeof(chunk_descriptor), desc.alignment);
+    }
+
+    void release_chunks(bool keep_largest)
+    {
+        chunk_descriptor_ptr largest = chunk_descriptor_ptr();
+        std::size_t largest_size = 0;
+
+        while (detail::pointer_traits<chunk_descriptor_ptr>::get(m_chunks))
+        {
+            chunk_descriptor_ptr chunk = m_chunks;
+            chunk_descriptor desc = *chunk;
+            m_chunks = desc.next;
+
+            if (keep_largest && desc.size > largest_size)
+            {
+                if (largest_size != 0)
+                {
+                    deallocate_chunk(largest);
+                }
+
+                largest = chunk;
+                largest_size = desc.size;
+            }
+            else
+            {
+                deallocate_chunk(chunk);
+            }
+        }
+
+        if (largest_size != 0)
+        {
+            chunk_descriptor desc = *largest;
+            desc.next = chunk_descriptor_ptr();
+            *largest = desc;
+            m_chunks = largest;
+
+            m_current = static_cast<char_ptr>(static_cast<void_ptr>(largest)) - largest_size;
+            m_remaining = largest_size;
+        }
+        else
+        {
+            m_current = static_cast<char_ptr>(m_initial_buffer);
+            m_remaining = m_initial_size;
+        }
+    }
+
+    Upstream * m_upstream;
+
+    void_ptr m_initial_buffer;
+    std::size_t m_initial_size;
+
+    // the next free byte of the current chunk, and the number of bytes left in it
+    char_ptr m_current;
+    std::size_t m_remaining;
+
+    std::size_t m_next_chunk_size;
+
+    // the list of chunks allocated from upstream, the current one first
+    chunk_descriptor_ptr m_chunks;
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,136 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A synchronized pooling memory resource adaptor for page-locked host memory, such as staging buffers of
+ *  host-device transfers.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/mr/disjoint_sync_pool.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool_options.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A mutex-synchronized pool of page-locked host memory obtained from \p Upstream.
+ *
+ *  Allocating page-locked memory, with \p hipHostMalloc or \p mlock, is a system call which is orders of magnitude
+ *      slower than \p malloc, and page-locked memory is a scarce resource. This adaptor requests it from \p Upstream
+ *      in large chunks, hands out blocks of the chunks and keeps returned blocks for reuse, so code which repeatedly
+ *      allocates staging buffers stops calling the upstream resource after warming up.
+ *
+ *  The pool is a \p disjoint_synchronized_pool_resource, so its bookkeeping lives in ordinary memory obtained from
+ *      \p Bookkeeper and none of the locked memory is spent on it. Its default options are tuned for staging buffers:
+ *      chunks are at least a megabyte, and blocks larger than that are allocated directly from upstream and cached.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating page-locked memory, e.g.
+ *      \p locked_host_resource, or <tt>hip::universal_host_pinned_memory_resource</tt>
+ *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template<typename Upstream, typename Bookkeeper = new_delete_resource>
+class pinned_pool_resource final : public memory_resource<typename Upstream::pointer>
+{
+    typedef disjoint_synchronized_pool_resource<Upstream, Bookkeeper> pool_type;
+
+    typedef typename Upstream::pointer void_ptr;
+
+public:
+    /*! Get the default options for a pinned pool. Blocks are handed out from chunks of at least a megabyte, so that
+     *      the first staging buffers of the usual sizes cost one upstream allocation. Larger blocks are allocated
+     *      directly from upstream and cached, and reused for requests at least a quarter of their size.
+     */
+    static pool_options get_default_options()
+    {
+        pool_options ret = pool_type::get_default_options();
+
+        ret.min_blocks_per_chunk = 1;
+        ret.min_bytes_per_chunk = static_cast<std::size_t>(1) << 20;
+
+        ret.smallest_block_size = static_cast<std::size_t>(1) << 12;
+        ret.largest_block_size = static_cast<std::size_t>(1) << 20;
+
+        ret.cache_oversized = true;
+        ret.cached_size_cutoff_factor = 4;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for page-locked allocations
+     *  \param bookkeeper the upstream memory resource for bookkeeping
+     *  \param options pool options to use
+     */
+    pinned_pool_resource(Upstream * upstream, Bookkeeper * bookkeeper,
+        pool_options options = get_default_options())
+        : m_pool(upstream, bookkeeper, options)
+    {
+    }
+
+    /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+     *
+     *  \param options pool options to use
+     */
+    pinned_pool_resource(pool_options options = get_default_options())
+        : m_pool(options)
+    {
+    }
+
+    /*! Releases all held memory to upstream.
+     */
+    void release()
+    {
+        m_pool.release();
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        return m_pool.do_allocate(bytes, alignment);
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        m_pool.do_deallocate(p, n, alignment);
+    }
+
+private:
+    pool_type m_pool;
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -48,6 +48,11 @@ public:
         return upstream_resource->is_equal(other);
     }
 
+    virtual bool do_try_expand(Pointer p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+    {
+        return upstream_resource->try_expand(p, bytes, new_bytes, alignment);
+    }
+
 private:
     memory_resource<Pointer> * upstream_resource;
 };
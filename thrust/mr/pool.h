@@ -62,6 +62,11 @@ namespace mr
  *      efficient than the disjoint version, which wouldn't need to touch device memory at all, and therefore wouldn't need
  *      to transfer it back and forth between the host and the device whenever an allocation or a deallocation happens.
  *
+ *  Memory is only returned to upstream when it is not in use: \p trim returns the chunks none of whose blocks are
+ *      allocated, along with the cached oversized blocks, and \p pool_options::idle_bytes_trim_threshold makes the pool
+ *      do so by itself once enough memory is idle, so that a temporary spike in usage doesn't keep memory pooled forever.
+ *      \p pool_options::size_classes_per_doubling trades more pools for less rounding of request sizes.
+ *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
  */
 template<typename Upstream>
@@ -93,6 +98,9 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.size_classes_per_doubling = 1;
+        ret.idle_bytes_trim_threshold = 0;
+
         return ret;
     }
 
@@ -105,15 +113,19 @@ public:
         : m_upstream(upstream),
         m_options(options),
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_size_classes_log2(detail::log2_ri((std::max)(m_options.size_classes_per_doubling, static_cast<std::size_t>(1)))),
+        m_alignment_log2(detail::log2_ri(m_options.alignment)),
         m_pools(upstream),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_oversized(),
+        m_idle_bytes(0)
     {
         assert(m_options.validate());
 
-        pool p = { block_descriptor_ptr(), 0 };
-        m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+        pool p = { block_descriptor_ptr(), 0, 0 };
+        m_pools.resize(
+            ((detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2) << m_size_classes_log2) + 1, p);
     }
 
     // TODO: C++11: use delegating constructors
@@ -126,15 +138,19 @@ public:
         : m_upstream(get_global_resource<Upstream>()),
         m_options(options),
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
+        m_size_classes_log2(detail::log2_ri((std::max)(m_options.size_classes_per_doubling, static_cast<std::size_t>(1)))),
+        m_alignment_log2(detail::log2_ri(m_options.alignment)),
         m_pools(get_global_resource<Upstream>()),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_oversized(),
+        m_idle_bytes(0)
     {
         assert(m_options.validate());
 
-        pool p = { block_descriptor_ptr(), 0 };
-        m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+        pool p = { block_descriptor_ptr(), 0, 0 };
+        m_pools.resize(
+            ((detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2) << m_size_classes_log2) + 1, p);
     }
 
     /*! Destructor. Releases all held memory to upstream.
@@ -159,12 +175,19 @@ private:
     struct block_descriptor
     {
         block_descriptor_ptr next;
+        chunk_descriptor_ptr chunk;
     };
 
     struct chunk_descriptor
     {
         std::size_t size;
         chunk_descriptor_ptr next;
+
+        // the pool the chunk was split for, and the number of its blocks which are on that pool's free list;
+        // the chunk is idle when all of them are
+        std::size_t pool_index;
+        std::size_t block_count;
+        std::size_t free_count;
     };
 
     // this was originally a forward list, but I made it a doubly linked list
@@ -192,6 +215,7 @@ private:
     {
         block_descriptor_ptr free_list;
         std::size_t previous_allocated_count;
+        std::size_t idle_chunk_count;
     };
 
     typedef thrust::host_vector<
@@ -203,12 +227,17 @@ private:
 
     pool_options m_options;
     std::size_t m_smallest_block_log2;
+    std::size_t m_size_classes_log2;
+    std::size_t m_alignment_log2;
 
     pool_vector m_pools;
     chunk_descriptor_ptr m_allocated;
     oversized_block_descriptor_ptr m_oversized;
     oversized_block_descriptor_ptr m_cached_oversized;
 
+    // the number of bytes in idle chunks and cached oversized blocks
+    std::size_t m_idle_bytes;
+
 public:
     /*! Releases all held memory to upstream.
      */
@@ -219,6 +248,7 @@ public:
         {
             thrust::raw_reference_cast(m_pools[i]).free_list = block_descriptor_ptr();
             thrust::raw_reference_cast(m_pools[i]).previous_allocated_count = 0;
+            thrust::raw_reference_cast(m_pools[i]).idle_chunk_count = 0;
         }
 
         // deallocate memory allocated for the buckets
@@ -250,6 +280,90 @@ public:
         }
 
         m_cached_oversized = oversized_block_descriptor_ptr();
+        m_idle_bytes = 0;
+    }
+
+    /*! Returns the memory which is held but not in use to upstream: the chunks none of whose blocks are allocated, and
+     *      the cached oversized and overaligned blocks. Unlike \p release, this can be called while memory allocated from
+     *      the pool is still in use.
+     *
+     *  \returns the number of bytes, not counting the bookkeeping overhead, returned to upstream
+     */
+    std::size_t trim()
+    {
+        std::size_t ret = m_idle_bytes;
+
+        // deallocate cached oversized/overaligned memory
+        while (detail::pointer_traits<oversized_block_descriptor_ptr>::get(m_cached_oversized))
+        {
+            oversized_block_descriptor_ptr alloc = m_cached_oversized;
+            oversized_block_descriptor desc = *alloc;
+            m_cached_oversized = desc.next_cached;
+
+            unlink_oversized(alloc, desc);
+
+            void_ptr p = static_cast<void_ptr>(
+                static_cast<char_ptr>(
+                    static_cast<void_ptr>(alloc)
+                ) - desc.size
+            );
+            m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+        }
+
+        // remove the blocks of idle chunks from the free lists of the buckets
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            pool & bucket = thrust::raw_reference_cast(m_pools[i]);
+            if (bucket.idle_chunk_count == 0)
+            {
+                continue;
+            }
+
+            block_descriptor_ptr * previous = &bucket.free_list;
+            while (detail::pointer_traits<block_descriptor_ptr>::get(*previous))
+            {
+                block_descriptor block_desc = **previous;
+                chunk_descriptor chunk_desc = *block_desc.chunk;
+
+                if (chunk_desc.free_count == chunk_desc.block_count)
+                {
+                    *previous = block_desc.next;
+                }
+                else
+                {
+                    previous = &thrust::raw_reference_cast(**previous).next;
+                }
+            }
+
+            bucket.idle_chunk_count = 0;
+        }
+
+        // deallocate idle chunks
+        chunk_descriptor_ptr * previous = &m_allocated;
+        while (detail::pointer_traits<chunk_descriptor_ptr>::get(*previous))
+        {
+            chunk_descriptor_ptr alloc = *previous;
+            chunk_descriptor desc = *alloc;
+
+            if (desc.free_count != desc.block_count)
+            {
+                previous = &thrust::raw_reference_cast(*alloc).next;
+                continue;
+            }
+
+            *previous = desc.next;
+
+            void_ptr p = static_cast<void_ptr>(
+                static_cast<char_ptr>(
+                    static_cast<void_ptr>(alloc)
+                ) - desc.size
+            );
+            m_upstream->do_deallocate(p, desc.size + sizeof(chunk_descriptor), m_options.alignment);
+        }
+
+        m_idle_bytes = 0;
+
+        return ret;
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -309,6 +423,8 @@ public:
                         desc.next_cached = oversized_block_descriptor_ptr();
                         *ptr = desc;
 
+                        m_idle_bytes -= desc.size;
+
                         return static_cast<void_ptr>(
                             static_cast<char_ptr>(
                                 static_cast<void_ptr>(ptr)
@@ -350,12 +466,9 @@ public:
 
         // the request is NOT for oversized and/or overaligned memory
         // allocate a block from an appropriate bucket
-        std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
-        std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+        std::size_t bucket_idx = pool_index(bytes);
         pool & bucket = thrust::raw_reference_cast(m_pools[bucket_idx]);
 
-        bytes = static_cast<std::size_t>(1) << bytes_log2;
-
         // if the free list of the bucket has no elements, allocate a new chunk
         // and split it into blocks pushed to the free list
         if (!detail::pointer_traits<block_descriptor_ptr>::get(bucket.free_list))
@@ -364,17 +477,17 @@ public:
             if (n == 0)
             {
                 n = m_options.min_blocks_per_chunk;
-                if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+                if (n < (m_options.min_bytes_per_chunk / bytes))
                 {
-                    n = m_options.min_bytes_per_chunk >> bytes_log2;
+                    n = m_options.min_bytes_per_chunk / bytes;
                 }
             }
             else
             {
                 n = n * 3 / 2;
-                if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+                if (n > (m_options.max_bytes_per_chunk / bytes))
                 {
-                    n = m_options.max_bytes_per_chunk >> bytes_log2;
+                    n = m_options.max_bytes_per_chunk / bytes;
                 }
                 if (n > m_options.max_blocks_per_chunk)
                 {
@@ -397,9 +510,16 @@ public:
             chunk_descriptor chunk_desc;
             chunk_desc.size = chunk_size;
             chunk_desc.next = m_allocated;
+            chunk_desc.pool_index = bucket_idx;
+            chunk_desc.block_count = n;
+            chunk_desc.free_count = n;
             *chunk = chunk_desc;
             m_allocated = chunk;
 
+            // the chunk starts out idle
+            ++bucket.idle_chunk_count;
+            m_idle_bytes += chunk_size;
+
             for (std::size_t i = 0; i < n; ++i)
             {
                 block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
@@ -410,6 +530,7 @@ public:
 
                 block_descriptor block_desc;
                 block_desc.next = bucket.free_list;
+                block_desc.chunk = chunk;
                 *block = block_desc;
                 bucket.free_list = block;
             }
@@ -417,7 +538,18 @@ public:
 
         // allocate a block from the front of the bucket's free list
         block_descriptor_ptr block = bucket.free_list;
-        bucket.free_list = thrust::raw_reference_cast(*block).next;
+        block_descriptor block_desc = *block;
+        bucket.free_list = block_desc.next;
+
+        chunk_descriptor chunk_desc = *block_desc.chunk;
+        if (chunk_desc.free_count == chunk_desc.block_count)
+        {
+            --bucket.idle_chunk_count;
+            m_idle_bytes -= chunk_desc.size;
+        }
+        --chunk_desc.free_count;
+        *block_desc.chunk = chunk_desc;
+
         return static_cast<void_ptr>(
             static_cast<char_ptr>(
                 static_cast<void_ptr>(block)
@@ -450,29 +582,13 @@ public:
                 *block = desc;
                 m_cached_oversized = block;
 
-                return;
-            }
+                m_idle_bytes += desc.size;
+                trim_if_over_threshold();
 
-            if (!detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev))
-            {
-                assert(m_oversized == block);
-                m_oversized = desc.next;
-            }
-            else
-            {
-                oversized_block_descriptor prev = *desc.prev;
-                assert(prev.next == block);
-                prev.next = desc.next;
-                *desc.prev = prev;
+                return;
             }
 
-            if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next))
-            {
-                oversized_block_descriptor next = *desc.next;
-                assert(next.prev == block);
-                next.prev = desc.prev;
-                *desc.next = next;
-            }
+            unlink_oversized(block, desc);
 
             m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
 
@@ -480,22 +596,90 @@ public:
         }
 
         // push the block to the front of the appropriate bucket's free list
-        std::size_t n_log2 = thrust::detail::log2_ri(n);
-        std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+        std::size_t bucket_idx = pool_index(n);
         pool & bucket = thrust::raw_reference_cast(m_pools[bucket_idx]);
 
-        n = static_cast<std::size_t>(1) << n_log2;
-
         block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
             static_cast<void_ptr>(
                 static_cast<char_ptr>(p) + n
             )
         );
 
-        block_descriptor desc;
+        block_descriptor desc = *block;
         desc.next = bucket.free_list;
         *block = desc;
         bucket.free_list = block;
+
+        chunk_descriptor chunk_desc = *desc.chunk;
+        ++chunk_desc.free_count;
+        *desc.chunk = chunk_desc;
+
+        if (chunk_desc.free_count == chunk_desc.block_count)
+        {
+            ++bucket.idle_chunk_count;
+            m_idle_bytes += chunk_desc.size;
+            trim_if_over_threshold();
+        }
+    }
+
+private:
+    // returns the index of the bucket serving requests of the given size, and rounds the size up to the size of the
+    // blocks of that bucket
+    //
+    // every power-of-two range of sizes above the smallest block size is split into 2^m_size_classes_log2 buckets of
+    // evenly spaced sizes, which are kept at least as far apart as the alignment of the blocks
+    std::size_t pool_index(std::size_t & bytes) const
+    {
+        std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+        if (bytes_log2 <= m_smallest_block_log2)
+        {
+            bytes = m_options.smallest_block_size;
+            return 0;
+        }
+
+        std::size_t range_log2 = bytes_log2 - 1;
+        std::size_t class_step_log2 = range_log2 - m_size_classes_log2;
+        std::size_t step_log2 = (std::max)(class_step_log2, m_alignment_log2);
+
+        std::size_t range_start = static_cast<std::size_t>(1) << range_log2;
+        std::size_t steps = (bytes - range_start + (static_cast<std::size_t>(1) << step_log2) - 1) >> step_log2;
+
+        bytes = range_start + (steps << step_log2);
+
+        return ((range_log2 - m_smallest_block_log2) << m_size_classes_log2) + (steps << (step_log2 - class_step_log2));
+    }
+
+    // removes an oversized block from the list of all oversized blocks
+    void unlink_oversized(oversized_block_descriptor_ptr block, const oversized_block_descriptor & desc)
+    {
+        if (!detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev))
+        {
+            assert(m_oversized == block);
+            m_oversized = desc.next;
+        }
+        else
+        {
+            oversized_block_descriptor prev = *desc.prev;
+            assert(prev.next == block);
+            prev.next = desc.next;
+            *desc.prev = prev;
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next))
+        {
+            oversized_block_descriptor next = *desc.next;
+            assert(next.prev == block);
+            next.prev = desc.prev;
+            *desc.next = next;
+        }
+    }
+
+    void trim_if_over_threshold()
+    {
+        if (m_options.idle_bytes_trim_threshold != 0 && m_idle_bytes > m_options.idle_bytes_trim_threshold)
+        {
+            trim();
+        }
     }
 };
 
@@ -90,6 +90,20 @@ struct pool_options
      */
     std::size_t cached_alignment_cutoff_factor;
 
+    /*! The number of size classes every power-of-two range of block sizes is split into. With the value of 1 (or 0), the
+     *      blocks of the pools are powers of two, and a request can waste almost half of its block; with the value of 4,
+     *      the pools between 1024 and 2048 bytes hold blocks of 1280, 1536, 1792 and 2048 bytes, and a request wastes at
+     *      most a fifth of its block. Classes smaller than \p alignment apart are merged. Must be a power of two no bigger
+     *      than \p smallest_block_size. Disjoint pool resources ignore this option.
+     */
+    std::size_t size_classes_per_doubling;
+
+    /*! The number of bytes held in fully idle chunks and cached oversized blocks above which the pool resource returns
+     *      them to upstream, as if by calling \p trim, when a block is deallocated. With the value of 0, idle memory is
+     *      only returned by \p trim, \p release and the destructor. Disjoint pool resources ignore this option.
+     */
+    std::size_t idle_bytes_trim_threshold;
+
     /*! Checks if the options are self-consistent.
      *
      *  /returns true if the options are self-consitent, false otherwise.
@@ -99,6 +113,7 @@ struct pool_options
         if (!detail::is_power_of_2(smallest_block_size)) return false;
         if (!detail::is_power_of_2(largest_block_size)) return false;
         if (!detail::is_power_of_2(alignment)) return false;
+        if (!detail::is_power_of_2(size_classes_per_doubling)) return false;
 
         if (max_bytes_per_chunk == 0 || max_blocks_per_chunk == 0) return false;
         if (smallest_block_size == 0 || largest_block_size == 0) return false;
@@ -115,6 +130,7 @@ struct pool_options
         if (max_blocks_per_chunk * smallest_block_size < min_bytes_per_chunk) return false;
 
         if (alignment > smallest_block_size) return false;
+        if (size_classes_per_doubling > smallest_block_size) return false;
 
         return true;
     }
@@ -0,0 +1,260 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A monotonically growing, mutex-synchronized scratch memory resource
+ *  for the temporary storage of host algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace mr
+{
+class scratch_arena;
+} // end mr
+
+namespace detail
+{
+
+inline std::atomic<thrust::mr::scratch_arena *> & default_scratch_arena()
+{
+    static std::atomic<thrust::mr::scratch_arena *> arena(nullptr);
+    return arena;
+}
+
+} // end detail
+
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource meant to back the temporary storage of the host systems. Allocations are carved out of blocks
+ *      obtained from an upstream resource with a bump pointer, and memory is only returned to upstream when the arena
+ *      is destroyed or \p release is called.
+ *
+ *  Whenever the last outstanding allocation is deallocated, the arena rewinds to the start of its storage. If at that
+ *      point it holds more than one block, the next allocation replaces them with a single block of their combined
+ *      size. The capacity of the arena therefore grows monotonically to the high-water mark of the workload, after
+ *      which repeated calls never touch the upstream resource.
+ *
+ *  The arena is synchronized with a \p std::mutex, so a single instance may be shared by all threads of a process.
+ *      Instances may be passed to the \p par policies of the cpp, omp and tbb systems with \p with_scratch_arena, or
+ *      installed for all their calls with \p set_default_scratch_arena.
+ */
+class scratch_arena final : public memory_resource<>
+{
+    typedef std::lock_guard<std::mutex> lock_t;
+
+public:
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for the blocks of the arena
+     */
+    scratch_arena(memory_resource<> * upstream = get_global_resource<new_delete_resource>())
+        : m_upstream(upstream),
+        m_blocks(),
+        m_offset(0),
+        m_live(0),
+        m_capacity(0)
+    {
+    }
+
+    scratch_arena(const scratch_arena &) = delete;
+    scratch_arena & operator=(const scratch_arena &) = delete;
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~scratch_arena()
+    {
+        release();
+    }
+
+    /*! Releases all held memory to upstream. Must not be called while any allocation made from the arena is
+     *      outstanding.
+     */
+    void release()
+    {
+        lock_t lock(m_mutex);
+
+        release_blocks();
+        m_offset = 0;
+        m_live = 0;
+    }
+
+    /*! Returns the number of bytes currently held by the arena.
+     */
+    std::size_t capacity() const
+    {
+        lock_t lock(m_mutex);
+        return m_capacity;
+    }
+
+    THRUST_NODISCARD virtual void * do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        lock_t lock(m_mutex);
+
+        if (alignment < THRUST_MR_DEFAULT_ALIGNMENT)
+        {
+            alignment = THRUST_MR_DEFAULT_ALIGNMENT;
+        }
+
+        // the arena is idle; coalesce the blocks acquired while it grew
+        if (m_live == 0 && m_blocks.size() > 1)
+        {
+            std::size_t capacity = m_capacity;
+            release_blocks();
+            push_block(capacity);
+        }
+
+        void * ret = m_blocks.empty() ? nullptr : bump(bytes, alignment);
+
+        if (!ret)
+        {
+            // grow geometrically, so that a workload reaches its high-water mark in a logarithmic number of blocks
+            std::size_t size = bytes + alignment;
+            if (size < m_capacity) size = m_capacity;
+            if (size < min_block_size) size = min_block_size;
+
+            push_block(size);
+            ret = bump(bytes, alignment);
+        }
+
+        ++m_live;
+        return ret;
+    }
+
+    virtual void do_deallocate(void * p, std::size_t bytes, std::size_t) override
+    {
+        lock_t lock(m_mutex);
+
+        if (--m_live == 0)
+        {
+            m_offset = 0;
+            return;
+        }
+
+        // rewind the bump pointer if p was the most recent allocation; memory freed out of order is reclaimed once
+        // the arena becomes idle
+        char * begin = m_blocks.back().data;
+        char * ptr = static_cast<char *>(p);
+        if (ptr >= begin && ptr + bytes == begin + m_offset)
+        {
+            m_offset = ptr - begin;
+        }
+    }
+
+private:
+    struct block
+    {
+        char * data;
+        std::size_t size;
+    };
+
+    static const std::size_t min_block_size = 4096;
+
+    void * bump(std::size_t bytes, std::size_t alignment)
+    {
+        block & b = m_blocks.back();
+
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(b.data) + m_offset;
+        std::size_t padding = (alignment - address % alignment) % alignment;
+
+        if (b.size - m_offset < padding || b.size - m_offset - padding < bytes)
+        {
+            return nullptr;
+        }
+
+        void * ret = b.data + m_offset + padding;
+        m_offset += padding + bytes;
+        return ret;
+    }
+
+    void push_block(std::size_t size)
+    {
+        block b = { static_cast<char *>(m_upstream->do_allocate(size, THRUST_MR_DEFAULT_ALIGNMENT)), size };
+        m_blocks.push_back(b);
+        m_capacity += size;
+        m_offset = 0;
+    }
+
+    void release_blocks()
+    {
+        for (std::size_t i = 0; i < m_blocks.size(); ++i)
+        {
+            m_upstream->do_deallocate(m_blocks[i].data, m_blocks[i].size, THRUST_MR_DEFAULT_ALIGNMENT);
+        }
+
+        m_blocks.clear();
+        m_capacity = 0;
+    }
+
+    memory_resource<> * m_upstream;
+
+    mutable std::mutex m_mutex;
+    std::vector<block> m_blocks;
+    std::size_t m_offset;
+    std::size_t m_live;
+    std::size_t m_capacity;
+};
+
+/*! Installs \p arena as the scratch arena used for the temporary storage of every algorithm invoked with an execution
+ *      policy of the cpp, omp or tbb system that was not given an allocator of its own. Passing \c nullptr restores
+ *      the default of allocating temporary storage with \p thrust::malloc.
+ *
+ *  The default must not be changed while an algorithm of those systems is running.
+ *
+ *  \param arena the scratch arena to install, or \c nullptr
+ *  \return the previously installed scratch arena, or \c nullptr
+ */
+inline scratch_arena * set_default_scratch_arena(scratch_arena * arena)
+{
+    return thrust::detail::default_scratch_arena().exchange(arena, std::memory_order_acq_rel);
+}
+
+/*! Returns the scratch arena installed with \p set_default_scratch_arena, or \c nullptr if there is none.
+ */
+inline scratch_arena * get_default_scratch_arena()
+{
+    return thrust::detail::default_scratch_arena().load(std::memory_order_acquire);
+}
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -87,6 +87,16 @@ public:
         upstream_pool.release();
     }
 
+    /*! Returns the memory which is held but not in use to upstream.
+     *
+     *  \returns the number of bytes returned to upstream
+     */
+    std::size_t trim()
+    {
+        lock_t lock(mtx);
+        return upstream_pool.trim();
+    }
+
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
     {
         lock_t lock(mtx);
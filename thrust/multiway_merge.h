@@ -0,0 +1,342 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/multiway_merge.h
+ *  \brief Merging many sorted ranges in a single pass
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/pair.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup merging
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p multiway_merge combines any number of sorted ranges, called runs, into
+ *  a single sorted range. The runs are given by the range
+ *  <tt>[runs_first, runs_last)</tt> of iterator pairs: run \c i is
+ *  <tt>[runs_first[i].first, runs_first[i].second)</tt>. The output is
+ *  written to <tt>[result, result + n)</tt>, where \c n is the total size of
+ *  the runs.
+ *
+ *  \p multiway_merge is stable: equivalent elements keep their order within
+ *  each run, and elements of earlier runs precede equivalent elements of later
+ *  runs. The result is the same as merging the runs one after the other with
+ *  \p merge, but every element is read once.
+ *
+ *  This version of \p multiway_merge compares elements using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param runs_first The beginning of the range of runs.
+ *  \param runs_last The end of the range of runs.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator's \c value_type is <tt>thrust::pair<InputIterator,InputIterator></tt>
+ *          or <tt>std::pair<InputIterator,InputIterator></tt>, where \c InputIterator is a model of
+ *          <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>.
+ *
+ *  \pre Every run is sorted with respect to \c operator<.
+ *  \pre The output range shall not overlap with any run.
+ *  \pre The runs are read on the host, so <tt>[runs_first, runs_last)</tt>
+ *       should be host memory.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge to
+ *  merge three sorted arrays using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/pair.h>
+ *  ...
+ *  int A[3] = {1, 4, 7};
+ *  int B[3] = {2, 5, 8};
+ *  int C[3] = {0, 3, 6};
+ *
+ *  thrust::pair<int*,int*> runs[3] = {thrust::make_pair(A, A + 3),
+ *                                     thrust::make_pair(B, B + 3),
+ *                                     thrust::make_pair(C, C + 3)};
+ *
+ *  int result[9];
+ *
+ *  int *result_end = thrust::multiway_merge(thrust::host, runs, runs + 3, result);
+ *
+ *  // result = {0, 1, 2, 3, 4, 5, 6, 7, 8}
+ *  \endcode
+ *
+ *  \see \p merge
+ *  \see \p multiway_merge_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result);
+
+
+/*! \p multiway_merge combines the sorted runs
+ *  <tt>[runs_first[i].first, runs_first[i].second)</tt> into a single sorted
+ *  range beginning at \p result. The merge is stable.
+ *
+ *  This version of \p multiway_merge compares elements using \c operator<.
+ *
+ *  \param runs_first The beginning of the range of runs.
+ *  \param runs_last The end of the range of runs.
+ *  \param result The beginning of the merged output.
+ *  \return The end of the output range.
+ *
+ *  \see \p merge
+ */
+template<typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator multiway_merge(RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result);
+
+
+/*! \p multiway_merge combines the sorted runs
+ *  <tt>[runs_first[i].first, runs_first[i].second)</tt> into a single range
+ *  beginning at \p result which is sorted with respect to \p comp. The merge
+ *  is stable: elements of earlier runs precede equivalent elements of later
+ *  runs.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param runs_first The beginning of the range of runs.
+ *  \param runs_last The end of the range of runs.
+ *  \param result The beginning of the merged output.
+ *  \param comp Comparison operator.
+ *  \return The end of the output range.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every run is sorted with respect to \p comp.
+ *
+ *  \see \p merge
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  OutputIterator multiway_merge(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result,
+                                StrictWeakOrdering comp);
+
+
+/*! \p multiway_merge combines the sorted runs
+ *  <tt>[runs_first[i].first, runs_first[i].second)</tt> into a single range
+ *  beginning at \p result which is sorted with respect to \p comp. The merge
+ *  is stable.
+ *
+ *  \see \p merge
+ */
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    multiway_merge(RandomAccessIterator runs_first,
+                   RandomAccessIterator runs_last,
+                   OutputIterator result,
+                   StrictWeakOrdering comp);
+
+
+/*! \p multiway_merge_by_key performs a key-value \p multiway_merge. The key
+ *  runs are given by the range <tt>[keys_runs_first, keys_runs_last)</tt> of
+ *  iterator pairs, and the values of run \c i begin at
+ *  <tt>values_runs_first[i]</tt>. The keys are merged stably into
+ *  \p keys_result, and every value is moved along with its key into
+ *  \p values_result.
+ *
+ *  This version of \p multiway_merge_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_runs_first The beginning of the range of key runs.
+ *  \param keys_runs_last The end of the range of key runs.
+ *  \param values_runs_first The beginning of the range of the beginnings of
+ *         the value runs.
+ *  \param keys_result The beginning of the merged keys.
+ *  \param values_result The beginning of the merged values.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the keys
+ *          and <tt>p.second</tt> is the end of the values.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a pair of key iterators, as for \p multiway_merge.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>.
+ *
+ *  \pre Every key run is sorted with respect to \c operator<.
+ *  \pre The output ranges shall not overlap with any run.
+ *
+ *  The following code snippet demonstrates how to use \p multiway_merge_by_key
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/multiway_merge.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <thrust/pair.h>
+ *  ...
+ *  int  A_keys[2] = {1, 3};
+ *  char A_vals[2] = {'a', 'b'};
+ *  int  B_keys[2] = {1, 2};
+ *  char B_vals[2] = {'c', 'd'};
+ *
+ *  thrust::pair<int*,int*> keys_runs[2] = {thrust::make_pair(A_keys, A_keys + 2),
+ *                                          thrust::make_pair(B_keys, B_keys + 2)};
+ *  char *values_runs[2] = {A_vals, B_vals};
+ *
+ *  int  keys_result[4];
+ *  char vals_result[4];
+ *
+ *  thrust::multiway_merge_by_key(thrust::host, keys_runs, keys_runs + 2, values_runs, keys_result, vals_result);
+ *
+ *  // keys_result = {1, 1, 2, 3}
+ *  // vals_result = {'a', 'c', 'd', 'b'}
+ *  \endcode
+ *
+ *  \see \p merge_by_key
+ *  \see \p multiway_merge
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result);
+
+
+/*! \p multiway_merge_by_key performs a key-value \p multiway_merge, comparing
+ *  keys using \c operator<.
+ *
+ *  \see \p multiway_merge
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result);
+
+
+/*! \p multiway_merge_by_key performs a key-value \p multiway_merge, comparing
+ *  keys using \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_runs_first The beginning of the range of key runs.
+ *  \param keys_runs_last The end of the range of key runs.
+ *  \param values_runs_first The beginning of the range of the beginnings of
+ *         the value runs.
+ *  \param keys_result The beginning of the merged keys.
+ *  \param values_result The beginning of the merged values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is the end of the keys
+ *          and <tt>p.second</tt> is the end of the values.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre Every key run is sorted with respect to \p comp.
+ *
+ *  \see \p multiway_merge
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp);
+
+
+/*! \p multiway_merge_by_key performs a key-value \p multiway_merge, comparing
+ *  keys using \p comp.
+ *
+ *  \see \p multiway_merge
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    thrust::pair<OutputIterator1,OutputIterator2>
+  >::type
+    multiway_merge_by_key(RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp);
+
+
+/*! \} // end merging
+ */
+
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/multiway_merge.inl>
@@ -0,0 +1,287 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/pipeline.h
+ *  \brief Lazily composed algorithm pipelines which run as a single fused
+ *         traversal
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp14_required.h>
+
+#if THRUST_CPP_DIALECT >= 2014
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/pipeline.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup pipelines Pipelines
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p pipeline begins a lazy pipeline over the range <tt>[first, last)</tt>.
+ *  Stages such as \p transformed and \p filtered are appended with
+ *  <tt>operator|</tt> and are not evaluated until the pipeline is terminated
+ *  with \p reduced, \p counted or \p copied. The whole pipeline then runs as
+ *  a single algorithm call which reads each input element once and allocates
+ *  no intermediate storage.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return A lazy pipeline over <tt>[first, last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p pipeline to sum the
+ *  squares of the positive elements of a range using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/execution_policy.h>
+ *
+ *  struct square
+ *  {
+ *    __host__ __device__ int operator()(int x) const { return x * x; }
+ *  };
+ *
+ *  struct is_positive
+ *  {
+ *    __host__ __device__ bool operator()(int x) const { return x > 0; }
+ *  };
+ *
+ *  ...
+ *
+ *  int data[6] = {-1, 2, -3, 4, 0, 1};
+ *  int result = thrust::pipeline(thrust::host, data, data + 6)
+ *             | thrust::filtered(is_positive())
+ *             | thrust::transformed(square())
+ *             | thrust::reduced(0);
+ *  // result == 21
+ *  \endcode
+ *
+ *  \see \c transform_reduce
+ *  \see \c transform_iterator
+ */
+template<typename DerivedPolicy, typename InputIterator>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  InputIterator,
+  thrust::detail::pipeline_detail::identity_stage<typename thrust::iterator_value<InputIterator>::type>,
+  false
+>
+  pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+           InputIterator first,
+           InputIterator last);
+
+
+/*! \p pipeline begins a lazy pipeline over the range <tt>[first, last)</tt>.
+ *  Stages such as \p transformed and \p filtered are appended with
+ *  <tt>operator|</tt> and are not evaluated until the pipeline is terminated
+ *  with \p reduced, \p counted or \p copied. The whole pipeline then runs as
+ *  a single algorithm call on the system of \p InputIterator.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \return A lazy pipeline over <tt>[first, last)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>.
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  thrust::device_vector<int> v(4, 3);
+ *  int result = thrust::pipeline(v.begin(), v.end())
+ *             | thrust::transformed(thrust::negate<int>())
+ *             | thrust::reduced(0);
+ *  // result == -12
+ *  \endcode
+ */
+template<typename InputIterator>
+__host__ __device__
+thrust::detail::pipeline_view<
+  typename thrust::iterator_system<InputIterator>::type,
+  InputIterator,
+  thrust::detail::pipeline_detail::identity_stage<typename thrust::iterator_value<InputIterator>::type>,
+  false
+>
+  pipeline(InputIterator first,
+           InputIterator last);
+
+
+/*! \p transformed is a pipeline stage which applies \p f to each element
+ *  produced by the preceding stages.
+ *
+ *  \param f The function to apply.
+ *  \return A stage to append to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>.
+ */
+template<typename UnaryFunction>
+__host__ __device__
+thrust::detail::transformed_adaptor<UnaryFunction>
+  transformed(UnaryFunction f);
+
+
+/*! \p filtered is a pipeline stage which drops the elements produced by the
+ *  preceding stages for which \p pred is \c false.
+ *
+ *  \param pred The predicate used to select elements.
+ *  \return A stage to append to a pipeline with <tt>operator|</tt>.
+ *
+ *  \tparam Predicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/Predicate">Predicate</a>.
+ */
+template<typename Predicate>
+__host__ __device__
+thrust::detail::filtered_adaptor<Predicate>
+  filtered(Predicate pred);
+
+
+/*! \p reduced terminates a pipeline by reducing the elements it produces
+ *  with \p binary_op, starting from \p init. The order of reduction is not
+ *  specified, so \p binary_op must be both commutative and associative.
+ *
+ *  \param init The initial value of the reduction.
+ *  \param binary_op The reduction operation.
+ *  \return A terminal stage; <tt>pipeline | reduced(init, op)</tt> yields an \p OutputType.
+ *
+ *  \tparam OutputType is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>.
+ */
+template<typename OutputType, typename BinaryFunction>
+__host__ __device__
+thrust::detail::reduced_adaptor<OutputType,BinaryFunction>
+  reduced(OutputType init, BinaryFunction binary_op);
+
+
+/*! \p reduced terminates a pipeline by summing the elements it produces
+ *  with <tt>operator+</tt>, starting from \p init.
+ *
+ *  \param init The initial value of the reduction.
+ *  \return A terminal stage; <tt>pipeline | reduced(init)</tt> yields an \p OutputType.
+ */
+template<typename OutputType>
+__host__ __device__
+thrust::detail::reduced_adaptor<OutputType,thrust::plus<OutputType> >
+  reduced(OutputType init);
+
+
+/*! \p counted terminates a pipeline by counting the elements it produces.
+ *
+ *  \return A terminal stage; <tt>pipeline | counted()</tt> yields the
+ *          \c difference_type of the pipeline's input iterator.
+ */
+__host__ __device__
+inline thrust::detail::counted_adaptor counted();
+
+
+/*! \p copied terminates a pipeline by writing the elements it produces to
+ *  the range beginning at \p result, preserving their relative order.
+ *
+ *  \param result The beginning of the output sequence.
+ *  \return A terminal stage; <tt>pipeline | copied(result)</tt> yields the end
+ *          of the output sequence.
+ *
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a>.
+ */
+template<typename OutputIterator>
+__host__ __device__
+thrust::detail::copied_adaptor<OutputIterator>
+  copied(OutputIterator result);
+
+
+/*! Appends a \p transformed stage to a pipeline.
+ */
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename UnaryFunction>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  Iterator,
+  typename thrust::detail::pipeline_detail::make_transform_stage<UnaryFunction,Stage,Filtered>::type,
+  Filtered
+>
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::transformed_adaptor<UnaryFunction> stage);
+
+
+/*! Appends a \p filtered stage to a pipeline.
+ */
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename Predicate>
+__host__ __device__
+thrust::detail::pipeline_view<
+  DerivedPolicy,
+  Iterator,
+  typename thrust::detail::pipeline_detail::make_filter_stage<Predicate,Stage,Filtered>::type,
+  true
+>
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::filtered_adaptor<Predicate> stage);
+
+
+/*! Runs a pipeline terminated by \p reduced.
+ */
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename OutputType, typename BinaryFunction>
+__host__ __device__
+OutputType
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::reduced_adaptor<OutputType,BinaryFunction> stage);
+
+
+/*! Runs a pipeline terminated by \p counted.
+ */
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered>
+__host__ __device__
+typename thrust::iterator_difference<Iterator>::type
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::counted_adaptor stage);
+
+
+/*! Runs a pipeline terminated by \p copied.
+ */
+template<typename DerivedPolicy, typename Iterator, typename Stage, bool Filtered, typename OutputIterator>
+__host__ __device__
+OutputIterator
+  operator|(const thrust::detail::pipeline_view<DerivedPolicy,Iterator,Stage,Filtered> &p,
+            thrust::detail::copied_adaptor<OutputIterator> stage);
+
+
+/*! \} // end pipelines
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/pipeline.inl>
+
+#endif // THRUST_CPP_DIALECT >= 2014
+
@@ -0,0 +1,212 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/radix_key.h
+ *  \brief Comparison operators which order keys by their radix sortable
+ *         bit representation
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/radix_encoder.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p bit_range_less is a function object which compares keys by the bits
+ *  <tt>[begin_bit, end_bit)</tt> of their order-preserving unsigned
+ *  representation: unsigned integers are used as is, the sign bit of signed
+ *  integers is flipped, and floating point numbers are mapped so that
+ *  negative values precede positive ones. Keys which agree on those bits are
+ *  equivalent.
+ *
+ *  Sorting with \p bit_range_less is equivalent to a radix sort restricted to
+ *  the given bits, and the host backends perform exactly that radix sort, so
+ *  no pass is spent on bits which are known to be constant. Other backends
+ *  fall back to a comparison sort with the same ordering.
+ *
+ *  \tparam T is an arithmetic type.
+ *
+ *  The following code snippet sorts 20-bit bucket identifiers stored in
+ *  32-bit integers with two 11-bit passes instead of the four 8-bit passes of
+ *  a sort over all 32 bits:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/radix_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::stable_sort(thrust::host, ids, ids + N, thrust::bit_range_less<unsigned int>(0, 20));
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p decomposer_less
+ */
+template<typename T>
+struct bit_range_less
+{
+  /*! \typedef first_argument_type
+   *  \brief The type of the function object's first argument.
+   */
+  typedef T first_argument_type;
+
+  /*! \typedef second_argument_type
+   *  \brief The type of the function object's second argument.
+   */
+  typedef T second_argument_type;
+
+  /*! \typedef result_type
+   *  \brief The type of the function object's result;
+   */
+  typedef bool result_type;
+
+  /*! The least significant bit which is compared.
+   */
+  int begin_bit;
+
+  /*! One past the most significant bit which is compared.
+   */
+  int end_bit;
+
+  /*! This constructor compares all bits of \c T.
+   */
+  __host__ __device__
+  bit_range_less()
+    : begin_bit(0),
+      end_bit(thrust::detail::radix_encoded_bits<T>::value)
+  {}
+
+  /*! This constructor compares the bits <tt>[begin_bit, end_bit)</tt>,
+   *  clamped to the bits of \c T.
+   */
+  __host__ __device__
+  bit_range_less(int begin_bit, int end_bit)
+    : begin_bit(begin_bit),
+      end_bit(end_bit)
+  {}
+
+  /*! Function call operator. The return value is \c true if the selected
+   *  bits of \p lhs are less than those of \p rhs.
+   */
+  __host__ __device__
+  bool operator()(const T &lhs, const T &rhs) const
+  {
+    thrust::detail::radix_encoder<T> encode;
+
+    return thrust::detail::radix_bit_field(encode(lhs), begin_bit, end_bit)
+         < thrust::detail::radix_bit_field(encode(rhs), begin_bit, end_bit);
+  }
+}; // end bit_range_less
+
+
+/*! \p decomposer_less is a function object which compares keys by the tuple
+ *  of arithmetic fields a \p Decomposer extracts from them. The first field is
+ *  the most significant one, and each field is compared by its
+ *  order-preserving unsigned representation, like \p bit_range_less does.
+ *
+ *  This is the hook which lets the host backends radix sort structures and
+ *  tuples: when the fields add up to at most 64 bits, keys are sorted as the
+ *  concatenation of their fields instead of by a merge sort. Wider keys, and
+ *  other backends, use a comparison sort with the same ordering.
+ *
+ *  \tparam Decomposer is a function object which is callable with a
+ *          <tt>const Key &</tt> and returns a \p thrust::tuple of arithmetic
+ *          values or of references to them, e.g. made by \p thrust::tie.
+ *
+ *  The following code snippet sorts points by \c y and then by \c x:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/radix_key.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct point { short x; short y; };
+ *
+ *  struct y_then_x
+ *  {
+ *    __host__ __device__
+ *    thrust::tuple<short, short> operator()(const point &p) const
+ *    {
+ *      return thrust::make_tuple(p.y, p.x);
+ *    }
+ *  };
+ *  ...
+ *  thrust::sort(thrust::host, points, points + N, thrust::make_decomposer_less(y_then_x()));
+ *  \endcode
+ *
+ *  \see \p bit_range_less
+ *  \see \p make_decomposer_less
+ */
+template<typename Decomposer>
+struct decomposer_less
+{
+  /*! \typedef result_type
+   *  \brief The type of the function object's result;
+   */
+  typedef bool result_type;
+
+  /*! The function object which splits a key into fields.
+   */
+  Decomposer decompose;
+
+  /*! This constructor stores a copy of \p decompose.
+   */
+  __host__ __device__
+  explicit decomposer_less(Decomposer decompose = Decomposer())
+    : decompose(decompose)
+  {}
+
+  /*! Function call operator. The return value is \c true if the fields of
+   *  \p lhs are lexicographically less than those of \p rhs.
+   */
+  template<typename Key>
+  __host__ __device__
+  bool operator()(const Key &lhs, const Key &rhs) const
+  {
+    typedef typename thrust::detail::decomposed_radix_encoder<Key, Decomposer>::fields fields;
+
+    return fields::less(decompose(lhs), decompose(rhs));
+  }
+}; // end decomposer_less
+
+
+/*! \p make_decomposer_less creates a \p decomposer_less from a \p Decomposer.
+ *
+ *  \param decompose The function object which splits a key into fields.
+ *  \return A \p decomposer_less which orders keys by the fields returned by
+ *          \p decompose.
+ *
+ *  \see \p decomposer_less
+ */
+template<typename Decomposer>
+__host__ __device__
+decomposer_less<Decomposer> make_decomposer_less(Decomposer decompose)
+{
+  return decomposer_less<Decomposer>(decompose);
+}
+
+
+/*! \} // end sorting
+ */
+
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,520 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/segmented_reduce.h
+ *  \brief Reducing many independent segments of a sequence in one call
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+
+/*! \p segmented_reduce reduces every segment of a sequence independently
+ *  and writes the sum of segment \c i to <tt>*(result + i)</tt>. Segment \c i
+ *  is the range <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>,
+ *  and there are <tt>begin_offsets_last - begin_offsets_first</tt> segments.
+ *  Unlike \p reduce_by_key, no key is read or compared per element.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every
+ *  reduction, and \c operator+ as the reduction operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of sums.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *  \tparam BeginOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  sum the rows of a matrix in CSR format using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float values[6]  = {1.0f, 2.0f,   3.0f,   4.0f, 5.0f, 6.0f};
+ *  int row_offsets[5] = {0, 2, 3, 3, 6};
+ *  float sums[4];
+ *
+ *  thrust::segmented_reduce(thrust::host, values, row_offsets, row_offsets + 4, row_offsets + 1, sums);
+ *
+ *  // sums is now {3.0f, 3.0f, 0.0f, 15.0f}
+ *  \endcode
+ *
+ *  \see \p reduce
+ *  \see \p reduce_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result);
+
+
+/*! \p segmented_reduce reduces every segment of a sequence independently
+ *  and writes the sum of segment \c i to <tt>*(result + i)</tt>. Segment \c i
+ *  is the range <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every
+ *  reduction, and \c operator+ as the reduction operator.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of sums.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  \see \p reduce
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_reduce(RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result);
+
+
+/*! \p segmented_reduce reduces every segment of a sequence independently
+ *  with \p binary_op, starting from \p init, and writes the result of segment
+ *  \c i to <tt>*(result + i)</tt>. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>.
+ *  The result of an empty segment is \p init.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of results.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to combine values.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \tparam T is convertible to \p OutputIterator's \c value_type.
+ *  \tparam BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>
+ *          whose result type is convertible to \p T.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int values[6]  = {1, 2,   3,   4, 5, 6};
+ *  int offsets[5] = {0, 2, 3, 3, 6};
+ *  int maxima[4];
+ *
+ *  thrust::segmented_reduce(thrust::host, values, offsets, offsets + 4, offsets + 1, maxima, -1, thrust::maximum<int>());
+ *
+ *  // maxima is now {2, 3, -1, 6}
+ *  \endcode
+ *
+ *  \see \p reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op);
+
+
+/*! \p segmented_reduce reduces every segment of a sequence independently
+ *  with \p binary_op, starting from \p init, and writes the result of segment
+ *  \c i to <tt>*(result + i)</tt>.
+ *
+ *  \see \p reduce
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_reduce(RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op);
+
+
+/*! \p segmented_transform_reduce applies \p unary_op to every element of a
+ *  segment and reduces the transformed values with \p binary_op, starting from
+ *  \p init. The result of segment \c i is written to <tt>*(result + i)</tt>.
+ *  No transformed value is stored.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of results.
+ *  \param unary_op The function to apply to every element.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to combine transformed values.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \tparam UnaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a>.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_transform_reduce
+ *  to compute the squared norm of every row:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct square { __host__ __device__ float operator()(float x) const { return x * x; } };
+ *  ...
+ *  float values[5]  = {1.0f, 2.0f,   3.0f, -4.0f, 0.0f};
+ *  int   offsets[3] = {0, 2, 5};
+ *  float norms[2];
+ *
+ *  thrust::segmented_transform_reduce(thrust::host, values, offsets, offsets + 2, offsets + 1, norms,
+ *                                     square(), 0.0f, thrust::plus<float>());
+ *
+ *  // norms is now {5.0f, 25.0f}
+ *  \endcode
+ *
+ *  \see \p transform_reduce
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_transform_reduce(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                            RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op);
+
+
+/*! \p segmented_transform_reduce applies \p unary_op to every element of a
+ *  segment and reduces the transformed values with \p binary_op, starting from
+ *  \p init. The result of segment \c i is written to <tt>*(result + i)</tt>.
+ *
+ *  \see \p transform_reduce
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_transform_reduce(RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op);
+
+
+/*! \p segmented_min_element finds the smallest element of every segment of a
+ *  sequence. The position of the first smallest element of segment \c i,
+ *  as an offset from \p first, is written to <tt>*(result + i)</tt>.
+ *  The position written for an empty segment is its end offset.
+ *
+ *  This version compares elements using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of positions.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int values[6]  = {4, 2,   7,   5, 1, 1};
+ *  int offsets[4] = {0, 2, 3, 6};
+ *  int positions[3];
+ *
+ *  thrust::segmented_min_element(thrust::host, values, offsets, offsets + 3, offsets + 1, positions);
+ *
+ *  // positions is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see \p min_element
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result);
+
+
+/*! \p segmented_min_element finds the smallest element of every segment of a
+ *  sequence, and writes its position as an offset from \p first to
+ *  <tt>*(result + i)</tt>.
+ *
+ *  This version compares elements using \c operator<.
+ *
+ *  \see \p min_element
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_min_element(RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result);
+
+
+/*! \p segmented_min_element finds the smallest element of every segment of a
+ *  sequence, as defined by \p comp, and writes its position as an offset from
+ *  \p first to <tt>*(result + i)</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \see \p min_element
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_min_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp);
+
+
+/*! \p segmented_min_element finds the smallest element of every segment of a
+ *  sequence, as defined by \p comp, and writes its position as an offset from
+ *  \p first to <tt>*(result + i)</tt>.
+ *
+ *  \see \p min_element
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    segmented_min_element(RandomAccessIterator first,
+                          BeginOffsetIterator begin_offsets_first,
+                          BeginOffsetIterator begin_offsets_last,
+                          EndOffsetIterator end_offsets_first,
+                          OutputIterator result,
+                          BinaryPredicate comp);
+
+
+/*! \p segmented_max_element finds the largest element of every segment of a
+ *  sequence. The position of the first largest element of segment \c i,
+ *  as an offset from \p first, is written to <tt>*(result + i)</tt>.
+ *  The position written for an empty segment is its end offset.
+ *
+ *  This version compares elements using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the sequence of positions.
+ *  \return <tt>result + (begin_offsets_last - begin_offsets_first)</tt>
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i.
+ *
+ *  \see \p max_element
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result);
+
+
+/*! \p segmented_max_element finds the largest element of every segment of a
+ *  sequence, and writes its position as an offset from \p first to
+ *  <tt>*(result + i)</tt>.
+ *
+ *  This version compares elements using \c operator<.
+ *
+ *  \see \p max_element
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  OutputIterator segmented_max_element(RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result);
+
+
+/*! \p segmented_max_element finds the largest element of every segment of a
+ *  sequence, as defined by \p comp, and writes its position as an offset from
+ *  \p first to <tt>*(result + i)</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \see \p max_element
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_max_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp);
+
+
+/*! \p segmented_max_element finds the largest element of every segment of a
+ *  sequence, as defined by \p comp, and writes its position as an offset from
+ *  \p first to <tt>*(result + i)</tt>.
+ *
+ *  \see \p max_element
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value,
+    OutputIterator
+  >::type
+    segmented_max_element(RandomAccessIterator first,
+                          BeginOffsetIterator begin_offsets_first,
+                          BeginOffsetIterator begin_offsets_last,
+                          EndOffsetIterator end_offsets_first,
+                          OutputIterator result,
+                          BinaryPredicate comp);
+
+
+/*! \} // end reductions
+ */
+
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_reduce.inl>
@@ -0,0 +1,184 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/segmented_scan.h
+ *  \brief Prefix-sums of many independent segments of a sequence in one call
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup prefixsums Prefix Sums
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every
+ *  segment of a sequence independently. Segment \c i is the range
+ *  <tt>[first + begin_offsets_first[i], first + end_offsets_first[i])</tt>, and
+ *  its prefix sums are written to the same offsets of \p result. Elements of
+ *  \p result which correspond to no segment are left unchanged. Unlike
+ *  \p inclusive_scan_by_key, no key is read or compared per element.
+ *
+ *  This version of \p segmented_inclusive_scan uses \c operator+ as the scan operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *  \tparam BeginOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *  \pre \p first may equal \p result, but the range <tt>[first, first + n)</tt> and the range <tt>[result, result + n)</tt>
+ *       shall not overlap otherwise.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_inclusive_scan
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_scan.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int data[6]    = {1, 2, 3,   4,   5, 6};
+ *  int offsets[4] = {0, 3, 4, 6};
+ *
+ *  thrust::segmented_inclusive_scan(thrust::host, data, offsets, offsets + 3, offsets + 1, data); // in-place scan
+ *
+ *  // data is now {1, 3, 6,   4,   5, 11}
+ *  \endcode
+ *
+ *  \see \p inclusive_scan
+ *  \see \p inclusive_scan_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  void segmented_inclusive_scan(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result);
+
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every
+ *  segment of a sequence independently, and writes the prefix sums of segment
+ *  \c i to the same offsets of \p result.
+ *
+ *  This version of \p segmented_inclusive_scan uses \c operator+ as the scan operator.
+ *
+ *  \see \p inclusive_scan
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+  void segmented_inclusive_scan(RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result);
+
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every
+ *  segment of a sequence independently using \p binary_op, and writes the
+ *  prefix sums of segment \c i to the same offsets of \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param result The beginning of the output sequence.
+ *  \param binary_op The associative operator used to 'sum' values.
+ *
+ *  \tparam AssociativeOperator is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary Function</a>.
+ *
+ *  \see \p inclusive_scan
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+__host__ __device__
+  void segmented_inclusive_scan(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result,
+                                AssociativeOperator binary_op);
+
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every
+ *  segment of a sequence independently using \p binary_op, and writes the
+ *  prefix sums of segment \c i to the same offsets of \p result.
+ *
+ *  \see \p inclusive_scan
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    segmented_inclusive_scan(RandomAccessIterator first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             OutputIterator result,
+                             AssociativeOperator binary_op);
+
+
+/*! \} // end prefixsums
+ */
+
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_scan.inl>
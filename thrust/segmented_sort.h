@@ -0,0 +1,537 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/segmented_sort.h
+ *  \brief Sorting many independent segments of a sequence in one call
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p segmented_sort sorts each segment of the range <tt>[keys_first, keys_last)</tt>
+ *  independently into ascending order. Segment \c i is the range
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>,
+ *  and there are <tt>begin_offsets_last - begin_offsets_first</tt> segments.
+ *  Elements which belong to no segment are left in place.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence.
+ *  \param keys_last The end of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam BeginOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort
+ *  the rows of a ragged array using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[8]    = {3, 1, 2,   9, 7,   6, 4, 5};
+ *  int offsets[4] = {0, 3, 5, 8};
+ *
+ *  thrust::segmented_sort(thrust::host, keys, keys + 8, offsets, offsets + 3, offsets + 1);
+ *
+ *  // keys is now {1, 2, 3,   7, 9,   4, 5, 6}
+ *  \endcode
+ *
+ *  \see \p stable_segmented_sort
+ *  \see \p segmented_sort_by_key
+ *  \see \p sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first);
+
+
+/*! \p segmented_sort sorts each segment of the range <tt>[keys_first, keys_last)</tt>
+ *  independently into ascending order. Segment \c i is the range
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left in place.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  \param keys_first The beginning of the sequence.
+ *  \param keys_last The end of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *
+ *  \see \p stable_segmented_sort
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void segmented_sort(RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first);
+
+
+/*! \p segmented_sort sorts each segment of the range <tt>[keys_first, keys_last)</tt>
+ *  independently into ascending order, as defined by \p comp.
+ *  Segment \c i is the range
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left in place.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence.
+ *  \param keys_last The end of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int keys[8]    = {3, 1, 2,   9, 7,   6, 4, 5};
+ *  int offsets[4] = {0, 3, 5, 8};
+ *
+ *  thrust::segmented_sort(thrust::host, keys, keys + 8, offsets, offsets + 3, offsets + 1, thrust::greater<int>());
+ *
+ *  // keys is now {3, 2, 1,   9, 7,   6, 5, 4}
+ *  \endcode
+ *
+ *  \see \p stable_segmented_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort sorts each segment of the range <tt>[keys_first, keys_last)</tt>
+ *  independently into ascending order, as defined by \p comp.
+ *  Segment \c i is the range
+ *  <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>.
+ *  Elements which belong to no segment are left in place.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  \param keys_first The beginning of the sequence.
+ *  \param keys_last The end of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *
+ *  \see \p stable_segmented_sort
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort(RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp);
+
+
+/*! \p stable_segmented_sort is much like \c segmented_sort: it sorts each
+ *  segment of the range <tt>[keys_first, keys_last)</tt> independently into
+ *  ascending order. It is also guaranteed to preserve the relative order of
+ *  equivalent elements within each segment.
+ *
+ *  This version of \p stable_segmented_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the sequence.
+ *  \param keys_last The end of the sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *
+ *  \see \p segmented_sort
+ *  \see \p stable_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first);
+
+
+/*! \p stable_segmented_sort sorts each segment of the range
+ *  <tt>[keys_first, keys_last)</tt> independently into ascending order,
+ *  preserving the relative order of equivalent elements.
+ *
+ *  This version of \p stable_segmented_sort compares objects using \c operator<.
+ *
+ *  \see \p segmented_sort
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void stable_segmented_sort(RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first);
+
+
+/*! \p stable_segmented_sort sorts each segment of the range
+ *  <tt>[keys_first, keys_last)</tt> independently into ascending order, as
+ *  defined by \p comp, preserving the relative order of equivalent elements.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \see \p segmented_sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp);
+
+
+/*! \p stable_segmented_sort sorts each segment of the range
+ *  <tt>[keys_first, keys_last)</tt> independently into ascending order, as
+ *  defined by \p comp, preserving the relative order of equivalent elements.
+ *
+ *  \see \p segmented_sort
+ */
+template<typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort(RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of each segment of
+ *  the range <tt>[keys_first, keys_last)</tt> independently. Segment \c i is
+ *  the range <tt>[keys_first + begin_offsets_first[i], keys_first + end_offsets_first[i])</tt>
+ *  of keys together with the same range of values starting at \p values_first.
+ *  Elements which belong to no segment are left in place.
+ *  Note: \c segmented_sort_by_key is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort_by_key compares key objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_offsets_first The beginning of the sequence of segment begin offsets.
+ *  \param begin_offsets_last The end of the sequence of segment begin offsets.
+ *  \param end_offsets_first The beginning of the sequence of segment end offsets.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam BeginOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *  \tparam EndOffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          whose \c value_type is an integral type.
+ *
+ *  \pre <tt>begin_offsets_first[i] <= end_offsets_first[i]</tt> for every segment \c i,
+ *       and no two segments overlap.
+ *  \pre The range <tt>[keys_first, keys_last)</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key to
+ *  order the events of every user by timestamp using the \p thrust::host execution policy:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int  times[6]   = {30, 10, 20,   5,   8, 7};
+ *  char events[6]  = {'c', 'a', 'b', 'x', 'z', 'y'};
+ *  int  offsets[4] = {0, 3, 4, 6};
+ *
+ *  thrust::segmented_sort_by_key(thrust::host, times, times + 6, events, offsets, offsets + 3, offsets + 1);
+ *
+ *  // times  is now {10, 20, 30,   5,   7, 8}
+ *  // events is now {'a', 'b', 'c', 'x', 'y', 'z'}
+ *  \endcode
+ *
+ *  \see \p stable_segmented_sort_by_key
+ *  \see \p sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of each segment of
+ *  the range <tt>[keys_first, keys_last)</tt> independently.
+ *  Note: \c segmented_sort_by_key is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort_by_key compares key objects using \c operator<.
+ *
+ *  \see \p stable_segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of each segment of
+ *  the range <tt>[keys_first, keys_last)</tt> independently, ordering the keys
+ *  as defined by \p comp.
+ *  Note: \c segmented_sort_by_key is not guaranteed to be stable.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \see \p stable_segmented_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp);
+
+
+/*! \p segmented_sort_by_key performs a key-value sort of each segment of
+ *  the range <tt>[keys_first, keys_last)</tt> independently, ordering the keys
+ *  as defined by \p comp.
+ *  Note: \c segmented_sort_by_key is not guaranteed to be stable.
+ *
+ *  \see \p stable_segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp);
+
+
+/*! \p stable_segmented_sort_by_key performs a key-value sort of each segment
+ *  of the range <tt>[keys_first, keys_last)</tt> independently, preserving the
+ *  relative order of elements with equivalent keys within each segment.
+ *
+ *  This version of \p stable_segmented_sort_by_key compares key objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \see \p segmented_sort_by_key
+ *  \see \p stable_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first);
+
+
+/*! \p stable_segmented_sort_by_key performs a key-value sort of each segment
+ *  of the range <tt>[keys_first, keys_last)</tt> independently, preserving the
+ *  relative order of elements with equivalent keys within each segment.
+ *
+ *  This version of \p stable_segmented_sort_by_key compares key objects using \c operator<.
+ *
+ *  \see \p segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+  void stable_segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first);
+
+
+/*! \p stable_segmented_sort_by_key performs a key-value sort of each segment
+ *  of the range <tt>[keys_first, keys_last)</tt> independently, ordering the
+ *  keys as defined by \p comp and preserving the relative order of elements
+ *  with equivalent keys within each segment.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \see \p segmented_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp);
+
+
+/*! \p stable_segmented_sort_by_key performs a key-value sort of each segment
+ *  of the range <tt>[keys_first, keys_last)</tt> independently, ordering the
+ *  keys as defined by \p comp and preserving the relative order of elements
+ *  with equivalent keys within each segment.
+ *
+ *  \see \p segmented_sort_by_key
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort_by_key(RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_sort.inl>
@@ -0,0 +1,623 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file thrust/selection.h
+ *  \brief Partial sorting and selection of the smallest or largest elements
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/type_traits/is_execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> such that
+ *  the element pointed to by \p nth is the element which would be at that
+ *  position if the whole range were sorted, no element of <tt>[first, nth)</tt>
+ *  is greater than <tt>*nth</tt>, and no element of <tt>[nth, last)</tt> is
+ *  less than <tt>*nth</tt>. The order within the two parts is unspecified.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[7] = {5, 1, 6, 3, 7, 2, 4};
+ *
+ *  thrust::nth_element(thrust::host, A, A + 3, A + 7);
+ *
+ *  // A[3] is now 4, A[0] through A[2] are {1, 2, 3} in some order
+ *  // and A[4] through A[6] are {5, 6, 7} in some order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>*nth</tt> is the element which would be at that position in the sorted
+ *  range, and the elements before and after it are not greater and not less
+ *  than it, respectively.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \see \p partial_sort
+ */
+template<typename RandomAccessIterator>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> such that
+ *  the element pointed to by \p nth is the element which would be at that
+ *  position if the whole range were sorted by \p comp, no element of
+ *  <tt>[first, nth)</tt> is ordered after <tt>*nth</tt>, and no element of
+ *  <tt>[nth, last)</tt> is ordered before <tt>*nth</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p partial_sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>*nth</tt> is the element which would be at that position in the range
+ *  sorted by \p comp.
+ *
+ *  \see \p partial_sort
+ */
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    nth_element(RandomAccessIterator first,
+                RandomAccessIterator nth,
+                RandomAccessIterator last,
+                StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest elements
+ *  in ascending order. The order of the elements of <tt>[middle, last)</tt>
+ *  is unspecified. Note: \c partial_sort is not guaranteed to be stable.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[6] = {5, 1, 6, 3, 2, 4};
+ *
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + 6);
+ *
+ *  // A[0] through A[2] are now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest elements
+ *  in ascending order.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  \see \p nth_element
+ */
+template<typename RandomAccessIterator>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> first elements
+ *  of the range sorted by \p comp, in that order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p nth_element
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> such that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> first elements
+ *  of the range sorted by \p comp, in that order.
+ *
+ *  \see \p nth_element
+ */
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator>::value
+  >::type
+    partial_sort(RandomAccessIterator first,
+                 RandomAccessIterator middle,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the <tt>min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_last)</tt>
+ *  in ascending order. The input sequence is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return The end of the sorted output.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator2 is mutable,
+ *          and \p RandomAccessIterator2's \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[6] = {5, 1, 6, 3, 2, 4};
+ *  int B[3];
+ *
+ *  int *end = thrust::partial_sort_copy(thrust::host, A, A + 6, B, B + 3);
+ *
+ *  // B is now {1, 2, 3} and end == B + 3
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last);
+
+
+/*! \p partial_sort_copy copies the smallest elements of <tt>[first, last)</tt>
+ *  to <tt>[result_first, result_last)</tt> in ascending order.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  \see \p top_k
+ */
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+  RandomAccessIterator2 partial_sort_copy(RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last);
+
+
+/*! \p partial_sort_copy copies the <tt>min(last - first, result_last - result_first)</tt>
+ *  first elements of <tt>[first, last)</tt> in the order given by \p comp to
+ *  <tt>[result_first, result_last)</tt>, in that order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the sorted output.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last,
+                                          StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the first elements of <tt>[first, last)</tt>
+ *  in the order given by \p comp to <tt>[result_first, result_last)</tt>.
+ *
+ *  \see \p top_k
+ */
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    RandomAccessIterator2
+  >::type
+    partial_sort_copy(RandomAccessIterator1 first,
+                      RandomAccessIterator1 last,
+                      RandomAccessIterator2 result_first,
+                      RandomAccessIterator2 result_last,
+                      StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt> to
+ *  <tt>[result, result + k)</tt> in descending order. If the input holds
+ *  fewer than \p k elements, all of them are copied. The input sequence is
+ *  not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return <tt>result + min(k, last - first)</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + k)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three best scores using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float scores[6] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f, 0.8f};
+ *  float best[3];
+ *
+ *  thrust::top_k(thrust::host, scores, scores + 6, 3, best);
+ *
+ *  // best is now {0.9f, 0.8f, 0.7f}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result);
+
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt> to
+ *  <tt>[result, result + k)</tt> in descending order.
+ *
+ *  This version of \p top_k compares objects using \c operator>.
+ *
+ *  \see \p top_k_by_key
+ */
+template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+  RandomAccessIterator2 top_k(RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result);
+
+
+/*! \p top_k copies the \p k first elements of <tt>[first, last)</tt> in the
+ *  order given by \p comp to <tt>[result, result + k)</tt>, in that order.
+ *  With \c thrust::less, \p top_k selects the \p k smallest elements.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator, which orders the selected elements first.
+ *  \return <tt>result + min(k, last - first)</tt>
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p top_k_by_key
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result,
+                              StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the \p k first elements of <tt>[first, last)</tt> in the
+ *  order given by \p comp to <tt>[result, result + k)</tt>, in that order.
+ *
+ *  \see \p top_k_by_key
+ */
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    RandomAccessIterator2
+  >::type
+    top_k(RandomAccessIterator1 first,
+          RandomAccessIterator1 last,
+          typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+          RandomAccessIterator2 result,
+          StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the \p k largest keys of <tt>[keys_first, keys_last)</tt>
+ *  to <tt>[keys_result, keys_result + k)</tt> in descending order, and the
+ *  value associated with each selected key to the same position of
+ *  \p values_result. If the input holds fewer than \p k keys, all of them are
+ *  copied. The input sequences are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \return A \p pair of iterators to the ends of the output key and value sequences.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator3's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2's \c value_type is convertible to \p RandomAccessIterator4's \c value_type.
+ *  \tparam RandomAccessIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator3 is mutable.
+ *  \tparam RandomAccessIterator4 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>
+ *          and \p RandomAccessIterator4 is mutable.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find
+ *  the ids of the three best scores using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float scores[6] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f, 0.8f};
+ *  int   ids[6]    = {10, 11, 12, 13, 14, 15};
+ *  float best_scores[3];
+ *  int   best_ids[3];
+ *
+ *  thrust::top_k_by_key(thrust::host, scores, scores + 6, ids, 3, best_scores, best_ids);
+ *
+ *  // best_scores is now {0.9f, 0.8f, 0.7f}
+ *  // best_ids    is now {11, 15, 13}
+ *  \endcode
+ *
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result);
+
+
+/*! \p top_k_by_key copies the \p k largest keys of <tt>[keys_first, keys_last)</tt>
+ *  in descending order, together with their values, to \p keys_result and
+ *  \p values_result.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator>.
+ *
+ *  \see \p top_k
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result);
+
+
+/*! \p top_k_by_key copies the \p k first keys of <tt>[keys_first, keys_last)</tt>
+ *  in the order given by \p comp, together with their values, to
+ *  \p keys_result and \p values_result, in that order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \param comp Comparison operator, which orders the selected keys first.
+ *  \return A \p pair of iterators to the ends of the output key and value sequences.
+ *
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the \p k first keys of <tt>[keys_first, keys_last)</tt>
+ *  in the order given by \p comp, together with their values, to
+ *  \p keys_result and \p values_result.
+ *
+ *  \see \p top_k
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+  typename thrust::detail::disable_if<
+    thrust::is_execution_policy<RandomAccessIterator1>::value,
+    thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+  >::type
+    top_k_by_key(RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/selection.inl>
@@ -0,0 +1,284 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/shared_array_view.h
+ *  \brief A reference-counted, copy-on-write view of the elements of a
+ *         vector
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/vector_base.h>
+
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! A \p shared_array_view shares ownership of an array of elements with the
+ *  other \p shared_array_views it was copied from. Copying a view copies no
+ *  elements; the array is freed when the last view referring to it is
+ *  destroyed. The reference count is atomic, so views of the same array may
+ *  be copied and destroyed on different threads.
+ *
+ *  A view is created by moving a \p host_vector or \p device_vector into it,
+ *  which takes over its storage and allocator without copying. The elements
+ *  are read through \p begin and \p end, which are contiguous iterators of
+ *  the vector's memory space, so a view may be passed to any algorithm that
+ *  accepts the vector.
+ *
+ *  Elements are modified through \p mutable_begin, \p mutable_end and
+ *  \p mutable_data. These call \p detach, which first clones the array if
+ *  other views share it, so modifications are never visible through other
+ *  views. The clone uses the allocator of the array, and copies the elements
+ *  with the system of the allocator, or with the execution policy passed to
+ *  \p detach. Mutable iterators and pointers must not be used once the view
+ *  has been copied, since the copy would see modifications made through them.
+ *  When \p detach finds no other views, the reads through the views destroyed
+ *  before, on any thread, happen before the modifications through this one.
+ *
+ *  \tparam T The type of the elements.
+ *  \tparam Alloc The allocator of the array, the allocator of the vector the
+ *          view is created from.
+ *
+ *  The following code snippet demonstrates how to pass a vector to several
+ *  stages without copying it, one of which modifies its own version.
+ *
+ *  \code
+ *  #include <thrust/shared_array_view.h>
+ *  #include <thrust/host_vector.h>
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  ...
+ *  thrust::host_vector<int> h(1 << 20);
+ *  ...
+ *  thrust::shared_array_view<int> input(std::move(h));
+ *
+ *  // a copy shares the elements
+ *  thrust::shared_array_view<int> stage = input;
+ *  int sum = thrust::reduce(stage.begin(), stage.end());
+ *
+ *  // the first modification clones the elements, in parallel
+ *  stage.detach(thrust::omp::par);
+ *  thrust::sort(thrust::omp::par, stage.mutable_begin(), stage.mutable_end());
+ *
+ *  // input is unchanged
+ *  \endcode
+ *
+ *  \see host_vector
+ *  \see device_vector
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class shared_array_view
+{
+  private:
+    typedef thrust::detail::vector_base<T, Alloc> storage_type;
+
+  public:
+    /*! \cond
+     */
+    typedef typename storage_type::value_type      value_type;
+    typedef typename storage_type::allocator_type  allocator_type;
+    typedef typename storage_type::size_type       size_type;
+    typedef typename storage_type::difference_type difference_type;
+    typedef typename storage_type::const_pointer   const_pointer;
+    typedef typename storage_type::const_reference const_reference;
+    typedef typename storage_type::const_iterator  const_iterator;
+
+    // the elements of a view are read-only
+    typedef const_pointer   pointer;
+    typedef const_reference reference;
+    typedef const_iterator  iterator;
+
+    typedef typename storage_type::pointer   mutable_pointer;
+    typedef typename storage_type::iterator  mutable_iterator;
+    /*! \endcond
+     */
+
+    /*! This constructor creates an empty \p shared_array_view, which refers
+     *  to no array.
+     */
+    shared_array_view() noexcept;
+
+    /*! This constructor takes over the storage of a vector, without copying
+     *  its elements. The vector is left empty.
+     *  \param v The \p host_vector or \p device_vector to take the elements
+     *         of.
+     */
+    explicit shared_array_view(storage_type &&v);
+
+    /*! This constructor copies the elements of a vector into a new array.
+     *  \param v The \p host_vector or \p device_vector to copy.
+     */
+    explicit shared_array_view(const storage_type &v);
+
+    /*! Copy constructor shares the array of another \p shared_array_view.
+     *  No elements are copied.
+     *  \param other The \p shared_array_view to share the array of.
+     */
+    shared_array_view(const shared_array_view &other) = default;
+
+    /*! Move constructor takes the reference of another
+     *  \p shared_array_view, which is left empty.
+     *  \param other The \p shared_array_view to move from.
+     */
+    shared_array_view(shared_array_view &&other) noexcept = default;
+
+    /*! Copy assign operator shares the array of another
+     *  \p shared_array_view, releasing the current one.
+     *  \param other The \p shared_array_view to share the array of.
+     */
+    shared_array_view &operator=(const shared_array_view &other) = default;
+
+    /*! Move assign operator takes the reference of another
+     *  \p shared_array_view, releasing the current one.
+     *  \param other The \p shared_array_view to move from.
+     */
+    shared_array_view &operator=(shared_array_view &&other) noexcept = default;
+
+    /*! Returns the number of elements of the array.
+     */
+    size_type size() const;
+
+    /*! Returns \c true if the view refers to no elements.
+     */
+    bool empty() const;
+
+    /*! Returns the number of \p shared_array_views referring to the array,
+     *  including this one, or 0 if this view is empty.
+     */
+    long use_count() const noexcept;
+
+    /*! Returns \c true if this is the only \p shared_array_view referring to
+     *  the array, so that modifying it does not clone it. Reads of the array
+     *  through views released on other threads happen before writes which
+     *  follow a \c true result.
+     */
+    bool unique() const noexcept;
+
+    /*! Returns a copy of the allocator of the array. This view must refer to
+     *  an array, i.e. must not be default-constructed, \p reset or moved from.
+     */
+    allocator_type get_allocator() const;
+
+    /*! Returns a read-only iterator pointing to the first element.
+     */
+    const_iterator begin() const;
+
+    /*! \copydoc begin */
+    const_iterator cbegin() const;
+
+    /*! Returns a read-only iterator pointing one past the last element.
+     */
+    const_iterator end() const;
+
+    /*! \copydoc end */
+    const_iterator cend() const;
+
+    /*! Returns a read-only pointer to the first element.
+     */
+    const_pointer data() const;
+
+    /*! Returns a read-only reference to element \p n.
+     *  \param n The index of the element.
+     */
+    const_reference operator[](size_type n) const;
+
+    /*! Makes this the only \p shared_array_view referring to its array, by
+     *  cloning the array if other views share it. The clone is allocated with
+     *  the allocator of the array, and the elements are copied with its
+     *  system.
+     */
+    void detach();
+
+    /*! Makes this the only \p shared_array_view referring to its array, by
+     *  cloning the array if other views share it. The clone is allocated with
+     *  the allocator of the array, and the elements are copied with \p exec
+     *  when \p exec can access the memory of the allocator.
+     *  \param exec The execution policy to copy the elements with.
+     */
+    template<typename DerivedPolicy>
+    void detach(const thrust::detail::execution_policy_base<DerivedPolicy> &exec);
+
+    /*! Calls \p detach and returns an iterator pointing to the first
+     *  element, through which elements may be modified.
+     */
+    mutable_iterator mutable_begin();
+
+    /*! Calls \p detach and returns an iterator pointing one past the last
+     *  element, through which elements may be modified.
+     */
+    mutable_iterator mutable_end();
+
+    /*! Calls \p detach and returns a pointer to the first element, through
+     *  which elements may be modified.
+     */
+    mutable_pointer mutable_data();
+
+    /*! Releases the reference to the array, leaving this view empty.
+     */
+    void reset() noexcept;
+
+    /*! Swaps the arrays two \p shared_array_views refer to.
+     *  \param other The \p shared_array_view to swap with.
+     */
+    void swap(shared_array_view &other) noexcept;
+
+  private:
+    std::shared_ptr<storage_type> m_storage;
+
+    // whether other views refer to the array. A false result acquires the
+    // release of the array by the views destroyed before it
+    bool shared() const noexcept;
+};
+
+/*! Creates a \p shared_array_view taking over the storage of a vector, with
+ *  the element type and allocator of the vector.
+ *  \param v The \p host_vector or \p device_vector to take the elements of.
+ *         It is left empty.
+ */
+template<typename T, typename Alloc>
+shared_array_view<T, Alloc> make_shared_array_view(thrust::detail::vector_base<T, Alloc> &&v);
+
+/*! Exchanges the arrays two \p shared_array_views refer to.
+ *  \param a The first \p shared_array_view of interest.
+ *  \param b The second \p shared_array_view of interest.
+ */
+template<typename T, typename Alloc>
+void swap(shared_array_view<T, Alloc> &a, shared_array_view<T, Alloc> &b) noexcept
+{
+  a.swap(b);
+}
+
+/*! \} // containers
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/shared_array_view.inl>
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -0,0 +1,442 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/soa_vector.h
+ *  \brief A resizable structure-of-arrays container whose columns share one
+ *         allocation
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/device_allocator.h>
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/integer_sequence.h>
+
+#include <cstddef>
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+namespace soa_vector_detail
+{
+
+constexpr std::size_t max_of(std::size_t a)
+{
+  return a;
+}
+
+template<typename... Sizes>
+constexpr std::size_t max_of(std::size_t a, std::size_t b, Sizes... rest)
+{
+  return max_of(a < b ? b : a, rest...);
+}
+
+template<typename Tuple, typename Indices>
+struct max_field_alignment;
+
+template<typename Tuple, std::size_t... I>
+struct max_field_alignment<Tuple, thrust::index_sequence<I...>>
+{
+  static const std::size_t value = max_of(alignof(typename thrust::tuple_element<I, Tuple>::type)...);
+};
+
+// the unit the columns are allocated in, so that the block is aligned for
+// every field whatever alignment the allocator is asked for
+template<std::size_t Alignment>
+struct alignas(Alignment) storage_unit
+{
+  unsigned char bytes[Alignment];
+};
+
+} // end soa_vector_detail
+} // end detail
+
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! A \p soa_vector stores a sequence of tuples as a structure of arrays:
+ *  every field of \p Tuple is kept in its own contiguous column, so that an
+ *  algorithm reading only some of the fields touches only their columns.
+ *  All columns live in a single block obtained from \p Alloc, one after the
+ *  other, and are reallocated together when the capacity grows.
+ *
+ *  \p begin and \p end return \p zip_iterators over all the columns, so the
+ *  container may be passed to any algorithm as a range of \p Tuple.
+ *  \p column returns the first element of a single column, and \p columns a
+ *  \p zip_iterator over a subset of them, e.g. the values of a
+ *  \p sort_by_key whose keys are another column.
+ *
+ *  The fields of \p Tuple must be trivially copyable; elements are created
+ *  and moved by the algorithms of the allocator's system, without calling
+ *  constructors or destructors.
+ *
+ *  \tparam Tuple A \p thrust::tuple of the field types.
+ *  \tparam Alloc The allocator the columns are allocated from. It is rebound
+ *          to an internal storage type aligned for every field.
+ *
+ *  The following code snippet demonstrates how to sort the records of a
+ *  \p soa_vector by their first field.
+ *
+ *  \code
+ *  #include <thrust/soa_vector.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::soa_vector<thrust::tuple<int, float, char>> v;
+ *  v.push_back(thrust::make_tuple(2, 2.0f, 'b'));
+ *  v.push_back(thrust::make_tuple(1, 1.0f, 'a'));
+ *
+ *  thrust::sort_by_key(v.column<0>(), v.column<0>() + v.size(), v.columns<1, 2>());
+ *
+ *  // v is now {(1, 1.0f, 'a'), (2, 2.0f, 'b')}
+ *  \endcode
+ *
+ *  \see device_vector
+ *  \see zip_iterator
+ */
+template<typename Tuple, typename Alloc = thrust::device_allocator<Tuple>>
+class soa_vector
+{
+  private:
+    static const std::size_t num_columns = thrust::tuple_size<Tuple>::value;
+    typedef thrust::make_index_sequence<num_columns> column_indices;
+
+    static const std::size_t unit_size =
+      thrust::detail::soa_vector_detail::max_field_alignment<Tuple, column_indices>::value;
+    typedef thrust::detail::soa_vector_detail::storage_unit<unit_size> storage_unit;
+
+    typedef thrust::detail::allocator_traits<Alloc> alloc_traits;
+    typedef typename alloc_traits::template rebind_alloc<storage_unit> storage_allocator;
+    typedef thrust::detail::allocator_traits<storage_allocator> storage_traits;
+    typedef typename storage_traits::pointer storage_pointer;
+
+    template<typename Indices> struct zipped;
+
+  public:
+    /*! \cond
+     */
+    typedef Tuple       value_type;
+    typedef Alloc       allocator_type;
+    typedef std::size_t size_type;
+    typedef typename storage_traits::difference_type difference_type;
+    /*! \endcond
+     */
+
+    /*! The type of the elements of column \p I.
+     */
+    template<std::size_t I>
+    using column_value_type = typename thrust::tuple_element<I, Tuple>::type;
+
+    /*! The pointer type of column \p I, e.g. \p device_ptr for a device
+     *  allocator.
+     */
+    template<std::size_t I>
+    using column_pointer = typename thrust::detail::pointer_traits<storage_pointer>::template rebind<column_value_type<I>>::other;
+
+    /*! The pointer type of column \p I of a \c const \p soa_vector.
+     */
+    template<std::size_t I>
+    using const_column_pointer = typename thrust::detail::pointer_traits<storage_pointer>::template rebind<const column_value_type<I>>::other;
+
+    /*! The type of the \p zip_iterator over columns \p I... returned by
+     *  \p columns.
+     */
+    template<std::size_t... I>
+    using columns_iterator = thrust::zip_iterator<thrust::tuple<column_pointer<I>...>>;
+
+    /*! The type of the \p zip_iterator over columns \p I... of a \c const
+     *  \p soa_vector.
+     */
+    template<std::size_t... I>
+    using const_columns_iterator = thrust::zip_iterator<thrust::tuple<const_column_pointer<I>...>>;
+
+  private:
+    template<std::size_t... I>
+    struct zipped<thrust::index_sequence<I...>>
+    {
+      typedef columns_iterator<I...>       iterator;
+      typedef const_columns_iterator<I...> const_iterator;
+
+      static const bool trivially_copyable =
+        std::is_same<thrust::integer_sequence<bool, true, std::is_trivially_copyable<column_value_type<I>>::value...>,
+                     thrust::integer_sequence<bool, std::is_trivially_copyable<column_value_type<I>>::value..., true>>::value;
+    };
+
+    static_assert(num_columns > 0, "soa_vector requires at least one field");
+    static_assert(zipped<column_indices>::trivially_copyable, "soa_vector requires trivially copyable fields");
+
+  public:
+    /*! \cond
+     */
+    typedef typename zipped<column_indices>::iterator       iterator;
+    typedef typename zipped<column_indices>::const_iterator const_iterator;
+    typedef typename thrust::iterator_reference<iterator>::type       reference;
+    typedef typename thrust::iterator_reference<const_iterator>::type const_reference;
+    /*! \endcond
+     */
+
+    /*! This constructor creates an empty \p soa_vector.
+     */
+    soa_vector();
+
+    /*! This constructor creates an empty \p soa_vector.
+     *  \param alloc The allocator to use by this \p soa_vector.
+     */
+    explicit soa_vector(const Alloc &alloc);
+
+    /*! This constructor creates a \p soa_vector with value-initialized
+     *  elements.
+     *  \param n The number of elements to create.
+     *  \param alloc The allocator to use by this \p soa_vector.
+     */
+    explicit soa_vector(size_type n, const Alloc &alloc = Alloc());
+
+    /*! This constructor creates a \p soa_vector with copies of an exemplar
+     *  element.
+     *  \param n The number of elements to create.
+     *  \param value An element to copy.
+     *  \param alloc The allocator to use by this \p soa_vector.
+     */
+    soa_vector(size_type n, const value_type &value, const Alloc &alloc = Alloc());
+
+    /*! Copy constructor copies from another \p soa_vector, with a capacity
+     *  equal to its size.
+     *  \param other The \p soa_vector to copy.
+     */
+    soa_vector(const soa_vector &other);
+
+    /*! Move constructor takes the columns of another \p soa_vector, which is
+     *  left empty.
+     *  \param other The \p soa_vector to move from.
+     */
+    soa_vector(soa_vector &&other) noexcept;
+
+    /*! The destructor returns the columns to the allocator.
+     */
+    ~soa_vector();
+
+    /*! Copy assign operator copies the elements of another \p soa_vector,
+     *  reusing the current columns when they are large enough.
+     *  \param other The \p soa_vector to copy.
+     */
+    soa_vector &operator=(const soa_vector &other);
+
+    /*! Move assign operator swaps the contents of two \p soa_vectors.
+     *  \param other The \p soa_vector to move from.
+     */
+    soa_vector &operator=(soa_vector &&other) noexcept;
+
+    /*! This method replaces the contents of this \p soa_vector with a copy of
+     *  a range of tuples.
+     *  \param first The beginning of the range to copy.
+     *  \param last The end of the range to copy.
+     *
+     *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward Iterator</a>
+     *          whose \c value_type is convertible to \p Tuple.
+     */
+    template<typename InputIterator>
+    void assign(InputIterator first, InputIterator last);
+
+    /*! Returns the number of elements in this \p soa_vector.
+     */
+    size_type size() const
+    {
+      return m_size;
+    }
+
+    /*! Returns the number of elements which have been reserved in this
+     *  \p soa_vector.
+     */
+    size_type capacity() const
+    {
+      return m_capacity;
+    }
+
+    /*! Returns the largest possible size of this \p soa_vector.
+     */
+    size_type max_size() const;
+
+    /*! Returns \c true if this \p soa_vector holds no elements.
+     */
+    bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    /*! If \p n is greater than the capacity, this method reallocates all
+     *  columns into one new block able to hold \p n elements, copying the
+     *  elements; otherwise it does nothing.
+     *  \param n The number of elements to reserve.
+     *  \throw std::length_error If \p n exceeds max_size().
+     */
+    void reserve(size_type n);
+
+    /*! Resizes this \p soa_vector to the specified number of elements,
+     *  value-initializing new ones.
+     *  \param new_size Number of elements this \p soa_vector should contain.
+     *  \throw std::length_error If \p new_size exceeds max_size().
+     */
+    void resize(size_type new_size);
+
+    /*! Resizes this \p soa_vector to the specified number of elements,
+     *  copying \p x into new ones.
+     *  \param new_size Number of elements this \p soa_vector should contain.
+     *  \param x Data with which new elements should be populated.
+     *  \throw std::length_error If \p new_size exceeds max_size().
+     */
+    void resize(size_type new_size, const value_type &x);
+
+    /*! Reallocates the columns so that the capacity equals the size.
+     */
+    void shrink_to_fit();
+
+    /*! Appends an element, reallocating all columns if the capacity is
+     *  exhausted. Every field is written to its column.
+     *  \param x The element to append.
+     */
+    void push_back(const value_type &x);
+
+    /*! Removes the last element.
+     */
+    void pop_back();
+
+    /*! Removes all elements. The capacity is unchanged.
+     */
+    void clear();
+
+    /*! Swaps the contents and allocators of two \p soa_vectors.
+     *  \param other The \p soa_vector to swap with.
+     */
+    void swap(soa_vector &other);
+
+    /*! Returns a copy of the allocator of this \p soa_vector.
+     */
+    allocator_type get_allocator() const;
+
+    /*! Returns a \p zip_iterator over all the columns, pointing to the first
+     *  element.
+     */
+    iterator begin();
+
+    /*! \copydoc begin */
+    const_iterator begin() const;
+
+    /*! \copydoc begin */
+    const_iterator cbegin() const;
+
+    /*! Returns a \p zip_iterator over all the columns, pointing one past the
+     *  last element.
+     */
+    iterator end();
+
+    /*! \copydoc end */
+    const_iterator end() const;
+
+    /*! \copydoc end */
+    const_iterator cend() const;
+
+    /*! Returns a tuple of references to the fields of element \p n.
+     *  \param n The index of the element.
+     */
+    reference operator[](size_type n);
+
+    /*! \copydoc operator[] */
+    const_reference operator[](size_type n) const;
+
+    /*! Returns a pointer to the first element of column \p I. The column
+     *  holds \p size() elements.
+     */
+    template<std::size_t I>
+    column_pointer<I> column();
+
+    /*! \copydoc column */
+    template<std::size_t I>
+    const_column_pointer<I> column() const;
+
+    /*! Returns a \p zip_iterator over columns \p I..., pointing to the first
+     *  element.
+     */
+    template<std::size_t... I>
+    columns_iterator<I...> columns();
+
+    /*! \copydoc columns */
+    template<std::size_t... I>
+    const_columns_iterator<I...> columns() const;
+
+  private:
+    // the byte offset of a column within a block of the given capacity;
+    // column num_columns gives the size of the columns together
+    static size_type column_offset(size_type column, size_type capacity);
+
+    template<std::size_t... I>
+    static size_type column_offset(size_type column, size_type capacity, thrust::index_sequence<I...>);
+
+    // the number of storage units of a block of the given capacity
+    static size_type block_units(size_type capacity);
+
+    template<std::size_t I>
+    static column_pointer<I> column_in(storage_pointer data, size_type capacity);
+
+    template<std::size_t... I>
+    static iterator begin_in(storage_pointer data, size_type capacity, thrust::index_sequence<I...>);
+
+    template<std::size_t... I>
+    const_iterator begin_in(thrust::index_sequence<I...>) const;
+
+    typename thrust::detail::allocator_system<storage_allocator>::get_result_type system();
+
+    void reallocate(size_type new_capacity);
+
+    void grow(size_type new_size);
+
+    void deallocate();
+
+    storage_allocator m_allocator;
+    storage_pointer   m_data;
+    size_type         m_size;
+    size_type         m_capacity;
+};
+
+/*! Exchanges the contents of two \p soa_vectors.
+ *  \param a The first \p soa_vector of interest.
+ *  \param b The second \p soa_vector of interest.
+ */
+template<typename Tuple, typename Alloc>
+void swap(soa_vector<Tuple, Alloc> &a, soa_vector<Tuple, Alloc> &b)
+{
+  a.swap(b);
+}
+
+/*! \} // containers
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/soa_vector.inl>
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -23,6 +23,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/execution_policy.h>
+#include <thrust/radix_key.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -928,6 +929,259 @@ template<typename RandomAccessIterator1,
                           StrictWeakOrdering comp);
 
 
+/*! \p sort sorts the elements in <tt>[first, last)</tt> into ascending
+ *  order of the bits <tt>[begin_bit, end_bit)</tt> of their order-preserving
+ *  unsigned representation. Elements which agree on those bits are
+ *  equivalent. Like all versions of \p sort, this one is not guaranteed to
+ *  be stable.
+ *
+ *  When the significant bits of the keys are known, for example because they
+ *  hold 20-bit bucket identifiers in 32-bit integers, this version lets a
+ *  radix sort skip the passes over bits which are constant. It is equivalent
+ *  to sorting with <tt>thrust::bit_range_less<T>(begin_bit, end_bit)</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p sort to sort keys
+ *  by their low 20 bits using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 4;
+ *  unsigned int A[N] = {0x300003, 0x100001, 0xF00002, 0x200000};
+ *  thrust::sort(thrust::host, A, A + N, 0, 20);
+ *  // A is now {0x200000, 0x100001, 0xF00002, 0x300003};
+ *  \endcode
+ *
+ *  \see \p bit_range_less
+ *  \see \p stable_sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            int begin_bit,
+            int end_bit);
+
+
+/*! \p sort sorts the elements in <tt>[first, last)</tt> into ascending
+ *  order of the bits <tt>[begin_bit, end_bit)</tt> of their order-preserving
+ *  unsigned representation.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  \see \p bit_range_less
+ */
+template<typename RandomAccessIterator>
+  void sort(RandomAccessIterator first,
+            RandomAccessIterator last,
+            int begin_bit,
+            int end_bit);
+
+
+/*! \p stable_sort sorts the elements in <tt>[first, last)</tt> into
+ *  ascending order of the bits <tt>[begin_bit, end_bit)</tt> of their
+ *  order-preserving unsigned representation, and preserves the relative
+ *  order of elements which agree on those bits. It is equivalent to
+ *  sorting with <tt>thrust::bit_range_less<T>(begin_bit, end_bit)</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  \see \p bit_range_less
+ *  \see \p sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void stable_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   int begin_bit,
+                   int end_bit);
+
+
+/*! \p stable_sort sorts the elements in <tt>[first, last)</tt> into
+ *  ascending order of the bits <tt>[begin_bit, end_bit)</tt> of their
+ *  order-preserving unsigned representation, and preserves the relative
+ *  order of elements which agree on those bits.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  \see \p bit_range_less
+ */
+template<typename RandomAccessIterator>
+  void stable_sort(RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   int begin_bit,
+                   int end_bit);
+
+
+/*! \p sort_by_key performs a key-value sort which orders the keys in
+ *  <tt>[keys_first, keys_last)</tt> by the bits <tt>[begin_bit, end_bit)</tt>
+ *  of their order-preserving unsigned representation, and permutes the
+ *  values starting at \p values_first in the same way. It is equivalent to
+ *  sorting with <tt>thrust::bit_range_less<T>(begin_bit, end_bit)</tt>, and
+ *  is not guaranteed to be stable.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is an arithmetic type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  \see \p bit_range_less
+ *  \see \p stable_sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   int begin_bit,
+                   int end_bit);
+
+
+/*! \p sort_by_key performs a key-value sort which orders the keys in
+ *  <tt>[keys_first, keys_last)</tt> by the bits <tt>[begin_bit, end_bit)</tt>
+ *  of their order-preserving unsigned representation.
+ *
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  \see \p bit_range_less
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void sort_by_key(RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   int begin_bit,
+                   int end_bit);
+
+
+/*! \p stable_sort_by_key performs a key-value sort which orders the keys in
+ *  <tt>[keys_first, keys_last)</tt> by the bits <tt>[begin_bit, end_bit)</tt>
+ *  of their order-preserving unsigned representation, permutes the values
+ *  starting at \p values_first in the same way, and preserves the relative
+ *  order of keys which agree on those bits.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is an arithmetic type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *
+ *  \see \p bit_range_less
+ *  \see \p sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void stable_sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_first,
+                          RandomAccessIterator1 keys_last,
+                          RandomAccessIterator2 values_first,
+                          int begin_bit,
+                          int end_bit);
+
+
+/*! \p stable_sort_by_key performs a key-value sort which orders the keys in
+ *  <tt>[keys_first, keys_last)</tt> by the bits <tt>[begin_bit, end_bit)</tt>
+ *  of their order-preserving unsigned representation, and preserves the
+ *  relative order of keys which agree on those bits.
+ *
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit which is sorted on.
+ *  \param end_bit One past the most significant bit which is sorted on.
+ *
+ *  \pre <tt>0 <= begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  \see \p bit_range_less
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void stable_sort_by_key(RandomAccessIterator1 keys_first,
+                          RandomAccessIterator1 keys_last,
+                          RandomAccessIterator2 values_first,
+                          int begin_bit,
+                          int end_bit);
+
+
 /*! \} // end sorting
  */
 
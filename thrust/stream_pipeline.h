@@ -0,0 +1,190 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file thrust/stream_pipeline.h
+ *  \brief Processes a stream of batches with input, compute and output
+ *         overlapped over rotating buffers
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/stream_pipeline.h>
+#include <thrust/mr/memory_resource.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup pipelines Pipelines
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p stream_pipeline_options controls the buffers of \p stream_pipeline.
+ */
+struct stream_pipeline_options
+{
+  /*! The capacity of every buffer, in elements. */
+  std::size_t batch_size = std::size_t(1) << 20;
+
+  /*! The number of rotating buffers. With three buffers, ingesting,
+   *  computing and draining can all proceed at once; with one, the stages
+   *  run one after the other.
+   */
+  std::size_t num_buffers = 3;
+
+  /*! The memory resource the buffers are allocated from, once, when the
+   *  pipeline starts. If null, \p thrust::mr::new_delete_resource is used.
+   */
+  thrust::mr::memory_resource<> *resource = nullptr;
+};
+
+
+/*! \p stream_pipeline_statistics reports the work done by each stage of
+ *  \p stream_pipeline. The busy times are measured around the calls of the
+ *  stage's function object. When the stages overlap, \p elapsed_seconds is
+ *  less than the sum of the busy times.
+ */
+struct stream_pipeline_statistics
+{
+  /*! The number of batches processed. */
+  std::size_t num_batches = 0;
+
+  /*! The number of elements ingested. */
+  std::size_t num_elements = 0;
+
+  /*! The number of elements drained. */
+  std::size_t num_drained = 0;
+
+  /*! The time spent in \p source. */
+  double ingest_seconds = 0;
+
+  /*! The time spent in \p compute. */
+  double compute_seconds = 0;
+
+  /*! The time spent in \p sink. */
+  double drain_seconds = 0;
+
+  /*! The wall-clock time of the whole pipeline. */
+  double elapsed_seconds = 0;
+};
+
+
+/*! \p stream_pipeline processes a stream of batches in three overlapped
+ *  stages. A fixed set of buffers is allocated once from
+ *  <tt>options.resource</tt> and rotates between the stages:
+ *
+ *  - \p source fills a free buffer on an ingest thread. It is called as
+ *    <tt>source(buffer, capacity)</tt> with a <tt>T*</tt> and a
+ *    \c std::size_t, stores up to \p capacity elements and returns their
+ *    number. Returning zero ends the stream.
+ *  - \p compute transforms the batch in place on the calling thread. It is
+ *    called as <tt>compute(exec, first, last)</tt> with the execution
+ *    policy and two <tt>T*</tt>, so it may run any Thrust algorithm on the
+ *    batch, and returns the end of its output, which starts at \p first.
+ *  - \p sink consumes the result on a drain thread. It is called as
+ *    <tt>sink(data, n)</tt> with a <tt>const T*</tt> and a \c std::size_t,
+ *    after which the buffer is reused for ingestion.
+ *
+ *  Batches reach \p sink in the order \p source produced them. Each function
+ *  object is only ever called by one thread at a time. If any of them
+ *  throws, the pipeline stops, waits for the other stages and rethrows the
+ *  first exception.
+ *
+ *  The buffers are in host memory, so \p exec must be a policy whose
+ *  algorithms may access host memory, such as \p thrust::host,
+ *  \p thrust::omp::par or \p thrust::tbb::par. On a node without an
+ *  accelerator, this overlaps file or network input with OpenMP or TBB
+ *  compute.
+ *
+ *  \param exec The execution policy passed to \p compute.
+ *  \param source The function object producing the batches.
+ *  \param compute The function object processing each batch.
+ *  \param sink The function object consuming the results.
+ *  \param options The batch size, the number of buffers and their memory resource.
+ *  \return The element counts and per-stage timings of the run.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam Source is a function object type with the signature described above.
+ *  \tparam Compute is a function object type with the signature described above.
+ *  \tparam Sink is a function object type with the signature described above.
+ *
+ *  The following code snippet demonstrates how to use \p stream_pipeline to
+ *  square the integers of a binary file batch by batch with OpenMP, while
+ *  the next batch is read and the previous one is written:
+ *
+ *  \code
+ *  #include <thrust/stream_pipeline.h>
+ *  #include <thrust/transform.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <cstdio>
+ *
+ *  struct square
+ *  {
+ *    __host__ __device__ int operator()(int x) const { return x * x; }
+ *  };
+ *  ...
+ *  std::FILE *input  = std::fopen("in.bin", "rb");
+ *  std::FILE *output = std::fopen("out.bin", "wb");
+ *
+ *  auto source = [&](int *buffer, std::size_t capacity)
+ *  {
+ *    return std::fread(buffer, sizeof(int), capacity, input);
+ *  };
+ *  auto compute = [](const auto &exec, int *first, int *last)
+ *  {
+ *    return thrust::transform(exec, first, last, first, square());
+ *  };
+ *  auto sink = [&](const int *data, std::size_t n)
+ *  {
+ *    std::fwrite(data, sizeof(int), n, output);
+ *  };
+ *
+ *  thrust::stream_pipeline_statistics stats =
+ *    thrust::stream_pipeline<int>(thrust::omp::par, source, compute, sink, thrust::stream_pipeline_options());
+ *  \endcode
+ *
+ *  \see \c pipeline
+ *  \see \c external_sort
+ */
+template<typename T, typename DerivedPolicy, typename Source, typename Compute, typename Sink>
+stream_pipeline_statistics stream_pipeline(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                           Source source,
+                                           Compute compute,
+                                           Sink sink,
+                                           const stream_pipeline_options &options);
+
+
+/*! \} // end pipelines
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/stream_pipeline.inl>
+
+#endif // THRUST_CPP_DIALECT >= 2011
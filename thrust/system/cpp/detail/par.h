@@ -20,6 +20,11 @@
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
 
+#if THRUST_CPP_DIALECT >= 2011
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/scratch_arena.h>
+#endif
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -35,6 +40,15 @@ struct par_t : thrust::system::cpp::detail::execution_policy<par_t>,
 {
   __host__ __device__
   constexpr par_t() : thrust::system::cpp::detail::execution_policy<par_t>() {}
+
+#if THRUST_CPP_DIALECT >= 2011
+  // temporary storage of the resulting policy comes from arena
+  execute_with_memory_resource_type<thrust::mr::scratch_arena>::type
+    with_scratch_arena(thrust::mr::scratch_arena &arena) const
+  {
+    return (*this)(&arena);
+  }
+#endif
 };
 
 
@@ -18,5 +18,74 @@
 
 #include <thrust/detail/config.h>
 
-// this system has no special temporary buffer functions
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/generic/temporary_buffer.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/mr/scratch_arena.h>
+#include <thrust/pair.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+
+
+// temporary storage of the cpp system and the systems deriving from it
+// (omp and tbb) comes from the default scratch arena, when one is installed.
+// execute_with_allocator's overloads are exact matches and keep precedence
+// over these, so a policy given an allocator bypasses the default arena
+
+template<typename T, typename DerivedPolicy>
+  thrust::pair<thrust::pointer<T,DerivedPolicy>, typename thrust::pointer<T,DerivedPolicy>::difference_type>
+    get_temporary_buffer(execution_policy<DerivedPolicy> &exec, typename thrust::pointer<T,DerivedPolicy>::difference_type n)
+{
+  thrust::mr::scratch_arena *arena = thrust::mr::get_default_scratch_arena();
+
+  if(!arena)
+  {
+    return thrust::system::detail::generic::get_temporary_buffer<T>(exec, n);
+  } // end if
+
+  const std::size_t alignment = alignof(T) > THRUST_MR_DEFAULT_ALIGNMENT ? alignof(T) : THRUST_MR_DEFAULT_ALIGNMENT;
+
+  T *ptr = static_cast<T*>(arena->allocate(n * sizeof(T), alignment));
+
+  return thrust::make_pair(thrust::pointer<T,DerivedPolicy>(ptr), n);
+} // end get_temporary_buffer()
+
+
+template<typename DerivedPolicy, typename Pointer>
+  void return_temporary_buffer(execution_policy<DerivedPolicy> &exec, Pointer p, std::ptrdiff_t n)
+{
+  thrust::mr::scratch_arena *arena = thrust::mr::get_default_scratch_arena();
+
+  if(!arena)
+  {
+    thrust::system::detail::generic::return_temporary_buffer(exec, p, n);
+    return;
+  } // end if
+
+  typedef typename thrust::detail::pointer_element<Pointer>::type T;
+
+  const std::size_t alignment = alignof(T) > THRUST_MR_DEFAULT_ALIGNMENT ? alignof(T) : THRUST_MR_DEFAULT_ALIGNMENT;
+
+  arena->deallocate(thrust::raw_pointer_cast(p), n * sizeof(T), alignment);
+} // end return_temporary_buffer()
+
+
+} // end detail
+} // end cpp
+} // end system
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
 
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -44,11 +45,13 @@
 #include <thrust/system/cpp/detail/gather.h>
 #include <thrust/system/cpp/detail/generate.h>
 #include <thrust/system/cpp/detail/get_value.h>
+#include <thrust/system/cpp/detail/histogram.h>
 #include <thrust/system/cpp/detail/inner_product.h>
 #include <thrust/system/cpp/detail/iter_swap.h>
 #include <thrust/system/cpp/detail/logical.h>
 #include <thrust/system/cpp/detail/malloc_and_free.h>
 #include <thrust/system/cpp/detail/merge.h>
+#include <thrust/system/cpp/detail/multiway_merge.h>
 #include <thrust/system/cpp/detail/mismatch.h>
 #include <thrust/system/cpp/detail/partition.h>
 #include <thrust/system/cpp/detail/reduce.h>
@@ -59,8 +62,13 @@
 #include <thrust/system/cpp/detail/scan.h>
 #include <thrust/system/cpp/detail/scan_by_key.h>
 #include <thrust/system/cpp/detail/scatter.h>
+#include <thrust/system/cpp/detail/segmented_reduce.h>
+#include <thrust/system/cpp/detail/segmented_scan.h>
+#include <thrust/system/cpp/detail/segmented_sort.h>
+#include <thrust/system/cpp/detail/selection.h>
 #include <thrust/system/cpp/detail/sequence.h>
 #include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/system/cpp/detail/shuffle.h>
 #include <thrust/system/cpp/detail/sort.h>
 #include <thrust/system/cpp/detail/swap_ranges.h>
 #include <thrust/system/cpp/detail/tabulate.h>
@@ -0,0 +1,97 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  OutputIterator histogram_even(thrust::execution_policy<ExecutionPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level);
+
+
+template<typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  OutputIterator histogram_range(thrust::execution_policy<ExecutionPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last);
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  void multi_histogram_even(thrust::execution_policy<ExecutionPolicy> &exec,
+                            InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels]);
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  void multi_histogram_range(thrust::execution_policy<ExecutionPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels]);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/histogram.inl>
+
@@ -0,0 +1,243 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace histogram_detail
+{
+
+
+// sorts the bin of every sample and reads the counts off the sorted bins
+template<typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+__host__ __device__
+  OutputIterator sort_histogram(thrust::execution_policy<ExecutionPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_bins,
+                                BinOp bin_op)
+{
+  thrust::detail::temporary_array<Size,ExecutionPolicy> bins(exec, thrust::distance(first, last));
+
+  thrust::transform(exec, first, last, bins.begin(), bin_op);
+  thrust::sort(exec, bins.begin(), bins.end());
+
+  // samples outside of all bins map to num_bins and sort to the end, where
+  // no search below reaches them
+  thrust::upper_bound(exec,
+                      bins.begin(), bins.end(),
+                      thrust::counting_iterator<Size>(0),
+                      thrust::counting_iterator<Size>(num_bins),
+                      histogram);
+
+  thrust::adjacent_difference(exec, histogram, histogram + num_bins, histogram);
+
+  return histogram + num_bins;
+} // end sort_histogram()
+
+
+// maps the index of a pixel to the index of one of its channels
+template<typename Index>
+struct channel_index
+{
+  Index num_channels;
+  Index channel;
+
+  __host__ __device__
+  channel_index(Index num_channels, Index channel)
+    : num_channels(num_channels), channel(channel)
+  {}
+
+  __host__ __device__
+  Index operator()(Index i) const
+  {
+    return i * num_channels + channel;
+  }
+};
+
+
+template<typename InputIterator>
+struct channel_iterator
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  typedef thrust::permutation_iterator<
+    InputIterator,
+    thrust::transform_iterator<
+      channel_index<difference_type>,
+      thrust::counting_iterator<difference_type>
+    >
+  > type;
+
+  __host__ __device__
+  static type make(InputIterator first, int num_channels, int channel)
+  {
+    channel_index<difference_type> index(num_channels, channel);
+
+    return type(first, thrust::make_transform_iterator(thrust::counting_iterator<difference_type>(0), index));
+  }
+};
+
+
+} // end histogram_detail
+
+
+template<typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  OutputIterator histogram_even(thrust::execution_policy<ExecutionPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::sort_histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::even_bin_op<Level,Size>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+
+template<typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  OutputIterator histogram_range(thrust::execution_policy<ExecutionPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  typedef typename thrust::iterator_difference<LevelIterator>::type Size;
+
+  const Size num_levels = thrust::distance(levels_first, levels_last);
+
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::sort_histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::range_bin_op<LevelIterator,Size>(levels_first, num_bins));
+} // end histogram_range()
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  void multi_histogram_even(thrust::execution_policy<ExecutionPolicy> &exec,
+                            InputIterator first,
+                            InputIterator last,
+                            OutputIterator (&histograms)[NumActiveChannels],
+                            const Size (&num_levels)[NumActiveChannels],
+                            const Level (&lower_level)[NumActiveChannels],
+                            const Level (&upper_level)[NumActiveChannels])
+{
+  THRUST_STATIC_ASSERT(NumActiveChannels <= NumChannels);
+
+  typedef histogram_detail::channel_iterator<InputIterator> channel_iterator;
+
+  const typename channel_iterator::difference_type num_pixels = thrust::distance(first, last) / NumChannels;
+
+  for(int c = 0; c < NumActiveChannels; ++c)
+  {
+    typename channel_iterator::type channel_first = channel_iterator::make(first, NumChannels, c);
+
+    thrust::histogram_even(exec, channel_first, channel_first + num_pixels, histograms[c], num_levels[c], lower_level[c], upper_level[c]);
+  }
+} // end multi_histogram_even()
+
+
+template<int NumChannels,
+         int NumActiveChannels,
+         typename ExecutionPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  void multi_histogram_range(thrust::execution_policy<ExecutionPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             OutputIterator (&histograms)[NumActiveChannels],
+                             const LevelIterator (&levels_first)[NumActiveChannels],
+                             const LevelIterator (&levels_last)[NumActiveChannels])
+{
+  THRUST_STATIC_ASSERT(NumActiveChannels <= NumChannels);
+
+  typedef histogram_detail::channel_iterator<InputIterator> channel_iterator;
+
+  const typename channel_iterator::difference_type num_pixels = thrust::distance(first, last) / NumChannels;
+
+  for(int c = 0; c < NumActiveChannels; ++c)
+  {
+    typename channel_iterator::type channel_first = channel_iterator::make(first, NumChannels, c);
+
+    thrust::histogram_range(exec, channel_first, channel_first + num_pixels, histograms[c], levels_first[c], levels_last[c]);
+  }
+} // end multi_histogram_range()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
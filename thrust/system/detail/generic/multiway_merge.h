@@ -0,0 +1,91 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  OutputIterator multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result,
+                                StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/multiway_merge.inl>
@@ -0,0 +1,332 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/multiway_merge.h>
+#include <thrust/multiway_merge.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/swap.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace multiway_merge_detail
+{
+
+
+// the total size of the runs [runs_first + first, runs_first + last)
+template<typename RandomAccessIterator, typename Size>
+__host__ __device__
+Size total_size(RandomAccessIterator runs_first, Size first, Size last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type run_type;
+
+  Size result = 0;
+
+  for(; first < last; ++first)
+  {
+    const run_type run = runs_first[first];
+
+    result += run.second - run.first;
+  }
+
+  return result;
+}
+
+
+} // end namespace multiway_merge_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type run_type;
+  typedef typename thrust::iterator_value<typename run_type::first_type>::type value_type;
+
+  return thrust::multiway_merge(exec, runs_first, runs_last, result, thrust::less<value_type>());
+} // end multiway_merge()
+
+
+// merges pairs of adjacent runs in rounds, so the input is read once and the
+// output written once, with about log2(k) - 1 passes over temporary storage
+// in between. Merging adjacent runs with a stable merge keeps the merge stable
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  OutputIterator multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator runs_first,
+                                RandomAccessIterator runs_last,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type           run_type;
+  typedef typename thrust::iterator_value<typename run_type::first_type>::type value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type      Size;
+  typedef thrust::detail::temporary_array<value_type, DerivedPolicy>           buffer_type;
+  typedef typename buffer_type::iterator                                        BufferIterator;
+
+  using multiway_merge_detail::total_size;
+
+  const Size num_runs = runs_last - runs_first;
+
+  if(num_runs == 0)
+    return result;
+
+  if(num_runs == 1)
+  {
+    const run_type run = runs_first[0];
+    return thrust::copy(exec, run.first, run.second, result);
+  }
+
+  if(num_runs == 2)
+  {
+    const run_type run1 = runs_first[0];
+    const run_type run2 = runs_first[1];
+    return thrust::merge(exec, run1.first, run1.second, run2.first, run2.second, result, comp);
+  }
+
+  const Size n = total_size(runs_first, Size(0), num_runs);
+
+  buffer_type buffer1(exec, n);
+  buffer_type buffer2(exec, n);
+
+  // the first round reads the runs
+  Size offset = 0;
+  for(Size i = 0; i < num_runs; i += 2)
+  {
+    const run_type run1 = runs_first[i];
+
+    if(i + 1 < num_runs)
+    {
+      const run_type run2 = runs_first[i + 1];
+      thrust::merge(exec, run1.first, run1.second, run2.first, run2.second, buffer1.begin() + offset, comp);
+      offset += (run1.second - run1.first) + (run2.second - run2.first);
+    }
+    else
+    {
+      thrust::copy(exec, run1.first, run1.second, buffer1.begin() + offset);
+      offset += run1.second - run1.first;
+    }
+  }
+
+  BufferIterator src = buffer1.begin();
+  BufferIterator dst = buffer2.begin();
+
+  // a merged run spans width input runs, and the last round, which merges
+  // two runs, writes the output
+  Size width = 2;
+  for(; 2 * width < num_runs; width *= 2)
+  {
+    Size lo = 0;
+    for(Size i = 0; i < num_runs; i += 2 * width)
+    {
+      const Size middle_run = thrust::min<Size>(i + width, num_runs);
+      const Size last_run   = thrust::min<Size>(i + 2 * width, num_runs);
+
+      const Size mid = lo + total_size(runs_first, i, middle_run);
+      const Size hi  = mid + total_size(runs_first, middle_run, last_run);
+
+      thrust::merge(exec, src + lo, src + mid, src + mid, src + hi, dst + lo, comp);
+
+      lo = hi;
+    }
+
+    thrust::swap(src, dst);
+  }
+
+  const Size mid = total_size(runs_first, Size(0), width);
+
+  return thrust::merge(exec, src, src + mid, src + mid, src + n, result, comp);
+} // end multiway_merge()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type run_type;
+  typedef typename thrust::iterator_value<typename run_type::first_type>::type value_type;
+
+  return thrust::multiway_merge_by_key(exec, keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result, thrust::less<value_type>());
+} // end multiway_merge_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<OutputIterator1,OutputIterator2>
+    multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_runs_first,
+                          RandomAccessIterator1 keys_runs_last,
+                          RandomAccessIterator2 values_runs_first,
+                          OutputIterator1 keys_result,
+                          OutputIterator2 values_result,
+                          StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type         run_type;
+  typedef typename run_type::first_type                                        InputIterator1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type         InputIterator2;
+  typedef typename thrust::iterator_value<InputIterator1>::type                key_type;
+  typedef typename thrust::iterator_value<InputIterator2>::type                value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type    Size;
+  typedef thrust::detail::temporary_array<key_type, DerivedPolicy>             keys_buffer_type;
+  typedef thrust::detail::temporary_array<value_type, DerivedPolicy>           values_buffer_type;
+  typedef typename keys_buffer_type::iterator                                  KeysBufferIterator;
+  typedef typename values_buffer_type::iterator                                ValuesBufferIterator;
+
+  using multiway_merge_detail::total_size;
+
+  const Size num_runs = keys_runs_last - keys_runs_first;
+
+  if(num_runs == 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  if(num_runs == 1)
+  {
+    const run_type run = keys_runs_first[0];
+    const InputIterator2 values_first = values_runs_first[0];
+    const Size n = run.second - run.first;
+
+    return thrust::make_pair(thrust::copy(exec, run.first, run.second, keys_result),
+                             thrust::copy(exec, values_first, values_first + n, values_result));
+  }
+
+  if(num_runs == 2)
+  {
+    const run_type run1 = keys_runs_first[0];
+    const run_type run2 = keys_runs_first[1];
+    return thrust::merge_by_key(exec,
+                                run1.first, run1.second,
+                                run2.first, run2.second,
+                                InputIterator2(values_runs_first[0]), InputIterator2(values_runs_first[1]),
+                                keys_result, values_result,
+                                comp);
+  }
+
+  const Size n = total_size(keys_runs_first, Size(0), num_runs);
+
+  keys_buffer_type   keys_buffer1(exec, n);
+  keys_buffer_type   keys_buffer2(exec, n);
+  values_buffer_type values_buffer1(exec, n);
+  values_buffer_type values_buffer2(exec, n);
+
+  Size offset = 0;
+  for(Size i = 0; i < num_runs; i += 2)
+  {
+    const run_type run1 = keys_runs_first[i];
+    const InputIterator2 values_first1 = values_runs_first[i];
+    const Size n1 = run1.second - run1.first;
+
+    if(i + 1 < num_runs)
+    {
+      const run_type run2 = keys_runs_first[i + 1];
+      const InputIterator2 values_first2 = values_runs_first[i + 1];
+
+      thrust::merge_by_key(exec,
+                           run1.first, run1.second,
+                           run2.first, run2.second,
+                           values_first1, values_first2,
+                           keys_buffer1.begin() + offset, values_buffer1.begin() + offset,
+                           comp);
+      offset += n1 + (run2.second - run2.first);
+    }
+    else
+    {
+      thrust::copy(exec, run1.first, run1.second, keys_buffer1.begin() + offset);
+      thrust::copy(exec, values_first1, values_first1 + n1, values_buffer1.begin() + offset);
+      offset += n1;
+    }
+  }
+
+  KeysBufferIterator   keys_src   = keys_buffer1.begin();
+  KeysBufferIterator   keys_dst   = keys_buffer2.begin();
+  ValuesBufferIterator values_src = values_buffer1.begin();
+  ValuesBufferIterator values_dst = values_buffer2.begin();
+
+  Size width = 2;
+  for(; 2 * width < num_runs; width *= 2)
+  {
+    Size lo = 0;
+    for(Size i = 0; i < num_runs; i += 2 * width)
+    {
+      const Size middle_run = thrust::min<Size>(i + width, num_runs);
+      const Size last_run   = thrust::min<Size>(i + 2 * width, num_runs);
+
+      const Size mid = lo + total_size(keys_runs_first, i, middle_run);
+      const Size hi  = mid + total_size(keys_runs_first, middle_run, last_run);
+
+      thrust::merge_by_key(exec,
+                           keys_src + lo, keys_src + mid,
+                           keys_src + mid, keys_src + hi,
+                           values_src + lo, values_src + mid,
+                           keys_dst + lo, values_dst + lo,
+                           comp);
+
+      lo = hi;
+    }
+
+    thrust::swap(keys_src, keys_dst);
+    thrust::swap(values_src, values_dst);
+  }
+
+  const Size mid = total_size(keys_runs_first, Size(0), width);
+
+  return thrust::merge_by_key(exec,
+                              keys_src, keys_src + mid,
+                              keys_src + mid, keys_src + n,
+                              values_src, values_src + mid,
+                              keys_result, values_result,
+                              comp);
+} // end multiway_merge_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,216 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/for_each_segment.h>
+#include <thrust/system/detail/internal/segmented_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  return thrust::segmented_reduce(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, value_type(), thrust::plus<value_type>());
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  typedef thrust::system::detail::internal::reduce_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    T,
+    BinaryFunction
+  > SegmentFunction;
+
+  thrust::system::detail::internal::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, init, binary_op));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+__host__ __device__
+  OutputIterator segmented_transform_reduce(thrust::execution_policy<DerivedPolicy> &exec,
+                                            RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  typedef thrust::system::detail::internal::transform_reduce_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    UnaryFunction,
+    T,
+    BinaryFunction
+  > SegmentFunction;
+
+  thrust::system::detail::internal::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, unary_op, init, binary_op));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_transform_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_min_element(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  return thrust::segmented_min_element(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, thrust::less<value_type>());
+} // end segmented_min_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_min_element(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  typedef thrust::system::detail::internal::min_element_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    BinaryPredicate
+  > SegmentFunction;
+
+  thrust::system::detail::internal::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, comp));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_min_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator segmented_max_element(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  return thrust::segmented_max_element(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, thrust::less<value_type>());
+} // end segmented_max_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  OutputIterator segmented_max_element(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  typedef thrust::system::detail::internal::max_element_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    BinaryPredicate
+  > SegmentFunction;
+
+  thrust::system::detail::internal::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, comp));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_max_element()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
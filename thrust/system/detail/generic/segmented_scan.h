@@ -0,0 +1,67 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  void segmented_inclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+__host__ __device__
+  void segmented_inclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result,
+                                AssociativeOperator binary_op);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/segmented_scan.inl>
+
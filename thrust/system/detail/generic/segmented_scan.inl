@@ -0,0 +1,85 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/segmented_scan.h>
+#include <thrust/segmented_scan.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/for_each_segment.h>
+#include <thrust/system/detail/internal/segmented_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator>
+__host__ __device__
+  void segmented_inclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  return thrust::segmented_inclusive_scan(exec, first, begin_offsets_first, begin_offsets_last, end_offsets_first, result, thrust::plus<value_type>());
+} // end segmented_inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+__host__ __device__
+  void segmented_inclusive_scan(thrust::execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator first,
+                                BeginOffsetIterator begin_offsets_first,
+                                BeginOffsetIterator begin_offsets_last,
+                                EndOffsetIterator end_offsets_first,
+                                OutputIterator result,
+                                AssociativeOperator binary_op)
+{
+  typedef thrust::system::detail::internal::inclusive_scan_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    AssociativeOperator
+  > SegmentFunction;
+
+  thrust::system::detail::internal::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, binary_op));
+} // end segmented_inclusive_scan()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,354 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/copy.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace segmented_sort_detail
+{
+
+
+// labels every element of a segment with the offset of the segment's first element
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename Size>
+  struct label_segment
+{
+  BeginOffsetIterator begin_offsets;
+  EndOffsetIterator   end_offsets;
+  Size               *labels;
+
+  __host__ __device__
+  label_segment(BeginOffsetIterator begin_offsets, EndOffsetIterator end_offsets, Size *labels)
+    : begin_offsets(begin_offsets), end_offsets(end_offsets), labels(labels)
+  {}
+
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index segment) const
+  {
+    const Size begin = static_cast<Size>(begin_offsets[segment]);
+    const Size end   = static_cast<Size>(end_offsets[segment]);
+
+    for(Size i = begin; i < end; ++i)
+    {
+      labels[i] = begin;
+    }
+  }
+};
+
+
+// computes the permutation which stably sorts every segment of [keys_first, keys_last).
+// Every element is labeled with the offset of its segment's first element, or with its
+// own offset if it belongs to no segment. As segments do not overlap, sorting by
+// (label, key) moves every element within its own segment, which takes a stable sort
+// by key followed by a stable sort by label, as in examples/lexicographical_sort.cu
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering,
+         typename Size>
+__host__ __device__
+  void sorting_permutation(thrust::execution_policy<DerivedPolicy> &exec,
+                           RandomAccessIterator keys_first,
+                           RandomAccessIterator keys_last,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first,
+                           StrictWeakOrdering comp,
+                           thrust::detail::temporary_array<Size,DerivedPolicy> &permutation)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+
+  const SegmentIndex num_segments = thrust::distance(begin_offsets_first, begin_offsets_last);
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> labels(exec, permutation.size());
+  thrust::sequence(exec, labels.begin(), labels.end());
+
+  thrust::for_each(exec,
+                   thrust::counting_iterator<SegmentIndex>(0),
+                   thrust::counting_iterator<SegmentIndex>(num_segments),
+                   label_segment<BeginOffsetIterator,EndOffsetIterator,Size>(begin_offsets_first, end_offsets_first, thrust::raw_pointer_cast(labels.data())));
+
+  thrust::sequence(exec, permutation.begin(), permutation.end());
+
+  {
+    thrust::detail::temporary_array<KeyType,DerivedPolicy> keys(exec, keys_first, keys_last);
+    thrust::stable_sort_by_key(exec, keys.begin(), keys.end(), permutation.begin(), comp);
+  }
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> permuted_labels(exec, permutation.size());
+  thrust::gather(exec, permutation.begin(), permutation.end(), labels.begin(), permuted_labels.begin());
+
+  thrust::stable_sort_by_key(exec, permuted_labels.begin(), permuted_labels.end(), permutation.begin());
+} // end sorting_permutation()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = thrust::distance(keys_first, keys_last);
+
+  if(n < 2 || begin_offsets_first == begin_offsets_last)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> permutation(exec, n);
+  sorting_permutation(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp, permutation);
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> keys(exec, n);
+  thrust::gather(exec, permutation.begin(), permutation.end(), keys_first, keys.begin());
+  thrust::copy(exec, keys.begin(), keys.end(), keys_first);
+} // end stable_segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = thrust::distance(keys_first, keys_last);
+
+  if(n < 2 || begin_offsets_first == begin_offsets_last)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> permutation(exec, n);
+  sorting_permutation(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp, permutation);
+
+  {
+    thrust::detail::temporary_array<KeyType,DerivedPolicy> keys(exec, n);
+    thrust::gather(exec, permutation.begin(), permutation.end(), keys_first, keys.begin());
+    thrust::copy(exec, keys.begin(), keys.end(), keys_first);
+  }
+
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values(exec, n);
+  thrust::gather(exec, permutation.begin(), permutation.end(), values_first, values.begin());
+  thrust::copy(exec, values.begin(), values.end(), values_first);
+} // end stable_segmented_sort_by_key()
+
+
+} // end segmented_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::segmented_sort(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, thrust::less<value_type>());
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator keys_last,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp)
+{
+  // the generic implementation is stable
+  thrust::stable_segmented_sort(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::stable_segmented_sort(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, thrust::less<value_type>());
+} // end stable_segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator keys_last,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  segmented_sort_detail::stable_segmented_sort(exec, keys_first, keys_last, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  thrust::segmented_sort_by_key(exec, keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, thrust::less<value_type>());
+} // end segmented_sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1 keys_last,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  // the generic implementation is stable
+  thrust::stable_segmented_sort_by_key(exec, keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end segmented_sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+__host__ __device__
+  void stable_segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  thrust::stable_segmented_sort_by_key(exec, keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, thrust::less<value_type>());
+} // end stable_segmented_sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void stable_segmented_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1 keys_last,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp)
+{
+  segmented_sort_detail::stable_segmented_sort_by_key(exec, keys_first, keys_last, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+} // end stable_segmented_sort_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
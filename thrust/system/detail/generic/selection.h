@@ -0,0 +1,151 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last,
+                                          StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result,
+                              StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp);
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/selection.inl>
+
@@ -0,0 +1,218 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/selection.h>
+#include <thrust/selection.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  thrust::nth_element(exec, first, nth, last, thrust::less<value_type>());
+} // end nth_element()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  // a sorted range satisfies the postcondition for every nth
+  thrust::sort(exec, first, last, comp);
+} // end nth_element()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  thrust::partial_sort(exec, first, middle, last, thrust::less<value_type>());
+} // end partial_sort()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  thrust::sort(exec, first, last, comp);
+} // end partial_sort()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type;
+
+  return thrust::partial_sort_copy(exec, first, last, result_first, result_last, thrust::less<value_type>());
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                          RandomAccessIterator1 first,
+                                          RandomAccessIterator1 last,
+                                          RandomAccessIterator2 result_first,
+                                          RandomAccessIterator2 result_last,
+                                          StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size k = thrust::min<Size>(last - first, result_last - result_first);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> sorted(exec, first, last);
+
+  thrust::sort(exec, sorted.begin(), sorted.end(), comp);
+
+  return thrust::copy(exec, sorted.begin(), sorted.begin() + k, result_first);
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type;
+
+  return thrust::top_k(exec, first, last, k, result, thrust::greater<value_type>());
+} // end top_k()
+
+
+template<typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator2 top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first,
+                              RandomAccessIterator1 last,
+                              typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                              RandomAccessIterator2 result,
+                              StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  k = thrust::min<Size>(k, last - first);
+
+  return thrust::partial_sort_copy(exec, first, last, result, result + k, comp);
+} // end top_k()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+
+  return thrust::top_k_by_key(exec, keys_first, keys_last, values_first, k, keys_result, values_result, thrust::greater<value_type>());
+} // end top_k_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                 RandomAccessIterator3 keys_result,
+                 RandomAccessIterator4 values_result,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  k = thrust::min<Size>(k, n);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy>   keys(exec, keys_first, keys_last);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values(exec, values_first, values_first + n);
+
+  thrust::sort_by_key(exec, keys.begin(), keys.end(), values.begin(), comp);
+
+  thrust::copy(exec, keys.begin(), keys.begin() + k, keys_result);
+  thrust::copy(exec, values.begin(), values.begin() + k, values_result);
+
+  return thrust::make_pair(keys_result + k, values_result + k);
+} // end top_k_by_key()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
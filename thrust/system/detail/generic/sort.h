@@ -110,6 +110,50 @@ __host__ __device__
                           StrictWeakOrdering comp);
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void sort(thrust::execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            int begin_bit,
+            int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   int begin_bit,
+                   int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void stable_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   int begin_bit,
+                   int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void stable_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_first,
+                          RandomAccessIterator1 keys_last,
+                          RandomAccessIterator2 values_first,
+                          int begin_bit,
+                          int end_bit);
+
+
 template<typename DerivedPolicy, typename ForwardIterator>
 __host__ __device__
   bool is_sorted(thrust::execution_policy<DerivedPolicy> &exec,
@@ -27,6 +27,7 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 #include <thrust/detail/internal_functional.h>
+#include <thrust/radix_key.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -119,6 +120,66 @@ __host__ __device__
 } // end stable_sort_by_key()
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void sort(thrust::execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            int begin_bit,
+            int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::sort(exec, first, last, thrust::bit_range_less<value_type>(begin_bit, end_bit));
+} // end sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   int begin_bit,
+                   int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  thrust::sort_by_key(exec, keys_first, keys_last, values_first, thrust::bit_range_less<value_type>(begin_bit, end_bit));
+} // end sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void stable_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   int begin_bit,
+                   int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::stable_sort(exec, first, last, thrust::bit_range_less<value_type>(begin_bit, end_bit));
+} // end stable_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void stable_sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys_first,
+                          RandomAccessIterator1 keys_last,
+                          RandomAccessIterator2 values_first,
+                          int begin_bit,
+                          int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  thrust::stable_sort_by_key(exec, keys_first, keys_last, values_first, thrust::bit_range_less<value_type>(begin_bit, end_bit));
+} // end stable_sort_by_key()
+
+
 template<typename DerivedPolicy, typename ForwardIterator>
 __host__ __device__
   bool is_sorted(thrust::execution_policy<DerivedPolicy> &exec,
@@ -0,0 +1,146 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file for_each_segment.h
+ *  \brief Visiting the segments of a sequence given by begin and end offsets.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// segments shorter than this are always processed by a single thread
+static const int min_parallel_segment_size = 1 << 14;
+
+
+// calls f(i, begin, end) for segment i, reading its bounds from the offsets;
+// used as the function of a for_each over the segment indices
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+struct segment_invoker
+{
+  typedef typename SegmentFunction::size_type size_type;
+
+  BeginOffsetIterator begin_offsets_first;
+  EndOffsetIterator   end_offsets_first;
+  SegmentFunction     f;
+
+  __host__ __device__
+  segment_invoker(BeginOffsetIterator begin_offsets_first, EndOffsetIterator end_offsets_first, SegmentFunction f)
+    : begin_offsets_first(begin_offsets_first), end_offsets_first(end_offsets_first), f(f)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index i) const
+  {
+    f(i, static_cast<size_type>(begin_offsets_first[i]), static_cast<size_type>(end_offsets_first[i]));
+  }
+};
+
+
+// processes every segment by one thread of exec; the fallback of systems
+// without a load balancing version
+template<typename DerivedPolicy,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+__host__ __device__
+void for_each_segment(thrust::execution_policy<DerivedPolicy> &exec,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      SegmentFunction f)
+{
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+
+  const SegmentIndex num_segments = thrust::distance(begin_offsets_first, begin_offsets_last);
+
+  thrust::for_each(exec,
+                   thrust::counting_iterator<SegmentIndex>(0),
+                   thrust::counting_iterator<SegmentIndex>(num_segments),
+                   segment_invoker<BeginOffsetIterator,EndOffsetIterator,SegmentFunction>(begin_offsets_first, end_offsets_first, f));
+}
+
+
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+void sequential_for_each_segment(BeginOffsetIterator begin_offsets_first,
+                                 BeginOffsetIterator begin_offsets_last,
+                                 EndOffsetIterator end_offsets_first,
+                                 SegmentFunction f)
+{
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+  typedef typename SegmentFunction::size_type                            Size;
+
+  for(SegmentIndex i = 0; begin_offsets_first != begin_offsets_last; ++begin_offsets_first, ++end_offsets_first, ++i)
+  {
+    f(i, static_cast<Size>(*begin_offsets_first), static_cast<Size>(*end_offsets_first));
+  }
+}
+
+
+template<typename Size,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator>
+Size total_segment_size(BeginOffsetIterator begin_offsets_first,
+                        BeginOffsetIterator begin_offsets_last,
+                        EndOffsetIterator end_offsets_first)
+{
+  Size result = 0;
+
+  for(; begin_offsets_first != begin_offsets_last; ++begin_offsets_first, ++end_offsets_first)
+  {
+    result += static_cast<Size>(*end_offsets_first) - static_cast<Size>(*begin_offsets_first);
+  }
+
+  return result;
+}
+
+
+// a segment holding more than an even share of all the work would keep one
+// thread busy long after the others finished, so it is processed on its own
+// by all threads
+template<typename Size>
+Size max_sequential_segment_size(Size total_size, Size num_threads)
+{
+  const Size even_share = total_size / num_threads;
+
+  return even_share > Size(min_parallel_segment_size) ? even_share : Size(min_parallel_segment_size);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,214 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Mapping of samples to histogram bins shared by the backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace histogram_detail
+{
+
+
+// computes floor(a * b / c) for a < c without overflowing, using the 64-bit
+// product when it fits and the full 128-bit product otherwise
+__host__ __device__
+inline unsigned long long multiply_divide(unsigned long long a, unsigned long long b, unsigned long long c)
+{
+  if(b == 0 || a <= ~0ull / b)
+  {
+    return a * b / c;
+  }
+
+#if defined(__SIZEOF_INT128__)
+  return static_cast<unsigned long long>(static_cast<unsigned __int128>(a) * b / c);
+#else
+  // the 128-bit product as hi:lo from 32-bit halves
+  const unsigned long long a_lo = a & 0xffffffffull, a_hi = a >> 32;
+  const unsigned long long b_lo = b & 0xffffffffull, b_hi = b >> 32;
+
+  const unsigned long long lo_lo = a_lo * b_lo;
+  const unsigned long long hi_lo = a_hi * b_lo;
+  const unsigned long long lo_hi = a_lo * b_hi;
+  const unsigned long long cross = (lo_lo >> 32) + (hi_lo & 0xffffffffull) + (lo_hi & 0xffffffffull);
+
+  const unsigned long long lo = (cross << 32) | (lo_lo & 0xffffffffull);
+  unsigned long long       hi = a_hi * b_hi + (hi_lo >> 32) + (lo_hi >> 32) + (cross >> 32);
+
+  // a < c means hi < c, so the quotient fits in 64 bits and the remainder
+  // can be carried in hi
+  unsigned long long quotient = 0;
+  for(int i = 63; i >= 0; --i)
+  {
+    const bool carry = (hi >> 63) != 0;
+    hi = (hi << 1) | ((lo >> i) & 1);
+    quotient <<= 1;
+
+    if(carry || hi >= c)
+    {
+      hi -= c;
+      quotient |= 1;
+    }
+  }
+
+  return quotient;
+#endif
+}
+
+
+// the width of a bin in integer arithmetic is exact, so compute the bin of an
+// integral sample without rounding and without overflowing the level type
+template<typename Level, typename Size>
+__host__ __device__
+Size even_bin(Level sample, Level lower_level, Level upper_level, Size num_bins, thrust::detail::true_type)
+{
+  typedef unsigned long long wide_type;
+
+  const wide_type offset = static_cast<wide_type>(sample) - static_cast<wide_type>(lower_level);
+  const wide_type range  = static_cast<wide_type>(upper_level) - static_cast<wide_type>(lower_level);
+
+  return static_cast<Size>(multiply_divide(offset, static_cast<wide_type>(num_bins), range));
+}
+
+
+template<typename Level, typename Size>
+__host__ __device__
+Size even_bin(Level sample, Level lower_level, Level upper_level, Size num_bins, thrust::detail::false_type)
+{
+  const Size bin = static_cast<Size>((static_cast<double>(sample) - static_cast<double>(lower_level)) * static_cast<double>(num_bins)
+                                     / (static_cast<double>(upper_level) - static_cast<double>(lower_level)));
+
+  // rounding may push samples just below upper_level into the next bin
+  return bin < num_bins ? bin : num_bins - 1;
+}
+
+
+} // end histogram_detail
+
+
+// maps a sample to its bin of a histogram_even, or to num_bins if the
+// sample lies outside of [lower_level, upper_level)
+template<typename Level, typename Size>
+struct even_bin_op
+{
+  Level lower_level;
+  Level upper_level;
+  Size  num_bins;
+
+  __host__ __device__
+  even_bin_op(Level lower_level, Level upper_level, Size num_bins)
+    : lower_level(lower_level), upper_level(upper_level), num_bins(num_bins)
+  {}
+
+  template<typename Sample>
+  __host__ __device__
+  Size operator()(const Sample &s) const
+  {
+    const Level sample = static_cast<Level>(s);
+
+    // written so that NaN samples are rejected
+    if(!(sample >= lower_level && sample < upper_level))
+    {
+      return num_bins;
+    }
+
+    return histogram_detail::even_bin(sample, lower_level, upper_level, num_bins,
+                                      typename thrust::detail::is_integral<Level>::type());
+  }
+};
+
+
+// maps a sample to its bin of a histogram_range, or to num_bins if the
+// sample lies outside of [levels[0], levels[num_bins])
+template<typename LevelIterator, typename Size>
+struct range_bin_op
+{
+  LevelIterator levels;
+  Size          num_bins;
+
+  __host__ __device__
+  range_bin_op(LevelIterator levels, Size num_bins)
+    : levels(levels), num_bins(num_bins)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Sample>
+  __host__ __device__
+  Size operator()(const Sample &sample) const
+  {
+    if(!(sample >= levels[0] && sample < levels[num_bins]))
+    {
+      return num_bins;
+    }
+
+    // find the last level which is not greater than the sample
+    Size lo = 0;
+    Size hi = num_bins;
+
+    while(hi - lo > 1)
+    {
+      const Size mid = lo + (hi - lo) / 2;
+
+      if(sample < levels[mid])
+      {
+        hi = mid;
+      }
+      else
+      {
+        lo = mid;
+      }
+    }
+
+    return lo;
+  }
+};
+
+
+// the host backends always give each thread a private histogram of up to
+// this many bins, and more when there are enough samples to amortize them
+const std::size_t max_privatized_bins = 1 << 16;
+
+
+// the number of counters of a private histogram, rounded up to whole cache
+// lines so that threads never write to the same line
+template<typename Counter, typename Size>
+Size padded_num_bins(Size num_bins)
+{
+  const Size counters_per_line = sizeof(Counter) < 64 ? Size(64 / sizeof(Counter)) : Size(1);
+
+  return (num_bins + counters_per_line - 1) / counters_per_line * counters_per_line;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,472 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file multiway_merge.h
+ *  \brief Parallel multiway_merge shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/multiway_merge.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace multiway_merge_detail
+{
+
+
+// orders runs by the middle elements of their remaining search intervals,
+// and equivalent elements by run, as the merge does
+template<typename InputIterator, typename Size, typename StrictWeakOrdering>
+struct compare_midpoints
+{
+  const InputIterator *begins;
+  const Size *lo;
+  const Size *hi;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  compare_midpoints(const InputIterator *begins, const Size *lo, const Size *hi, StrictWeakOrdering comp)
+    : begins(begins), lo(lo), hi(hi), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  bool operator()(Size a, Size b)
+  {
+    const InputIterator x = begins[a] + (lo[a] + (hi[a] - lo[a]) / 2);
+    const InputIterator y = begins[b] + (lo[b] + (hi[b] - lo[b]) / 2);
+
+    if(comp(*x, *y))
+      return true;
+
+    if(comp(*y, *x))
+      return false;
+
+    return a < b;
+  }
+};
+
+
+// multi-sequence selection: finds the number of elements splits[i] which
+// each run contributes to the first rank elements of the merged output.
+//
+// Every run keeps an interval [lo, hi) which contains its split. Each round
+// takes the middle elements of all intervals and ranks their median, weighted
+// by interval length, in the whole output with one binary search per run.
+// That cuts at least a quarter of the total interval length, so there are
+// O(log n) rounds of O(k log n) work each
+__thrust_exec_check_disable__
+template<typename InputIterator, typename Size, typename StrictWeakOrdering>
+__host__ __device__
+void split_runs(const InputIterator *begins,
+                const Size *sizes,
+                Size num_runs,
+                Size rank,
+                Size *splits,
+                StrictWeakOrdering comp)
+{
+  thrust::detail::seq_t seq;
+
+  thrust::detail::temporary_array<Size, thrust::detail::seq_t> scratch(seq, 3 * num_runs);
+
+  Size *lo         = splits;
+  Size *hi         = thrust::raw_pointer_cast(scratch.data());
+  Size *candidates = hi + num_runs;
+  Size *positions  = candidates + num_runs;
+
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    lo[i] = 0;
+    hi[i] = sizes[i];
+  }
+
+  while(true)
+  {
+    Size num_candidates = 0;
+    Size total_length   = 0;
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      if(lo[i] < hi[i])
+      {
+        candidates[num_candidates++] = i;
+        total_length += hi[i] - lo[i];
+      }
+    }
+
+    // every interval is empty, so lo holds the splits
+    if(num_candidates == 0)
+      return;
+
+    thrust::sort(seq, candidates, candidates + num_candidates, compare_midpoints<InputIterator,Size,StrictWeakOrdering>(begins, lo, hi, comp));
+
+    Size median = 0;
+    Size length = hi[candidates[0]] - lo[candidates[0]];
+    while(2 * length < total_length)
+    {
+      ++median;
+      length += hi[candidates[median]] - lo[candidates[median]];
+    }
+
+    const Size run = candidates[median];
+    const Size pos = lo[run] + (hi[run] - lo[run]) / 2;
+    const InputIterator x = begins[run] + pos;
+
+    // elements equivalent to *x are ordered before it in earlier runs and
+    // after it in later runs
+    Size x_rank = 0;
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      if(i < run)
+        positions[i] = thrust::upper_bound(seq, begins[i], begins[i] + sizes[i], *x, comp) - begins[i];
+      else if(i == run)
+        positions[i] = pos;
+      else
+        positions[i] = thrust::lower_bound(seq, begins[i], begins[i] + sizes[i], *x, comp) - begins[i];
+
+      x_rank += positions[i];
+    }
+
+    if(x_rank == rank)
+    {
+      for(Size i = 0; i < num_runs; ++i)
+      {
+        splits[i] = positions[i];
+      }
+
+      return;
+    }
+
+    if(x_rank < rank)
+    {
+      // *x and everything before it belong to the first rank elements
+      for(Size i = 0; i < num_runs; ++i)
+      {
+        lo[i] = thrust::max(lo[i], positions[i]);
+      }
+
+      lo[run] = pos + 1;
+    }
+    else
+    {
+      for(Size i = 0; i < num_runs; ++i)
+      {
+        hi[i] = thrust::min(hi[i], positions[i]);
+      }
+    }
+  }
+}
+
+
+// computes the splits of the part boundaries: row p of splits holds the
+// splits of the first p * n / num_parts elements
+template<typename InputIterator, typename Size, typename StrictWeakOrdering>
+struct split_parts
+{
+  const InputIterator *begins;
+  const Size *sizes;
+  Size num_runs;
+  Size n;
+  Size num_parts;
+  Size *splits;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  split_parts(const InputIterator *begins, const Size *sizes, Size num_runs, Size n, Size num_parts, Size *splits, StrictWeakOrdering comp)
+    : begins(begins), sizes(sizes), num_runs(num_runs), n(n), num_parts(num_parts), splits(splits), comp(comp)
+  {}
+
+  __host__ __device__
+  void operator()(Size part) const
+  {
+    split_runs(begins, sizes, num_runs, part * n / num_parts, splits + part * num_runs, comp);
+  }
+};
+
+
+template<typename InputIterator, typename Size, typename OutputIterator, typename StrictWeakOrdering>
+struct merge_part
+{
+  const InputIterator *begins;
+  Size num_runs;
+  Size n;
+  Size num_parts;
+  const Size *splits;
+  OutputIterator result;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  merge_part(const InputIterator *begins, Size num_runs, Size n, Size num_parts, const Size *splits, OutputIterator result, StrictWeakOrdering comp)
+    : begins(begins), num_runs(num_runs), n(n), num_parts(num_parts), splits(splits), result(result), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void operator()(Size part) const
+  {
+    thrust::detail::seq_t seq;
+
+    thrust::detail::temporary_array<InputIterator, thrust::detail::seq_t> bounds(seq, 2 * num_runs);
+    InputIterator *cursors = thrust::raw_pointer_cast(bounds.data());
+    InputIterator *ends    = cursors + num_runs;
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      cursors[i] = begins[i] + splits[part * num_runs + i];
+      ends[i]    = begins[i] + splits[(part + 1) * num_runs + i];
+    }
+
+    sequential::multiway_merge_detail::merge_runs(seq, cursors, ends, num_runs, result + part * n / num_parts, comp);
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+struct merge_part_by_key
+{
+  const InputIterator1 *keys_begins;
+  const InputIterator2 *values_begins;
+  Size num_runs;
+  Size n;
+  Size num_parts;
+  const Size *splits;
+  OutputIterator1 keys_result;
+  OutputIterator2 values_result;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  merge_part_by_key(const InputIterator1 *keys_begins,
+                    const InputIterator2 *values_begins,
+                    Size num_runs,
+                    Size n,
+                    Size num_parts,
+                    const Size *splits,
+                    OutputIterator1 keys_result,
+                    OutputIterator2 values_result,
+                    StrictWeakOrdering comp)
+    : keys_begins(keys_begins), values_begins(values_begins),
+      num_runs(num_runs), n(n), num_parts(num_parts), splits(splits),
+      keys_result(keys_result), values_result(values_result), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void operator()(Size part) const
+  {
+    thrust::detail::seq_t seq;
+
+    thrust::detail::temporary_array<InputIterator1, thrust::detail::seq_t> keys_bounds(seq, 2 * num_runs);
+    thrust::detail::temporary_array<InputIterator2, thrust::detail::seq_t> values_bounds(seq, num_runs);
+    InputIterator1 *keys_cursors   = thrust::raw_pointer_cast(keys_bounds.data());
+    InputIterator1 *keys_ends      = keys_cursors + num_runs;
+    InputIterator2 *values_cursors = thrust::raw_pointer_cast(values_bounds.data());
+
+    for(Size i = 0; i < num_runs; ++i)
+    {
+      keys_cursors[i]   = keys_begins[i] + splits[part * num_runs + i];
+      keys_ends[i]      = keys_begins[i] + splits[(part + 1) * num_runs + i];
+      values_cursors[i] = values_begins[i] + splits[part * num_runs + i];
+    }
+
+    const Size offset = part * n / num_parts;
+
+    sequential::multiway_merge_detail::merge_runs_by_key(seq, keys_cursors, keys_ends, values_cursors, num_runs, keys_result + offset, values_result + offset, comp);
+  }
+};
+
+
+// fills the first and last rows of splits and computes the others, so that
+// every part can be merged independently
+template<typename DerivedPolicy, typename InputIterator, typename Size, typename StrictWeakOrdering>
+void split_into_parts(thrust::execution_policy<DerivedPolicy> &exec,
+                      const InputIterator *begins,
+                      const Size *sizes,
+                      Size num_runs,
+                      Size n,
+                      Size num_parts,
+                      Size *splits,
+                      StrictWeakOrdering comp)
+{
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    splits[i]                         = 0;
+    splits[num_parts * num_runs + i]  = sizes[i];
+  }
+
+  thrust::for_each(exec,
+                   thrust::counting_iterator<Size>(1),
+                   thrust::counting_iterator<Size>(num_parts),
+                   split_parts<InputIterator,Size,StrictWeakOrdering>(begins, sizes, num_runs, n, num_parts, splits, comp));
+}
+
+
+} // end namespace multiway_merge_detail
+
+
+// splits the output into one part per thread with multi-sequence selection,
+// and merges the parts independently with a loser tree
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator parallel_multiway_merge(thrust::execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator runs_first,
+                                       RandomAccessIterator runs_last,
+                                       OutputIterator result,
+                                       StrictWeakOrdering comp,
+                                       int num_threads)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      run_type;
+  typedef typename run_type::first_type                                    InputIterator;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  using namespace multiway_merge_detail;
+
+  const Size num_runs = runs_last - runs_first;
+
+  thrust::detail::temporary_array<InputIterator, DerivedPolicy> begins_storage(exec, num_runs);
+  thrust::detail::temporary_array<Size, DerivedPolicy>          sizes_storage(exec, num_runs);
+
+  // temporary storage of the host systems is host memory
+  InputIterator *begins = thrust::raw_pointer_cast(begins_storage.data());
+  Size *sizes           = thrust::raw_pointer_cast(sizes_storage.data());
+
+  Size n = 0;
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    const run_type run = runs_first[i];
+
+    begins[i] = run.first;
+    sizes[i]  = run.second - run.first;
+    n += sizes[i];
+  }
+
+  if(num_threads < 2 || num_runs < 2 || is_small_input(n, small_compaction_size))
+  {
+    thrust::detail::seq_t seq;
+    return sequential::multiway_merge(seq, runs_first, runs_last, result, comp);
+  }
+
+  const Size num_parts = num_threads;
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits_storage(exec, (num_parts + 1) * num_runs);
+  Size *splits = thrust::raw_pointer_cast(splits_storage.data());
+
+  split_into_parts(exec, begins, sizes, num_runs, n, num_parts, splits, comp);
+
+  thrust::for_each(exec,
+                   thrust::counting_iterator<Size>(0),
+                   thrust::counting_iterator<Size>(num_parts),
+                   merge_part<InputIterator,Size,OutputIterator,StrictWeakOrdering>(begins, num_runs, n, num_parts, splits, result, comp));
+
+  return result + n;
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+  parallel_multiway_merge_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                                 RandomAccessIterator1 keys_runs_first,
+                                 RandomAccessIterator1 keys_runs_last,
+                                 RandomAccessIterator2 values_runs_first,
+                                 OutputIterator1 keys_result,
+                                 OutputIterator2 values_result,
+                                 StrictWeakOrdering comp,
+                                 int num_threads)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      run_type;
+  typedef typename run_type::first_type                                     InputIterator1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      InputIterator2;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  using namespace multiway_merge_detail;
+
+  const Size num_runs = keys_runs_last - keys_runs_first;
+
+  thrust::detail::temporary_array<InputIterator1, DerivedPolicy> keys_begins_storage(exec, num_runs);
+  thrust::detail::temporary_array<InputIterator2, DerivedPolicy> values_begins_storage(exec, num_runs);
+  thrust::detail::temporary_array<Size, DerivedPolicy>           sizes_storage(exec, num_runs);
+
+  InputIterator1 *keys_begins   = thrust::raw_pointer_cast(keys_begins_storage.data());
+  InputIterator2 *values_begins = thrust::raw_pointer_cast(values_begins_storage.data());
+  Size *sizes                   = thrust::raw_pointer_cast(sizes_storage.data());
+
+  Size n = 0;
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    const run_type run = keys_runs_first[i];
+
+    keys_begins[i]   = run.first;
+    values_begins[i] = values_runs_first[i];
+    sizes[i]         = run.second - run.first;
+    n += sizes[i];
+  }
+
+  if(num_threads < 2 || num_runs < 2 || is_small_input(n, small_compaction_size))
+  {
+    thrust::detail::seq_t seq;
+    return sequential::multiway_merge_by_key(seq, keys_runs_first, keys_runs_last, values_runs_first, keys_result, values_result, comp);
+  }
+
+  const Size num_parts = num_threads;
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits_storage(exec, (num_parts + 1) * num_runs);
+  Size *splits = thrust::raw_pointer_cast(splits_storage.data());
+
+  split_into_parts(exec, keys_begins, sizes, num_runs, n, num_parts, splits, comp);
+
+  thrust::for_each(exec,
+                   thrust::counting_iterator<Size>(0),
+                   thrust::counting_iterator<Size>(num_parts),
+                   merge_part_by_key<InputIterator1,InputIterator2,Size,OutputIterator1,OutputIterator2,StrictWeakOrdering>(
+                     keys_begins, values_begins, num_runs, n, num_parts, splits, keys_result, values_result, comp));
+
+  return thrust::make_pair(keys_result + n, values_result + n);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
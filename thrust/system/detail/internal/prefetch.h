@@ -0,0 +1,125 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file prefetch.h
+ *  \brief Software prefetch helpers for the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace prefetch_detail
+{
+
+
+const std::size_t cache_line_size = 64;
+
+
+template<int ReadWrite>
+inline void prefetch_address(const void *ptr)
+{
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_GCC || THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_CLANG || THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_INTEL
+  __builtin_prefetch(ptr, ReadWrite, 3);
+#elif THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#else
+  (void)ptr;
+#endif
+}
+
+
+template<int ReadWrite, typename Iterator>
+inline void prefetch(Iterator, thrust::detail::false_type)
+{
+  // we can't take the address of an element of a non-contiguous iterator
+}
+
+
+template<int ReadWrite, typename Iterator>
+inline void prefetch(Iterator iter, thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_value<Iterator>::type value_type;
+
+  // touch every cache line of wide elements, but don't flood the
+  // prefetch queue with more than a few lines per element
+  const std::size_t num_bytes = sizeof(value_type) < 8 * cache_line_size ? sizeof(value_type) : 8 * cache_line_size;
+
+  const char *ptr = reinterpret_cast<const char*>(thrust::detail::contiguous_iterator_raw_pointer_cast(iter));
+
+  for(std::size_t offset = 0; offset < num_bytes; offset += cache_line_size)
+  {
+    prefetch_address<ReadWrite>(ptr + offset);
+  }
+}
+
+
+} // end prefetch_detail
+
+
+// the number of elements to look ahead when gathering or scattering
+// through an index map. wide elements take longer to move, so fewer of
+// them need to be in flight to cover the memory latency
+// XXX these values are a tuning opportunity
+template<typename T>
+struct prefetch_distance
+{
+  static const std::ptrdiff_t max_bytes_in_flight = 4096;
+  static const std::ptrdiff_t ratio = max_bytes_in_flight / static_cast<std::ptrdiff_t>(sizeof(T));
+
+  static const std::ptrdiff_t value = ratio < 2 ? 2 : (ratio > 32 ? 32 : ratio);
+};
+
+
+// prefetch the element referenced by iter for reading; a no-op for
+// iterators which are not contiguous
+template<typename Iterator>
+inline void prefetch_for_read(Iterator iter)
+{
+  prefetch_detail::prefetch<0>(iter, thrust::detail::integral_constant<bool, thrust::is_contiguous_iterator<Iterator>::value>());
+}
+
+
+// prefetch the element referenced by iter for writing; a no-op for
+// iterators which are not contiguous
+template<typename Iterator>
+inline void prefetch_for_write(Iterator iter)
+{
+  prefetch_detail::prefetch<1>(iter, thrust::detail::integral_constant<bool, thrust::is_contiguous_iterator<Iterator>::value>());
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
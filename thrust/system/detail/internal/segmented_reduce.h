@@ -0,0 +1,244 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file segmented_reduce.h
+ *  \brief Per-segment reductions shared by the backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// the segment functions of segmented_reduce and friends. A segment is either
+// reduced by the calling thread, or, when it is long enough to be worth it,
+// with the parallel algorithm of the calling system
+
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+struct reduce_segment
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  RandomAccessIterator first;
+  OutputIterator result;
+  T init;
+  mutable BinaryFunction binary_op;
+
+  __host__ __device__
+  reduce_segment(RandomAccessIterator first, OutputIterator result, T init, BinaryFunction binary_op)
+    : first(first), result(result), init(init), binary_op(binary_op)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index i, size_type begin, size_type end) const
+  {
+    T sum = init;
+
+    for(size_type j = begin; j < end; ++j)
+    {
+      sum = binary_op(sum, first[j]);
+    }
+
+    result[i] = sum;
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index i, size_type begin, size_type end) const
+  {
+    result[i] = thrust::reduce(exec, first + begin, first + end, init, binary_op);
+  }
+};
+
+
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+struct transform_reduce_segment
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  RandomAccessIterator first;
+  OutputIterator result;
+  mutable UnaryFunction unary_op;
+  T init;
+  mutable BinaryFunction binary_op;
+
+  __host__ __device__
+  transform_reduce_segment(RandomAccessIterator first, OutputIterator result, UnaryFunction unary_op, T init, BinaryFunction binary_op)
+    : first(first), result(result), unary_op(unary_op), init(init), binary_op(binary_op)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index i, size_type begin, size_type end) const
+  {
+    T sum = init;
+
+    for(size_type j = begin; j < end; ++j)
+    {
+      sum = binary_op(sum, unary_op(first[j]));
+    }
+
+    result[i] = sum;
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index i, size_type begin, size_type end) const
+  {
+    result[i] = thrust::transform_reduce(exec, first + begin, first + end, unary_op, init, binary_op);
+  }
+};
+
+
+// writes the offset of the first smallest element of a segment, or the end
+// of an empty segment
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+struct min_element_segment
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  RandomAccessIterator first;
+  OutputIterator result;
+  mutable BinaryPredicate comp;
+
+  __host__ __device__
+  min_element_segment(RandomAccessIterator first, OutputIterator result, BinaryPredicate comp)
+    : first(first), result(result), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index i, size_type begin, size_type end) const
+  {
+    size_type best = begin;
+
+    if(begin < end)
+    {
+      value_type best_value = first[begin];
+
+      for(size_type j = begin + 1; j < end; ++j)
+      {
+        value_type value = first[j];
+
+        if(comp(value, best_value))
+        {
+          best       = j;
+          best_value = value;
+        }
+      }
+    }
+    else
+    {
+      best = end;
+    }
+
+    result[i] = best;
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index i, size_type begin, size_type end) const
+  {
+    result[i] = thrust::min_element(exec, first + begin, first + end, comp) - first;
+  }
+};
+
+
+// writes the offset of the first largest element of a segment, or the end
+// of an empty segment
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+struct max_element_segment
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  RandomAccessIterator first;
+  OutputIterator result;
+  mutable BinaryPredicate comp;
+
+  __host__ __device__
+  max_element_segment(RandomAccessIterator first, OutputIterator result, BinaryPredicate comp)
+    : first(first), result(result), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index i, size_type begin, size_type end) const
+  {
+    size_type best = begin;
+
+    if(begin < end)
+    {
+      value_type best_value = first[begin];
+
+      for(size_type j = begin + 1; j < end; ++j)
+      {
+        value_type value = first[j];
+
+        if(comp(best_value, value))
+        {
+          best       = j;
+          best_value = value;
+        }
+      }
+    }
+    else
+    {
+      best = end;
+    }
+
+    result[i] = best;
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index i, size_type begin, size_type end) const
+  {
+    result[i] = thrust::max_element(exec, first + begin, first + end, comp) - first;
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,86 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file segmented_scan.h
+ *  \brief Per-segment prefix sums shared by the backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// the segment function of segmented_inclusive_scan
+template<typename RandomAccessIterator,
+         typename OutputIterator,
+         typename AssociativeOperator>
+struct inclusive_scan_segment
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  RandomAccessIterator first;
+  OutputIterator result;
+  mutable AssociativeOperator binary_op;
+
+  __host__ __device__
+  inclusive_scan_segment(RandomAccessIterator first, OutputIterator result, AssociativeOperator binary_op)
+    : first(first), result(result), binary_op(binary_op)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Index>
+  __host__ __device__
+  void operator()(Index, size_type begin, size_type end) const
+  {
+    if(begin == end)
+    {
+      return;
+    }
+
+    value_type sum = first[begin];
+    result[begin] = sum;
+
+    for(size_type j = begin + 1; j < end; ++j)
+    {
+      sum = binary_op(sum, first[j]);
+      result[j] = sum;
+    }
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index, size_type begin, size_type end) const
+  {
+    thrust::inclusive_scan(exec, first + begin, first + end, result + begin, binary_op);
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,115 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file segmented_sort.h
+ *  \brief Per-segment sorting shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/sequential/segmented_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// segment functions for for_each_segment, which sort one segment either by
+// a single thread or with the parallel sort of the calling system
+template<bool Stable,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+struct key_segment_sorter
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  RandomAccessIterator keys_first;
+  StrictWeakOrdering comp;
+
+  key_segment_sorter(RandomAccessIterator keys_first, StrictWeakOrdering comp)
+    : keys_first(keys_first), comp(comp)
+  {}
+
+  template<typename Index>
+  void operator()(Index, size_type begin, size_type end) const
+  {
+    thrust::system::detail::sequential::segmented_sort_detail::sort_segment<Stable>(keys_first + begin, keys_first + end, comp);
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index, size_type begin, size_type end) const
+  {
+    if(Stable)
+    {
+      thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+    else
+    {
+      thrust::sort(exec, keys_first + begin, keys_first + end, comp);
+    }
+  }
+};
+
+
+template<bool Stable,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+struct key_value_segment_sorter
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type size_type;
+
+  RandomAccessIterator1 keys_first;
+  RandomAccessIterator2 values_first;
+  StrictWeakOrdering comp;
+
+  key_value_segment_sorter(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first, StrictWeakOrdering comp)
+    : keys_first(keys_first), values_first(values_first), comp(comp)
+  {}
+
+  template<typename Index>
+  void operator()(Index, size_type begin, size_type end) const
+  {
+    thrust::system::detail::sequential::segmented_sort_detail::sort_segment_by_key(keys_first + begin, keys_first + end, values_first + begin, comp);
+  }
+
+  template<typename DerivedPolicy, typename Index>
+  void operator()(thrust::execution_policy<DerivedPolicy> &exec, Index, size_type begin, size_type end) const
+  {
+    if(Stable)
+    {
+      thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+    else
+    {
+      thrust::sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    }
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,351 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file selection.h
+ *  \brief Parallel selection shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/partition.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/selection.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace selection_detail
+{
+
+
+// ranges shorter than this are selected from by a single thread
+static const int min_parallel_selection_size = 1 << 15;
+
+// the number of elements sampled to choose the splitters of a round
+static const int num_samples = 128;
+
+// the splitters are this many samples below and above the sampled rank of
+// nth, so nth falls between them with high probability while only about
+// 2 * sample_margin / num_samples of the range is left for the next round
+static const int sample_margin = 8;
+
+// the expected number of rounds is small; more than this means the samples
+// keep missing, and the rest is left to introselect
+static const int max_rounds = 16;
+
+
+template<typename T, typename StrictWeakOrdering>
+struct less_than_splitter
+{
+  T splitter;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  less_than_splitter(const T &splitter, StrictWeakOrdering comp)
+    : splitter(splitter), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename U>
+  __host__ __device__
+  bool operator()(const U &x)
+  {
+    return comp(x, splitter);
+  }
+};
+
+
+template<typename T, typename StrictWeakOrdering>
+struct not_greater_than_splitter
+{
+  T splitter;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  not_greater_than_splitter(const T &splitter, StrictWeakOrdering comp)
+    : splitter(splitter), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename U>
+  __host__ __device__
+  bool operator()(const U &x)
+  {
+    return !comp(splitter, x);
+  }
+};
+
+
+// selects the first k elements of chunk i of the input into the i-th group
+// of k candidates
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+struct select_chunk
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  RandomAccessIterator1 first;
+  Size n;
+  Size num_chunks;
+  RandomAccessIterator2 candidates;
+  Size k;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  select_chunk(RandomAccessIterator1 first, Size n, Size num_chunks, RandomAccessIterator2 candidates, Size k, StrictWeakOrdering comp)
+    : first(first), n(n), num_chunks(num_chunks), candidates(candidates), k(k), comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void operator()(Size i) const
+  {
+    thrust::detail::seq_t seq;
+
+    sequential::partial_sort_copy(seq,
+                                  first + i * n / num_chunks,
+                                  first + (i + 1) * n / num_chunks,
+                                  candidates + i * k,
+                                  candidates + (i + 1) * k,
+                                  comp);
+  }
+};
+
+
+} // end namespace selection_detail
+
+
+// sample select: each round partitions the range in parallel around two
+// splitters taken from a sorted sample, and continues with the part that
+// holds nth
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void parallel_nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator first,
+                          RandomAccessIterator nth,
+                          RandomAccessIterator last,
+                          StrictWeakOrdering comp,
+                          int num_threads)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      T;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  using namespace selection_detail;
+
+  if(nth == last)
+    return;
+
+  for(int round = 0;
+      num_threads > 1 && last - first >= min_parallel_selection_size && round < max_rounds;
+      ++round)
+  {
+    const Size n = last - first;
+
+    T samples[num_samples];
+    for(int i = 0; i < num_samples; ++i)
+    {
+      samples[i] = first[i * n / num_samples];
+    }
+
+    sequential::insertion_sort(samples, samples + num_samples, comp);
+
+    const Size rank = (nth - first) * num_samples / n;
+    const T lower = samples[thrust::max<Size>(rank - sample_margin, 0)];
+    const T upper = samples[thrust::min<Size>(rank + sample_margin, num_samples - 1)];
+
+    RandomAccessIterator middle_first = thrust::partition(exec, first, last, less_than_splitter<T,StrictWeakOrdering>(lower, comp));
+    RandomAccessIterator middle_last  = thrust::partition(exec, middle_first, last, not_greater_than_splitter<T,StrictWeakOrdering>(upper, comp));
+
+    if(nth < middle_first)
+    {
+      last = middle_first;
+    }
+    else if(nth < middle_last)
+    {
+      // every element of the middle part is equivalent to nth
+      if(!comp(lower, upper))
+        return;
+
+      // the splitters bracket the whole range, so another round would not
+      // make progress
+      if(middle_first == first && middle_last == last)
+        break;
+
+      first = middle_first;
+      last  = middle_last;
+    }
+    else
+    {
+      first = middle_last;
+    }
+  }
+
+  thrust::detail::seq_t seq;
+  sequential::nth_element(seq, first, nth, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void parallel_partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                           RandomAccessIterator first,
+                           RandomAccessIterator middle,
+                           RandomAccessIterator last,
+                           StrictWeakOrdering comp,
+                           int num_threads)
+{
+  if(first == middle)
+    return;
+
+  if(num_threads < 2 || last - first < selection_detail::min_parallel_selection_size)
+  {
+    thrust::detail::seq_t seq;
+    sequential::partial_sort(seq, first, middle, last, comp);
+    return;
+  }
+
+  parallel_nth_element(exec, first, middle - 1, last, comp, num_threads);
+
+  thrust::sort(exec, first, middle - 1, comp);
+}
+
+
+// for small k, every thread selects k candidates from its part of the input
+// with a bounded heap and the candidates are merged at the end, so the input
+// is read once and never copied. Otherwise the input is copied and
+// partitioned with parallel_nth_element
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+RandomAccessIterator2 parallel_partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                                 RandomAccessIterator1 first,
+                                                 RandomAccessIterator1 last,
+                                                 RandomAccessIterator2 result_first,
+                                                 RandomAccessIterator2 result_last,
+                                                 StrictWeakOrdering comp,
+                                                 int num_threads)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      T;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = last - first;
+  const Size k = thrust::min<Size>(n, result_last - result_first);
+
+  thrust::detail::seq_t seq;
+
+  if(k == 0)
+    return result_first;
+
+  if(num_threads < 2 || n < selection_detail::min_parallel_selection_size)
+  {
+    return sequential::partial_sort_copy(seq, first, last, result_first, result_first + k, comp);
+  }
+
+  if(k * num_threads * 4 <= n)
+  {
+    typedef selection_detail::select_chunk<RandomAccessIterator1, T*, StrictWeakOrdering> SelectChunk;
+
+    thrust::detail::temporary_array<T, DerivedPolicy> candidates(exec, num_threads * k);
+
+    // temporary storage of the host systems is host memory, so the heap
+    // operations can skip the reference proxies
+    T *candidates_first = thrust::raw_pointer_cast(candidates.data());
+
+    thrust::for_each(exec,
+                     thrust::counting_iterator<Size>(0),
+                     thrust::counting_iterator<Size>(num_threads),
+                     SelectChunk(first, n, num_threads, candidates_first, k, comp));
+
+    return sequential::partial_sort_copy(seq, candidates_first, candidates_first + num_threads * k, result_first, result_first + k, comp);
+  }
+
+  thrust::detail::temporary_array<T, DerivedPolicy> copy(exec, first, last);
+
+  T *copy_first = thrust::raw_pointer_cast(copy.data());
+
+  if(k < n)
+  {
+    parallel_nth_element(exec, copy_first, copy_first + (k - 1), copy_first + n, comp, num_threads);
+  }
+
+  RandomAccessIterator2 result_end = thrust::copy(exec, copy_first, copy_first + k, result_first);
+
+  thrust::sort(exec, result_first, result_end, comp);
+
+  return result_end;
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+  parallel_top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+                        RandomAccessIterator3 keys_result,
+                        RandomAccessIterator4 values_result,
+                        StrictWeakOrdering comp,
+                        int num_threads)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  k = thrust::min<Size>(k, n);
+
+  parallel_partial_sort_copy(exec,
+                             thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
+                             thrust::make_zip_iterator(thrust::make_tuple(keys_last, values_first + n)),
+                             thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)),
+                             thrust::make_zip_iterator(thrust::make_tuple(keys_result + k, values_result + k)),
+                             sequential::selection_detail::compare_first<StrictWeakOrdering>(comp),
+                             num_threads);
+
+  return thrust::make_pair(keys_result + k, values_result + k);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
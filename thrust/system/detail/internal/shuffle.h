@@ -0,0 +1,355 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file shuffle.h
+ *  \brief Building blocks of the host implementations of shuffle.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cstddef>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// SplitMix64. The host shuffles draw their seed from the user's URBG and
+// then use this generator, whose full 64 bit output and cheap seeding let us
+// derive an independent stream for every chunk and bucket of a parallel
+// shuffle. The result thus depends only on the seed, never on the number of
+// threads.
+class shuffle_engine
+{
+public:
+  __host__ __device__
+  explicit shuffle_engine(std::uint64_t seed)
+    : state(seed)
+  {}
+
+  __host__ __device__
+  shuffle_engine(std::uint64_t seed, std::uint64_t stream)
+    : state(mix(seed ^ mix(stream + golden_gamma)))
+  {}
+
+  __host__ __device__
+  std::uint64_t operator()()
+  {
+    state += golden_gamma;
+    return mix(state);
+  }
+
+  // an unbiased draw from [0, bound), bound > 0
+  __host__ __device__
+  std::uint64_t operator()(std::uint64_t bound)
+  {
+    if(bound <= UINT64_C(0xFFFFFFFF))
+    {
+      // Lemire's multiply-and-reject method
+      const std::uint32_t bound32 = static_cast<std::uint32_t>(bound);
+
+      std::uint64_t m = static_cast<std::uint64_t>(static_cast<std::uint32_t>((*this)() >> 32)) * bound32;
+      std::uint32_t l = static_cast<std::uint32_t>(m);
+
+      if(l < bound32)
+      {
+        const std::uint32_t threshold = static_cast<std::uint32_t>(0u - bound32) % bound32;
+
+        while(l < threshold)
+        {
+          m = static_cast<std::uint64_t>(static_cast<std::uint32_t>((*this)() >> 32)) * bound32;
+          l = static_cast<std::uint32_t>(m);
+        }
+      }
+
+      return m >> 32;
+    }
+
+    const std::uint64_t threshold = (0 - bound) % bound;
+
+    std::uint64_t r = (*this)();
+    while(r < threshold)
+    {
+      r = (*this)();
+    }
+
+    return r % bound;
+  }
+
+private:
+  static const std::uint64_t golden_gamma = UINT64_C(0x9E3779B97F4A7C15);
+
+  __host__ __device__
+  static std::uint64_t mix(std::uint64_t z)
+  {
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+  }
+
+  std::uint64_t state;
+};
+
+
+// draw a 64 bit seed from a URBG whose result type may be narrower
+__thrust_exec_check_disable__
+template<typename URBG>
+__host__ __device__
+std::uint64_t make_shuffle_seed(URBG &g)
+{
+  std::uint64_t seed = 0;
+
+  for(int i = 0; i < 4; ++i)
+  {
+    seed = shuffle_engine(seed ^ static_cast<std::uint64_t>(g()))();
+  }
+
+  return seed;
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename Size>
+__host__ __device__
+void fisher_yates(RandomAccessIterator first, Size n, shuffle_engine &engine)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for(Size i = n; i > 1; --i)
+  {
+    const Size j = static_cast<Size>(engine(static_cast<std::uint64_t>(i)));
+
+    if(j != i - 1)
+    {
+      value_type tmp = first[i - 1];
+      first[i - 1] = first[j];
+      first[j] = tmp;
+    }
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomIterator, typename URBG>
+__host__ __device__
+void sequential_shuffle(RandomIterator first, RandomIterator last, URBG &g)
+{
+  shuffle_engine engine(make_shuffle_seed(g));
+  fisher_yates(first, last - first, engine);
+}
+
+
+// shuffle_copy into an output which can be read back: copy, then shuffle in
+// place, which gives the same permutation as sequential_shuffle
+__thrust_exec_check_disable__
+template<typename RandomIterator, typename OutputIterator, typename URBG>
+__host__ __device__
+void sequential_shuffle_copy(RandomIterator first, RandomIterator last, OutputIterator result, URBG &g)
+{
+  typedef typename thrust::iterator_difference<RandomIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  for(difference_type i = 0; i < n; ++i)
+  {
+    result[i] = first[i];
+  }
+
+  shuffle_engine engine(make_shuffle_seed(g));
+  fisher_yates(result, n, engine);
+}
+
+
+// The parallel host shuffles use the method of Rao and Sandelius: every
+// element is sent to a uniformly chosen bucket and each bucket is then
+// Fisher-Yates shuffled on its own, which yields a uniform permutation.
+// The input is processed in chunks; both the number of chunks and the number
+// of buckets depend only on n.
+//
+// A shuffle proceeds in four steps:
+//   1. count_chunk    counts how many elements of each chunk go to each bucket
+//   2. scan_counts    turns the counts into write positions
+//   3. scatter_chunk  replays each chunk's draws and writes its elements
+//   4. shuffle_bucket shuffles each bucket in place
+template<typename Size>
+struct bucketed_shuffle_plan
+{
+  // below this size a sequential Fisher-Yates is faster
+  static const Size min_parallel_size = Size(1) << 16;
+
+  // buckets of this many elements shuffle within the cache
+  static const Size target_bucket_size = Size(1) << 16;
+
+  static const Size max_num_chunks = 256;
+  static const int  max_bucket_bits = 12;
+
+  __host__ __device__
+  explicit bucketed_shuffle_plan(Size n)
+    : n(n), bucket_bits(0)
+  {
+    while(bucket_bits < max_bucket_bits && (Size(1) << bucket_bits) * target_bucket_size < n)
+    {
+      ++bucket_bits;
+    }
+
+    num_buckets = Size(1) << bucket_bits;
+
+    num_chunks = (n + min_parallel_size - 1) / min_parallel_size;
+    if(num_chunks > max_num_chunks)
+    {
+      num_chunks = max_num_chunks;
+    }
+    if(num_chunks < 1)
+    {
+      num_chunks = 1;
+    }
+
+    chunk_size = (n + num_chunks - 1) / num_chunks;
+  }
+
+  __host__ __device__
+  Size chunk_begin(Size c) const
+  {
+    return c * chunk_size < n ? c * chunk_size : n;
+  }
+
+  __host__ __device__
+  Size chunk_end(Size c) const
+  {
+    return chunk_begin(c + 1);
+  }
+
+  __host__ __device__
+  Size bucket(shuffle_engine &engine) const
+  {
+    return bucket_bits == 0 ? Size(0) : static_cast<Size>(engine() >> (64 - bucket_bits));
+  }
+
+  // the streams of the chunks are followed by those of the buckets
+  __host__ __device__
+  shuffle_engine chunk_engine(std::uint64_t seed, Size c) const
+  {
+    return shuffle_engine(seed, static_cast<std::uint64_t>(c));
+  }
+
+  __host__ __device__
+  shuffle_engine bucket_engine(std::uint64_t seed, Size b) const
+  {
+    return shuffle_engine(seed, static_cast<std::uint64_t>(num_chunks + b));
+  }
+
+  Size n;
+  Size num_chunks;
+  Size chunk_size;
+  Size num_buckets;
+  int  bucket_bits;
+};
+
+
+// counts receives the num_buckets counters of chunk c
+template<typename Size>
+void count_chunk(const bucketed_shuffle_plan<Size> &plan,
+                 std::uint64_t seed,
+                 Size c,
+                 Size *counts)
+{
+  for(Size b = 0; b < plan.num_buckets; ++b)
+  {
+    counts[b] = 0;
+  }
+
+  shuffle_engine engine = plan.chunk_engine(seed, c);
+
+  for(Size i = plan.chunk_begin(c); i < plan.chunk_end(c); ++i)
+  {
+    ++counts[plan.bucket(engine)];
+  }
+}
+
+
+// counts is chunk-major; on return counts[c * num_buckets + b] is the
+// position at which chunk c writes its first element of bucket b, and
+// bucket b occupies [bucket_offsets[b], bucket_offsets[b+1])
+template<typename Size>
+void scan_counts(const bucketed_shuffle_plan<Size> &plan,
+                 Size *counts,
+                 Size *bucket_offsets)
+{
+  Size sum = 0;
+
+  for(Size b = 0; b < plan.num_buckets; ++b)
+  {
+    bucket_offsets[b] = sum;
+
+    for(Size c = 0; c < plan.num_chunks; ++c)
+    {
+      Size count = counts[c * plan.num_buckets + b];
+      counts[c * plan.num_buckets + b] = sum;
+      sum += count;
+    }
+  }
+
+  bucket_offsets[plan.num_buckets] = sum;
+}
+
+
+// positions receives the num_buckets write positions of chunk c
+template<typename Size, typename RandomAccessIterator, typename OutputIterator>
+void scatter_chunk(const bucketed_shuffle_plan<Size> &plan,
+                   std::uint64_t seed,
+                   Size c,
+                   RandomAccessIterator first,
+                   OutputIterator result,
+                   Size *positions)
+{
+  shuffle_engine engine = plan.chunk_engine(seed, c);
+
+  for(Size i = plan.chunk_begin(c); i < plan.chunk_end(c); ++i)
+  {
+    result[positions[plan.bucket(engine)]++] = first[i];
+  }
+}
+
+
+template<typename Size, typename RandomAccessIterator>
+void shuffle_bucket(const bucketed_shuffle_plan<Size> &plan,
+                    std::uint64_t seed,
+                    Size b,
+                    RandomAccessIterator result,
+                    const Size *bucket_offsets)
+{
+  shuffle_engine engine = plan.bucket_engine(seed, b);
+
+  Size begin = bucket_offsets[b];
+  Size end   = bucket_offsets[b + 1];
+
+  thrust::system::detail::internal::fisher_yates(result + begin, end - begin, engine);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
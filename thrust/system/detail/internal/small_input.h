@@ -0,0 +1,71 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file small_input.h
+ *  \brief Input sizes below which the host parallel systems run sequentially.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// The omp and tbb systems run the sequential implementation of an algorithm
+// on the calling thread when its input is shorter than the cutoff of the
+// algorithm, so that tiny calls neither open a parallel region or task graph
+// nor allocate per-thread partials. Cutoffs grow with the fixed cost of the
+// parallel algorithm relative to a sequential pass.
+
+// element-wise algorithms: gather, scatter and adjacent_difference. for_each
+// has no cutoff, because it is also used to run one coarse task per thread
+static const int small_elementwise_size = 1 << 11;
+
+// copies, which are bound by memory bandwidth
+static const int small_copy_size = 1 << 14;
+
+// reductions, which also allocate one partial per thread: reduce,
+// transform_reduce, the extrema, find_if and the segmented algorithms
+static const int small_reduce_size = 1 << 12;
+
+// stream compaction, which makes several passes over the input and
+// allocates flags or offsets: copy_if, remove, unique, partition, scan,
+// reduce_by_key, merge and histogram
+static const int small_compaction_size = 1 << 13;
+
+// sorting, whose parallel implementations copy the input into temporary
+// storage before merging sorted tiles
+static const int small_sort_size = 1 << 13;
+
+
+template<typename Size>
+inline bool is_small_input(Size n, int cutoff)
+{
+  return n < static_cast<Size>(cutoff);
+} // end is_small_input()
+
+
+} // end internal
+} // end detail
+} // end system
+THRUST_NAMESPACE_END
@@ -0,0 +1,201 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file streaming_store.h
+ *  \brief Non-temporal store helpers for the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define THRUST_HAS_STREAMING_STORES 1
+#else
+#define THRUST_HAS_STREAMING_STORES 0
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// the number of bytes written by a single non-temporal store
+const std::size_t streaming_store_size = 16;
+
+
+// writes of at least this many bytes bypass the cache. below it the
+// written data likely still fits in the last level cache, where the
+// next algorithm will want to find it
+// XXX this value is a tuning opportunity
+const std::size_t streaming_store_threshold = std::size_t(1) << 24;
+
+
+// whether an OutputIterator can be written with non-temporal stores:
+// it must point to contiguous memory holding trivially copyable elements
+// which tile a streaming_store_size chunk exactly
+template<typename OutputIterator>
+struct is_streamable_iterator
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::is_contiguous_iterator<OutputIterator>::value &&
+      !thrust::detail::is_const<
+        typename thrust::detail::remove_reference<
+          typename thrust::iterator_traits<OutputIterator>::reference
+        >::type
+      >::value &&
+      std::is_trivially_copyable<typename thrust::iterator_value<OutputIterator>::type>::value &&
+      (streaming_store_size % sizeof(typename thrust::iterator_value<OutputIterator>::type) == 0)
+    >
+{};
+
+
+template<typename T, typename Size>
+inline bool use_streaming_stores(Size n)
+{
+  return THRUST_HAS_STREAMING_STORES && static_cast<std::size_t>(n) * sizeof(T) >= streaming_store_threshold;
+}
+
+
+// writes result[i] = f(i) for i in [first, last). the interior of the
+// range is written with non-temporal stores, so it bypasses the cache
+// and doesn't evict the working set. callers must call
+// streaming_store_fence() before other threads read the result
+template<typename T, typename Size, typename Function>
+inline void streaming_tabulate(T *result, Size first, Size last, Function f)
+{
+  Size i = first;
+
+#if THRUST_HAS_STREAMING_STORES
+  const Size elements_per_store = streaming_store_size / sizeof(T);
+
+  // write the unaligned head with regular stores
+  while(i < last && reinterpret_cast<std::size_t>(result + i) % streaming_store_size != 0)
+  {
+    result[i] = f(i);
+    ++i;
+  }
+
+  // elements which are less aligned than their size may never
+  // reach an aligned address
+  if(reinterpret_cast<std::size_t>(result + i) % streaming_store_size == 0)
+  {
+    for(; last - i >= elements_per_store; i += elements_per_store)
+    {
+      unsigned char chunk[streaming_store_size];
+
+      for(Size j = 0; j < elements_per_store; ++j)
+      {
+        T value = f(i + j);
+        std::memcpy(chunk + j * sizeof(T), &value, sizeof(T));
+      }
+
+      __m128i packed;
+      std::memcpy(&packed, chunk, streaming_store_size);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(result + i), packed);
+    }
+  }
+#endif
+
+  // write the tail with regular stores
+  for(; i < last; ++i)
+  {
+    result[i] = f(i);
+  }
+}
+
+
+// adapts tabulate's unary_op to streaming_tabulate
+template<typename T, typename UnaryOperation>
+struct streaming_tabulate_functor
+{
+  UnaryOperation unary_op;
+
+  streaming_tabulate_functor(UnaryOperation unary_op)
+    : unary_op(unary_op)
+  {}
+
+  template<typename Size>
+  T operator()(Size i)
+  {
+    return unary_op(i);
+  }
+};
+
+
+// adapts generate's generator to streaming_tabulate
+template<typename T, typename Generator>
+struct streaming_generate_functor
+{
+  Generator gen;
+
+  streaming_generate_functor(Generator gen)
+    : gen(gen)
+  {}
+
+  template<typename Size>
+  T operator()(Size)
+  {
+    return gen();
+  }
+};
+
+
+// adapts copy's input range to streaming_tabulate
+template<typename T, typename RandomAccessIterator>
+struct streaming_copy_functor
+{
+  RandomAccessIterator first;
+
+  streaming_copy_functor(RandomAccessIterator first)
+    : first(first)
+  {}
+
+  template<typename Size>
+  T operator()(Size i)
+  {
+    return first[i];
+  }
+};
+
+
+// orders all preceding non-temporal stores of the calling thread before
+// any later store
+inline void streaming_store_fence()
+{
+#if THRUST_HAS_STREAMING_STORES
+  _mm_sfence();
+#endif
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
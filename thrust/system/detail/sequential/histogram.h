@@ -0,0 +1,134 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Sequential implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace histogram_detail
+{
+
+
+__thrust_exec_check_disable__
+template<typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+__host__ __device__
+  OutputIterator histogram(InputIterator first,
+                           InputIterator last,
+                           OutputIterator histogram,
+                           Size num_bins,
+                           BinOp bin_op)
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type Counter;
+
+  for(Size b = 0; b < num_bins; ++b)
+  {
+    histogram[b] = Counter(0);
+  }
+
+  for(; first != last; ++first)
+  {
+    const Size b = bin_op(*first);
+
+    if(b < num_bins)
+    {
+      histogram[b] = histogram[b] + Counter(1);
+    }
+  }
+
+  return histogram + num_bins;
+}
+
+
+} // end histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+__host__ __device__
+  OutputIterator histogram_even(sequential::execution_policy<DerivedPolicy> &,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(first, last, histogram, num_bins,
+    thrust::system::detail::internal::even_bin_op<Level,Size>(lower_level, upper_level, num_bins));
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+__host__ __device__
+  OutputIterator histogram_range(sequential::execution_policy<DerivedPolicy> &,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  typedef typename thrust::iterator_difference<LevelIterator>::type Size;
+
+  const Size num_levels = thrust::distance(levels_first, levels_last);
+
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(first, last, histogram, num_bins,
+    thrust::system::detail::internal::range_bin_op<LevelIterator,Size>(levels_first, num_bins));
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
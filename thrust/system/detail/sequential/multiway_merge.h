@@ -0,0 +1,436 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file multiway_merge.h
+ *  \brief Sequential implementation of multiway_merge with a loser tree.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/swap.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/merge.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace multiway_merge_detail
+{
+
+
+// a tournament tree over the heads of k runs. Every inner node holds the run
+// which lost the match at that node together with its head, and node 0 holds
+// the overall winner, so advancing the winner replays only the matches on its
+// path to the root, reading the heads on the path from the tree instead of
+// from the runs
+template<typename Iterator, typename Size, typename StrictWeakOrdering>
+struct loser_tree
+{
+  typedef typename thrust::iterator_value<Iterator>::type value_type;
+
+  Size num_leaves;
+  Size *runs;
+  value_type *heads;
+  bool *exhausted;
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  loser_tree(Size num_leaves, Size *runs, value_type *heads, bool *exhausted, StrictWeakOrdering comp)
+    : num_leaves(num_leaves), runs(runs), heads(heads), exhausted(exhausted), comp(comp)
+  {}
+
+  // whether run a, whose head is x, wins the match against run b, whose head
+  // is y. Exhausted runs and the padding leaves past the last run lose every
+  // match. Runs meet from different subtrees, so the run with the smaller
+  // index comes from the left and wins ties, which makes the merge stable
+  __thrust_exec_check_disable__
+  __host__ __device__
+  bool wins(Size a, const value_type &x, bool a_exhausted,
+            Size b, const value_type &y, bool b_exhausted)
+  {
+    // the head of an exhausted run or a padding leaf is not an element of
+    // the input and must not be passed to comp
+    if(a_exhausted | b_exhausted)
+    {
+      return !a_exhausted;
+    }
+
+    // bitwise operators instead of branches, since the outcome of the match
+    // is unpredictable
+    const bool less    = comp(x, y);
+    const bool greater = comp(y, x);
+
+    return less | ((a < b) & (!greater));
+  }
+
+  // the node arrays hold 2 * num_leaves entries. Leaf i is stored at
+  // num_leaves + i, and the winner of inner node i is passed up through the
+  // same slot, which is free by then because the parent of leaf i is built
+  // before node i
+  __host__ __device__
+  Size winner_slot(Size node) const
+  {
+    return node < num_leaves ? num_leaves + node : node;
+  }
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void build(const Iterator *cursors, const Iterator *ends, Size num_runs)
+  {
+    for(Size i = 0; i < num_leaves; ++i)
+    {
+      runs[num_leaves + i]      = i;
+      exhausted[num_leaves + i] = i >= num_runs || cursors[i] == ends[i];
+
+      if(!exhausted[num_leaves + i])
+      {
+        heads[num_leaves + i] = *cursors[i];
+      }
+    }
+
+    for(Size node = num_leaves - 1; node > 0; --node)
+    {
+      Size winner = winner_slot(2 * node);
+      Size loser  = winner_slot(2 * node + 1);
+
+      if(wins(runs[loser], heads[loser], exhausted[loser], runs[winner], heads[winner], exhausted[winner]))
+      {
+        thrust::swap(winner, loser);
+      }
+
+      move(loser, node);
+      move(winner, num_leaves + node);
+    }
+
+    move(num_leaves + 1, 0);
+  }
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void move(Size from, Size to)
+  {
+    runs[to]      = runs[from];
+    exhausted[to] = exhausted[from];
+
+    if(!exhausted[from])
+    {
+      heads[to] = heads[from];
+    }
+  }
+
+  __host__ __device__
+  Size winner() const
+  {
+    return runs[0];
+  }
+
+  __host__ __device__
+  const value_type &winner_head() const
+  {
+    return heads[0];
+  }
+
+  // replaces the head of the winner with the next element of its run, if
+  // there is one, and replays the matches on its path
+  __thrust_exec_check_disable__
+  __host__ __device__
+  void replay(const Iterator &cursor, const Iterator &end)
+  {
+    Size       w           = runs[0];
+    bool       w_exhausted = cursor == end;
+    value_type w_head      = w_exhausted ? heads[0] : value_type(*cursor);
+
+    for(Size node = (w + num_leaves) / 2; node > 0; node /= 2)
+    {
+      const Size       l           = runs[node];
+      const value_type l_head      = heads[node];
+      const bool       l_exhausted = exhausted[node];
+
+      // select instead of swapping conditionally, for the same reason
+      const bool l_wins = wins(l, l_head, l_exhausted, w, w_head, w_exhausted);
+
+      runs[node]      = l_wins ? w : l;
+      heads[node]     = l_wins ? w_head : l_head;
+      exhausted[node] = l_wins ? w_exhausted : l_exhausted;
+      w               = l_wins ? l : w;
+      w_head          = l_wins ? l_head : w_head;
+      w_exhausted     = l_wins ? l_exhausted : w_exhausted;
+    }
+
+    runs[0]      = w;
+    heads[0]     = w_head;
+    exhausted[0] = w_exhausted;
+  }
+};
+
+
+template<typename Size>
+__host__ __device__
+Size num_leaves(Size num_runs)
+{
+  Size result = 1;
+
+  while(result < num_runs)
+  {
+    result *= 2;
+  }
+
+  return result;
+}
+
+
+// merges the runs [cursors[i], ends[i]) into result and may modify the
+// cursors
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator merge_runs(sequential::execution_policy<DerivedPolicy> &exec,
+                          InputIterator *cursors,
+                          const InputIterator *ends,
+                          Size num_runs,
+                          OutputIterator result,
+                          StrictWeakOrdering comp)
+{
+  if(num_runs == 0)
+    return result;
+
+  if(num_runs == 1)
+  {
+    for(; cursors[0] != ends[0]; ++cursors[0], ++result)
+    {
+      *result = *cursors[0];
+    }
+
+    return result;
+  }
+
+  if(num_runs == 2)
+  {
+    return sequential::merge(exec, cursors[0], ends[0], cursors[1], ends[1], result, comp);
+  }
+
+  Size n = 0;
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    n += ends[i] - cursors[i];
+  }
+
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+
+  const Size leaves = multiway_merge_detail::num_leaves(num_runs);
+
+  thrust::detail::temporary_array<Size, DerivedPolicy>       runs(exec, 2 * leaves);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> heads(exec, 2 * leaves);
+  thrust::detail::temporary_array<bool, DerivedPolicy>       exhausted(exec, 2 * leaves);
+
+  loser_tree<InputIterator, Size, StrictWeakOrdering> tree(leaves,
+                                                           thrust::raw_pointer_cast(runs.data()),
+                                                           thrust::raw_pointer_cast(heads.data()),
+                                                           thrust::raw_pointer_cast(exhausted.data()),
+                                                           comp);
+  tree.build(cursors, ends, num_runs);
+
+  for(; n > 0; --n, ++result)
+  {
+    const Size w = tree.winner();
+
+    *result = tree.winner_head();
+    ++cursors[w];
+
+    tree.replay(cursors[w], ends[w]);
+  }
+
+  return result;
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+thrust::pair<OutputIterator1,OutputIterator2>
+  merge_runs_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                    InputIterator1 *keys_cursors,
+                    const InputIterator1 *keys_ends,
+                    InputIterator2 *values_cursors,
+                    Size num_runs,
+                    OutputIterator1 keys_result,
+                    OutputIterator2 values_result,
+                    StrictWeakOrdering comp)
+{
+  if(num_runs == 0)
+    return thrust::make_pair(keys_result, values_result);
+
+  if(num_runs == 1)
+  {
+    for(; keys_cursors[0] != keys_ends[0]; ++keys_cursors[0], ++values_cursors[0], ++keys_result, ++values_result)
+    {
+      *keys_result   = *keys_cursors[0];
+      *values_result = *values_cursors[0];
+    }
+
+    return thrust::make_pair(keys_result, values_result);
+  }
+
+  if(num_runs == 2)
+  {
+    return sequential::merge_by_key(exec,
+                                    keys_cursors[0], keys_ends[0],
+                                    keys_cursors[1], keys_ends[1],
+                                    values_cursors[0], values_cursors[1],
+                                    keys_result, values_result,
+                                    comp);
+  }
+
+  Size n = 0;
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    n += keys_ends[i] - keys_cursors[i];
+  }
+
+  typedef typename thrust::iterator_value<InputIterator1>::type key_type;
+
+  const Size leaves = multiway_merge_detail::num_leaves(num_runs);
+
+  thrust::detail::temporary_array<Size, DerivedPolicy>     runs(exec, 2 * leaves);
+  thrust::detail::temporary_array<key_type, DerivedPolicy> heads(exec, 2 * leaves);
+  thrust::detail::temporary_array<bool, DerivedPolicy>     exhausted(exec, 2 * leaves);
+
+  loser_tree<InputIterator1, Size, StrictWeakOrdering> tree(leaves,
+                                                            thrust::raw_pointer_cast(runs.data()),
+                                                            thrust::raw_pointer_cast(heads.data()),
+                                                            thrust::raw_pointer_cast(exhausted.data()),
+                                                            comp);
+  tree.build(keys_cursors, keys_ends, num_runs);
+
+  for(; n > 0; --n, ++keys_result, ++values_result)
+  {
+    const Size w = tree.winner();
+
+    *keys_result   = tree.winner_head();
+    *values_result = *values_cursors[w];
+    ++keys_cursors[w];
+    ++values_cursors[w];
+
+    tree.replay(keys_cursors[w], keys_ends[w]);
+  }
+
+  return thrust::make_pair(keys_result, values_result);
+}
+
+
+} // end namespace multiway_merge_detail
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator multiway_merge(sequential::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator runs_first,
+                              RandomAccessIterator runs_last,
+                              OutputIterator result,
+                              StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      run_type;
+  typedef typename run_type::first_type                                    InputIterator;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size num_runs = runs_last - runs_first;
+
+  thrust::detail::temporary_array<InputIterator, DerivedPolicy> bounds(exec, 2 * num_runs);
+  InputIterator *cursors = thrust::raw_pointer_cast(bounds.data());
+  InputIterator *ends    = cursors + num_runs;
+
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    const run_type run = runs_first[i];
+
+    cursors[i] = run.first;
+    ends[i]    = run.second;
+  }
+
+  return multiway_merge_detail::merge_runs(exec, cursors, ends, num_runs, result, comp);
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+thrust::pair<OutputIterator1,OutputIterator2>
+  multiway_merge_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_runs_first,
+                        RandomAccessIterator1 keys_runs_last,
+                        RandomAccessIterator2 values_runs_first,
+                        OutputIterator1 keys_result,
+                        OutputIterator2 values_result,
+                        StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      run_type;
+  typedef typename run_type::first_type                                     InputIterator1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      InputIterator2;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size num_runs = keys_runs_last - keys_runs_first;
+
+  thrust::detail::temporary_array<InputIterator1, DerivedPolicy> keys_bounds(exec, 2 * num_runs);
+  thrust::detail::temporary_array<InputIterator2, DerivedPolicy> values_bounds(exec, num_runs);
+  InputIterator1 *keys_cursors   = thrust::raw_pointer_cast(keys_bounds.data());
+  InputIterator1 *keys_ends      = keys_cursors + num_runs;
+  InputIterator2 *values_cursors = thrust::raw_pointer_cast(values_bounds.data());
+
+  for(Size i = 0; i < num_runs; ++i)
+  {
+    const run_type run = keys_runs_first[i];
+
+    keys_cursors[i]   = run.first;
+    keys_ends[i]      = run.second;
+    values_cursors[i] = values_runs_first[i];
+  }
+
+  return multiway_merge_detail::merge_runs_by_key(exec, keys_cursors, keys_ends, values_cursors, num_runs, keys_result, values_result, comp);
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,459 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file segmented_sort.h
+ *  \brief Sequential implementation of segmented_sort.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace segmented_sort_detail
+{
+
+
+// segments up to this size are sorted by a sorting network when it is allowed
+static const int max_network_size = 8;
+
+// segments up to this size are sorted in place by insertion sort rather than
+// paying for the temporary storage of a merge or radix sort
+static const int max_insertion_sort_size = 32;
+
+
+template<typename T, typename StrictWeakOrdering>
+__host__ __device__
+inline void compare_exchange(T &a, T &b, StrictWeakOrdering &comp)
+{
+  // select rather than branch, so arithmetic keys compile to min/max
+  const bool swap = comp(b, a);
+  const T lo = swap ? b : a;
+  const T hi = swap ? a : b;
+  a = lo;
+  b = hi;
+}
+
+
+// size-optimal sorting networks; every index is a constant, so the keys of
+// a segment stay in registers
+template<int N> struct sorting_network;
+
+template<> struct sorting_network<2>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[1], comp);
+  }
+};
+
+template<> struct sorting_network<3>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[2], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[1], v[2], comp);
+  }
+};
+
+template<> struct sorting_network<4>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[2], comp);
+    compare_exchange(v[1], v[3], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[2], v[3], comp);
+    compare_exchange(v[1], v[2], comp);
+  }
+};
+
+template<> struct sorting_network<5>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[3], comp);
+    compare_exchange(v[1], v[4], comp);
+    compare_exchange(v[0], v[2], comp);
+    compare_exchange(v[1], v[3], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[2], v[4], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[3], v[4], comp);
+    compare_exchange(v[2], v[3], comp);
+  }
+};
+
+template<> struct sorting_network<6>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[5], comp);
+    compare_exchange(v[1], v[3], comp);
+    compare_exchange(v[2], v[4], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[3], v[4], comp);
+    compare_exchange(v[0], v[3], comp);
+    compare_exchange(v[2], v[5], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[2], v[3], comp);
+    compare_exchange(v[4], v[5], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[3], v[4], comp);
+  }
+};
+
+template<> struct sorting_network<7>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[6], comp);
+    compare_exchange(v[2], v[3], comp);
+    compare_exchange(v[4], v[5], comp);
+    compare_exchange(v[0], v[2], comp);
+    compare_exchange(v[1], v[4], comp);
+    compare_exchange(v[3], v[6], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[2], v[5], comp);
+    compare_exchange(v[3], v[4], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[4], v[6], comp);
+    compare_exchange(v[2], v[3], comp);
+    compare_exchange(v[4], v[5], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[3], v[4], comp);
+    compare_exchange(v[5], v[6], comp);
+  }
+};
+
+template<> struct sorting_network<8>
+{
+  template<typename T, typename StrictWeakOrdering>
+  __host__ __device__
+  static void apply(T *v, StrictWeakOrdering &comp)
+  {
+    compare_exchange(v[0], v[2], comp);
+    compare_exchange(v[1], v[3], comp);
+    compare_exchange(v[4], v[6], comp);
+    compare_exchange(v[5], v[7], comp);
+    compare_exchange(v[0], v[4], comp);
+    compare_exchange(v[1], v[5], comp);
+    compare_exchange(v[2], v[6], comp);
+    compare_exchange(v[3], v[7], comp);
+    compare_exchange(v[0], v[1], comp);
+    compare_exchange(v[2], v[3], comp);
+    compare_exchange(v[4], v[5], comp);
+    compare_exchange(v[6], v[7], comp);
+    compare_exchange(v[2], v[4], comp);
+    compare_exchange(v[3], v[5], comp);
+    compare_exchange(v[1], v[4], comp);
+    compare_exchange(v[3], v[6], comp);
+    compare_exchange(v[1], v[2], comp);
+    compare_exchange(v[3], v[4], comp);
+    compare_exchange(v[5], v[6], comp);
+  }
+};
+
+
+__thrust_exec_check_disable__
+template<int N,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void network_sort(RandomAccessIterator first,
+                  StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  KeyType v[N];
+
+  for(int i = 0; i < N; ++i)
+  {
+    v[i] = first[i];
+  }
+
+  sorting_network<N>::apply(v, comp);
+
+  for(int i = 0; i < N; ++i)
+  {
+    first[i] = v[i];
+  }
+}
+
+
+// networks are not stable, and are only worth it for keys that are cheap to copy
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+__host__ __device__
+bool network_sort(RandomAccessIterator,
+                  Size,
+                  StrictWeakOrdering &,
+                  thrust::detail::false_type)
+{
+  return false;
+}
+
+
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+__host__ __device__
+bool network_sort(RandomAccessIterator first,
+                  Size n,
+                  StrictWeakOrdering &comp,
+                  thrust::detail::true_type)
+{
+  switch(n)
+  {
+    case 2: network_sort<2>(first, comp); return true;
+    case 3: network_sort<3>(first, comp); return true;
+    case 4: network_sort<4>(first, comp); return true;
+    case 5: network_sort<5>(first, comp); return true;
+    case 6: network_sort<6>(first, comp); return true;
+    case 7: network_sort<7>(first, comp); return true;
+    case 8: network_sort<8>(first, comp); return true;
+    default: return false;
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<bool Stable,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_segment(RandomAccessIterator first,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n < 2)
+  {
+    return;
+  }
+
+  if(!Stable && n <= max_network_size)
+  {
+    typedef thrust::detail::integral_constant<
+      bool,
+      thrust::detail::is_arithmetic<KeyType>::value || thrust::detail::is_pointer<KeyType>::value
+    > use_network;
+
+    if(network_sort(first, n, comp, use_network()))
+    {
+      return;
+    }
+  }
+
+  if(n <= max_insertion_sort_size)
+  {
+    sequential::insertion_sort(first, last, comp);
+  }
+  else
+  {
+    thrust::detail::seq_t seq;
+    sequential::stable_sort(seq, first, last, comp);
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_segment_by_key(RandomAccessIterator1 keys_first,
+                         RandomAccessIterator1 keys_last,
+                         RandomAccessIterator2 values_first,
+                         StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  if(n < 2)
+  {
+    return;
+  }
+
+  if(n <= max_insertion_sort_size)
+  {
+    sequential::insertion_sort_by_key(keys_first, keys_last, values_first, comp);
+  }
+  else
+  {
+    thrust::detail::seq_t seq;
+    sequential::stable_sort_by_key(seq, keys_first, keys_last, values_first, comp);
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<bool Stable,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_segments(RandomAccessIterator keys_first,
+                   BeginOffsetIterator begin_offsets_first,
+                   BeginOffsetIterator begin_offsets_last,
+                   EndOffsetIterator end_offsets_first,
+                   StrictWeakOrdering comp)
+{
+  for(; begin_offsets_first != begin_offsets_last; ++begin_offsets_first, ++end_offsets_first)
+  {
+    sort_segment<Stable>(keys_first + *begin_offsets_first, keys_first + *end_offsets_first, comp);
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_segments_by_key(RandomAccessIterator1 keys_first,
+                          RandomAccessIterator2 values_first,
+                          BeginOffsetIterator begin_offsets_first,
+                          BeginOffsetIterator begin_offsets_last,
+                          EndOffsetIterator end_offsets_first,
+                          StrictWeakOrdering comp)
+{
+  for(; begin_offsets_first != begin_offsets_last; ++begin_offsets_first, ++end_offsets_first)
+  {
+    sort_segment_by_key(keys_first + *begin_offsets_first, keys_first + *end_offsets_first, values_first + *begin_offsets_first, comp);
+  }
+}
+
+
+} // end segmented_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void segmented_sort(sequential::execution_policy<DerivedPolicy> &,
+                    RandomAccessIterator keys_first,
+                    RandomAccessIterator,
+                    BeginOffsetIterator begin_offsets_first,
+                    BeginOffsetIterator begin_offsets_last,
+                    EndOffsetIterator end_offsets_first,
+                    StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments<false>(keys_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void stable_segmented_sort(sequential::execution_policy<DerivedPolicy> &,
+                           RandomAccessIterator keys_first,
+                           RandomAccessIterator,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first,
+                           StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments<true>(keys_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void segmented_sort_by_key(sequential::execution_policy<DerivedPolicy> &,
+                           RandomAccessIterator1 keys_first,
+                           RandomAccessIterator1,
+                           RandomAccessIterator2 values_first,
+                           BeginOffsetIterator begin_offsets_first,
+                           BeginOffsetIterator begin_offsets_last,
+                           EndOffsetIterator end_offsets_first,
+                           StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments_by_key(keys_first, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void stable_segmented_sort_by_key(sequential::execution_policy<DerivedPolicy> &,
+                                  RandomAccessIterator1 keys_first,
+                                  RandomAccessIterator1,
+                                  RandomAccessIterator2 values_first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  StrictWeakOrdering comp)
+{
+  segmented_sort_detail::sort_segments_by_key(keys_first, values_first, begin_offsets_first, begin_offsets_last, end_offsets_first, comp);
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
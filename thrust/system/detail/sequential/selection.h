@@ -0,0 +1,388 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file selection.h
+ *  \brief Sequential implementation of nth_element, partial_sort and top_k.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/tuple.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace selection_detail
+{
+
+
+// ranges up to this size are finished by insertion sort
+static const int max_insertion_sort_size = 16;
+
+
+// orders (key, value) tuples by their keys
+template<typename StrictWeakOrdering>
+struct compare_first
+{
+  StrictWeakOrdering comp;
+
+  __host__ __device__
+  compare_first(StrictWeakOrdering comp)
+    : comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename Tuple1, typename Tuple2>
+  __host__ __device__
+  bool operator()(const Tuple1 &a, const Tuple2 &b)
+  {
+    return comp(thrust::get<0>(a), thrust::get<0>(b));
+  }
+};
+
+
+// the heap is a max-heap with respect to comp, so its top is the element
+// which is ordered last
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+__host__ __device__
+void sift_down(RandomAccessIterator first, Size hole, Size len, const T &value, StrictWeakOrdering &comp)
+{
+  Size child = 2 * hole + 1;
+
+  while(child < len)
+  {
+    if(child + 1 < len && comp(first[child], first[child + 1]))
+    {
+      ++child;
+    }
+
+    if(!comp(value, first[child]))
+    {
+      break;
+    }
+
+    first[hole] = first[child];
+    hole        = child;
+    child       = 2 * hole + 1;
+  }
+
+  first[hole] = value;
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+__host__ __device__
+void make_heap(RandomAccessIterator first, Size len, StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  for(Size i = len / 2; i-- > 0;)
+  {
+    T value = first[i];
+    sift_down(first, i, len, value, comp);
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+__host__ __device__
+void sort_heap(RandomAccessIterator first, Size len, StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  for(; len > 1; --len)
+  {
+    T value        = first[len - 1];
+    first[len - 1] = first[0];
+    sift_down(first, Size(0), len - 1, value, comp);
+  }
+}
+
+
+// leaves the middle - first first elements of [first, last) in a heap at
+// the front of the range
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+void heap_select(RandomAccessIterator first,
+                 RandomAccessIterator middle,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      T;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size len = middle - first;
+
+  make_heap(first, len, comp);
+
+  for(RandomAccessIterator i = middle; i < last; ++i)
+  {
+    if(comp(*i, *first))
+    {
+      T value = *i;
+      *i      = *first;
+      sift_down(first, Size(0), len, value, comp);
+    }
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+void move_median_to_first(RandomAccessIterator result,
+                          RandomAccessIterator a,
+                          RandomAccessIterator b,
+                          RandomAccessIterator c,
+                          StrictWeakOrdering &comp)
+{
+  if(comp(*a, *b))
+  {
+    if(comp(*b, *c))
+      sequential::iter_swap(result, b);
+    else if(comp(*a, *c))
+      sequential::iter_swap(result, c);
+    else
+      sequential::iter_swap(result, a);
+  }
+  else if(comp(*a, *c))
+    sequential::iter_swap(result, a);
+  else if(comp(*b, *c))
+    sequential::iter_swap(result, c);
+  else
+    sequential::iter_swap(result, b);
+}
+
+
+// partitions [first + 1, last) around the median of three, which is moved to
+// *first. Returns the start of the part which is not less than the pivot
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator partition_around_median(RandomAccessIterator first,
+                                             RandomAccessIterator last,
+                                             StrictWeakOrdering &comp)
+{
+  RandomAccessIterator pivot = first;
+
+  move_median_to_first(pivot, first + 1, first + (last - first) / 2, last - 1, comp);
+
+  ++first;
+
+  while(true)
+  {
+    while(comp(*first, *pivot))
+      ++first;
+
+    --last;
+
+    while(comp(*pivot, *last))
+      --last;
+
+    if(!(first < last))
+      return first;
+
+    sequential::iter_swap(first, last);
+
+    ++first;
+  }
+}
+
+
+// quickselect which falls back to heap selection when the partitions keep
+// coming out unbalanced, so the worst case stays O(n log n)
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+__host__ __device__
+void introselect(RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering &comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  Size depth_limit = 0;
+  for(Size n = last - first; n > 1; n >>= 1)
+  {
+    depth_limit += 2;
+  }
+
+  while(last - first > max_insertion_sort_size)
+  {
+    if(depth_limit-- == 0)
+    {
+      heap_select(first, nth + 1, last, comp);
+
+      // the top of the heap is the largest of the nth + 1 first elements
+      sequential::iter_swap(first, nth);
+      return;
+    }
+
+    RandomAccessIterator cut = partition_around_median(first, last, comp);
+
+    if(cut <= nth)
+      first = cut;
+    else
+      last = cut;
+  }
+
+  sequential::insertion_sort(first, last, comp);
+}
+
+
+} // end namespace selection_detail
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void nth_element(sequential::execution_policy<DerivedPolicy> &,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  if(nth == last)
+    return;
+
+  selection_detail::introselect(first, nth, last, comp);
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void partial_sort(sequential::execution_policy<DerivedPolicy> &,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  if(first == middle)
+    return;
+
+  selection_detail::heap_select(first, middle, last, comp);
+  selection_detail::sort_heap(first, middle - first, comp);
+}
+
+
+// keeps the selected elements in a heap in the output, so the input is read
+// once and most elements are rejected by a single comparison with the top
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator2 partial_sort_copy(sequential::execution_policy<DerivedPolicy> &,
+                                        RandomAccessIterator1 first,
+                                        RandomAccessIterator1 last,
+                                        RandomAccessIterator2 result_first,
+                                        RandomAccessIterator2 result_last,
+                                        StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      T;
+  typedef typename thrust::iterator_difference<RandomAccessIterator2>::type Size;
+
+  const Size capacity = result_last - result_first;
+
+  Size len = 0;
+  for(; first != last && len < capacity; ++first, ++len)
+  {
+    result_first[len] = *first;
+  }
+
+  if(len == 0)
+    return result_first;
+
+  selection_detail::make_heap(result_first, len, comp);
+
+  for(; first != last; ++first)
+  {
+    T value = *first;
+
+    if(comp(value, *result_first))
+    {
+      selection_detail::sift_down(result_first, Size(0), len, value, comp);
+    }
+  }
+
+  selection_detail::sort_heap(result_first, len, comp);
+
+  return result_first + len;
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename StrictWeakOrdering>
+__host__ __device__
+thrust::pair<RandomAccessIterator3,RandomAccessIterator4>
+  top_k_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+               RandomAccessIterator1 keys_first,
+               RandomAccessIterator1 keys_last,
+               RandomAccessIterator2 values_first,
+               typename thrust::iterator_difference<RandomAccessIterator1>::type k,
+               RandomAccessIterator3 keys_result,
+               RandomAccessIterator4 values_result,
+               StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  k = thrust::min<Size>(k, n);
+
+  sequential::partial_sort_copy(exec,
+                                thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
+                                thrust::make_zip_iterator(thrust::make_tuple(keys_last, values_first + n)),
+                                thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)),
+                                thrust::make_zip_iterator(thrust::make_tuple(keys_result + k, values_result + k)),
+                                selection_detail::compare_first<StrictWeakOrdering>(comp));
+
+  return thrust::make_pair(keys_result + k, values_result + k);
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
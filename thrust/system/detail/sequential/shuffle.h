@@ -0,0 +1,117 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file shuffle.h
+ *  \brief Sequential implementation of shuffle.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace shuffle_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+__host__ __device__
+  void shuffle_copy(sequential::execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::true_type) // result can't be read
+{
+  thrust::system::detail::generic::shuffle_copy(exec, first, last, result, g);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+__host__ __device__
+  void shuffle_copy(sequential::execution_policy<DerivedPolicy> &,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::false_type) // result can be read
+{
+  thrust::system::detail::internal::sequential_shuffle_copy(first, last, result, g);
+}
+
+
+} // end namespace shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+__host__ __device__
+  void shuffle(sequential::execution_policy<DerivedPolicy> &,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  thrust::system::detail::internal::sequential_shuffle(first, last, g);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+__host__ __device__
+  void shuffle_copy(sequential::execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // shuffling in place needs to read back the output
+  shuffle_detail::shuffle_copy(exec, first, last, result, g,
+    typename thrust::detail::is_output_iterator<OutputIterator>::type());
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
+
@@ -20,10 +20,12 @@
 #include <thrust/detail/config.h>
 
 #include <thrust/reverse.h>
+#include <thrust/radix_key.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -104,6 +106,85 @@ void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+//////////////////////
+// Radix Key Orders //
+//////////////////////
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename KeyType>
+__host__ __device__
+void stable_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 thrust::bit_range_less<KeyType> comp,
+                 thrust::detail::true_type)
+{
+  thrust::system::detail::sequential::stable_radix_sort(exec, first, last,
+                                                        thrust::detail::radix_encoder<KeyType>(),
+                                                        comp.begin_bit, comp.end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename KeyType>
+__host__ __device__
+void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        thrust::bit_range_less<KeyType> comp,
+                        thrust::detail::true_type)
+{
+  thrust::system::detail::sequential::stable_radix_sort_by_key(exec, first1, last1, first2,
+                                                               thrust::detail::radix_encoder<KeyType>(),
+                                                               comp.begin_bit, comp.end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Decomposer>
+__host__ __device__
+void stable_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 thrust::decomposer_less<Decomposer> comp,
+                 thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+  typedef thrust::detail::decomposed_radix_encoder<KeyType, Decomposer> Encoder;
+
+  thrust::system::detail::sequential::stable_radix_sort(exec, first, last,
+                                                        Encoder(comp.decompose),
+                                                        0, Encoder::num_bits);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposer>
+__host__ __device__
+void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        thrust::decomposer_less<Decomposer> comp,
+                        thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
+  typedef thrust::detail::decomposed_radix_encoder<KeyType, Decomposer> Encoder;
+
+  thrust::system::detail::sequential::stable_radix_sort_by_key(exec, first1, last1, first2,
+                                                               Encoder(comp.decompose),
+                                                               0, Encoder::num_bits);
+}
+
+
 ////////////////
 // Merge Sort //
 ////////////////
@@ -139,14 +220,31 @@ void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+// keys compared by decomposer_less are radix sorted if their fields fit in 64 bits
+template<typename KeyType, typename Compare>
+struct is_radix_sortable_decomposition
+  : thrust::detail::false_type
+{};
+
+
+template<typename KeyType, typename Decomposer>
+struct is_radix_sortable_decomposition<KeyType, thrust::decomposer_less<Decomposer> >
+  : thrust::detail::decomposed_radix_encoder<KeyType, Decomposer>::is_radix_sortable
+{};
+
+
 template<typename KeyType, typename Compare>
 struct use_primitive_sort
-  : thrust::detail::and_<
-      thrust::detail::is_arithmetic<KeyType>,
-      thrust::detail::or_<
-        thrust::detail::is_same<Compare, thrust::less<KeyType> >,
-        thrust::detail::is_same<Compare, thrust::greater<KeyType> >
-      >
+  : thrust::detail::or_<
+      thrust::detail::and_<
+        thrust::detail::is_arithmetic<KeyType>,
+        thrust::detail::or_<
+          thrust::detail::is_same<Compare, thrust::less<KeyType> >,
+          thrust::detail::is_same<Compare, thrust::greater<KeyType> >,
+          thrust::detail::is_same<Compare, thrust::bit_range_less<KeyType> >
+        >
+      >,
+      is_radix_sortable_decomposition<KeyType, Compare>
     >
 {};
 
@@ -46,6 +46,34 @@ void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
                               RandomAccessIterator2 values_begin);
 
 
+// these versions sort on the bits [begin_bit, end_bit) of the keys as mapped
+// by encode to unsigned integers
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Encoder>
+__host__ __device__
+void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator begin,
+                       RandomAccessIterator end,
+                       Encoder encode,
+                       int begin_bit,
+                       int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Encoder>
+__host__ __device__
+void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 keys_begin,
+                              RandomAccessIterator1 keys_end,
+                              RandomAccessIterator2 values_begin,
+                              Encoder encode,
+                              int begin_bit,
+                              int end_bit);
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -25,10 +25,10 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/cstdint.h>
+#include <thrust/detail/radix_encoder.h>
+#include <thrust/detail/seq.h>
 #include <thrust/scatter.h>
 
-#include <limits>
-
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -40,122 +40,25 @@ namespace radix_sort_detail
 {
 
 
-template <typename T>
-struct RadixEncoder : public thrust::identity<T>
-{};
-
-
-template <>
-struct RadixEncoder<char> : public thrust::unary_function<char, unsigned char>
-{
-  __host__ __device__
-  unsigned char operator()(char x) const
-  {
-    if(std::numeric_limits<char>::is_signed)
-    {
-      return static_cast<unsigned char>(x) ^ static_cast<unsigned char>(1) << (8 * sizeof(unsigned char) - 1);
-    }
-    else
-    {
-      return x;
-    }
-  }
-};
-
-template <>
-struct RadixEncoder<signed char> : public thrust::unary_function<signed char, unsigned char>
-{
-  __host__ __device__
-  unsigned char operator()(signed char x) const
-  {
-    return static_cast<unsigned char>(x) ^ static_cast<unsigned char>(1) << (8 * sizeof(unsigned char) - 1);
-  }
-};
-
-template <>
-struct RadixEncoder<short> : public thrust::unary_function<short, unsigned short>
-{
-  __host__ __device__
-  unsigned short operator()(short x) const
-  {
-    return static_cast<unsigned short>(x) ^ static_cast<unsigned short>(1) << (8 * sizeof(unsigned short) - 1);
-  }
-};
-
-template <>
-struct RadixEncoder<int> : public thrust::unary_function<int, unsigned int>
-{
-  __host__ __device__
-  unsigned long operator()(long x) const
-  {
-    return x ^ static_cast<unsigned int>(1) << (8 * sizeof(unsigned int) - 1);
-  }
-};
-
-template <>
-struct RadixEncoder<long> : public thrust::unary_function<long, unsigned long>
-{
-  __host__ __device__
-  unsigned long operator()(long x) const
-  {
-    return x ^ static_cast<unsigned long>(1) << (8 * sizeof(unsigned long) - 1);
-  }
-};
-
-template <>
-struct RadixEncoder<long long> : public thrust::unary_function<long long, unsigned long long>
-{
-  __host__ __device__
-  unsigned long long operator()(long long x) const
-  {
-    return x ^ static_cast<unsigned long long>(1) << (8 * sizeof(unsigned long long) - 1);
-  }
-};
-
-// ideally we'd use uint32 here and uint64 below
-template <>
-struct RadixEncoder<float> : public thrust::unary_function<float, thrust::detail::uint32_t>
-{
-  __host__ __device__
-  thrust::detail::uint32_t operator()(float x) const
-  {
-    union { float f; thrust::detail::uint32_t i; } u;
-    u.f = x;
-    thrust::detail::uint32_t mask = -static_cast<thrust::detail::int32_t>(u.i >> 31) | (static_cast<thrust::detail::uint32_t>(1) << 31);
-    return u.i ^ mask;
-  }
-};
-
-template <>
-struct RadixEncoder<double> : public thrust::unary_function<double, thrust::detail::uint64_t>
-{
-  __host__ __device__
-  thrust::detail::uint64_t operator()(double x) const
-  {
-    union { double f; thrust::detail::uint64_t i; } u;
-    u.f = x;
-    thrust::detail::uint64_t mask = -static_cast<thrust::detail::int64_t>(u.i >> 63) | (static_cast<thrust::detail::uint64_t>(1) << 63);
-    return u.i ^ mask;
-  }
-};
-
-
 // this functor returns a key's to its histogram bucket count and post-increments the bucket
-template<unsigned int RadixBits, typename KeyType>
+template<unsigned int RadixBits, typename KeyType, typename Encoder>
   struct bucket_functor
 {
-  typedef RadixEncoder<KeyType> Encoder;
   typedef typename Encoder::result_type EncodedType;
   typedef size_t result_type;
   static const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
   Encoder encode;
-  EncodedType bit_shift;
+  unsigned int begin_bit;
+  EncodedType field_mask;
+  unsigned int bit_shift;
   size_t *histogram;
 
   __host__ __device__
-  bucket_functor(EncodedType bit_shift, size_t *histogram)
-    : encode(),
+  bucket_functor(Encoder encode, unsigned int begin_bit, EncodedType field_mask, unsigned int bit_shift, size_t *histogram)
+    : encode(encode),
+      begin_bit(begin_bit),
+      field_mask(field_mask),
       bit_shift(bit_shift),
       histogram(histogram)
   {}
@@ -163,7 +66,7 @@ template<unsigned int RadixBits, typename KeyType>
   inline __host__ __device__
   size_t operator()(KeyType key)
   {
-    const EncodedType x = encode(key);
+    const EncodedType x = static_cast<EncodedType>(encode(key) >> begin_bit) & field_mask;
 
     // note that we mutate the histogram here
     return histogram[(x >> bit_shift) & BitMask]++;
@@ -171,83 +74,89 @@ template<unsigned int RadixBits, typename KeyType>
 };
 
 
-template<unsigned int RadixBits,
-         typename DerivedPolicy,
+template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
-         typename Integer>
+         typename BucketFunctor>
 inline __host__ __device__
-void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
+void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &,
                      RandomAccessIterator1 first,
                      const size_t n,
                      RandomAccessIterator2 result,
-                     Integer bit_shift,
-                     size_t *histogram)
+                     BucketFunctor bucket)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(exec,
+  // note that we are going to mutate the histogram during this sequential scatter,
+  // so it must not be dispatched to the parallel scatter of a derived system
+  thrust::scatter(thrust::seq,
                   first, first + n,
-                  thrust::make_transform_iterator(first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
+                  thrust::make_transform_iterator(first, bucket),
                   result);
 }
 
 
-template<unsigned int RadixBits,
-         typename DerivedPolicy,
+template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename RandomAccessIterator3,
          typename RandomAccessIterator4,
-         typename Integer>
+         typename BucketFunctor>
 __host__ __device__
-void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
+void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &,
                      RandomAccessIterator1 keys_first,
                      RandomAccessIterator2 values_first,
                      const size_t n,
                      RandomAccessIterator3 keys_result,
                      RandomAccessIterator4 values_result,
-                     Integer bit_shift,
-                     size_t *histogram)
+                     BucketFunctor bucket)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-
-  // note that we are going to mutate the histogram during this sequential scatter
-  thrust::scatter(exec,
+  // note that we are going to mutate the histogram during this sequential scatter,
+  // so it must not be dispatched to the parallel scatter of a derived system
+  thrust::scatter(thrust::seq,
                   thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
                   thrust::make_zip_iterator(thrust::make_tuple(keys_first + n, values_first + n)),
-                  thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
+                  thrust::make_transform_iterator(keys_first, bucket),
                   thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)));
 }
 
 
+// sorts the keys on the encoded bits [begin_bit, end_bit), which the caller
+// has clamped to the width of the encoded type
 template<unsigned int RadixBits,
          bool HasValues,
          typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename RandomAccessIterator3,
-         typename RandomAccessIterator4>
+         typename RandomAccessIterator4,
+         typename Encoder>
 __host__ __device__
 void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 RandomAccessIterator1 keys1,
                 RandomAccessIterator2 keys2,
                 RandomAccessIterator3 vals1,
                 RandomAccessIterator4 vals2,
-                const size_t N)
+                const size_t N,
+                Encoder encode,
+                unsigned int begin_bit,
+                unsigned int end_bit)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
 
-  typedef RadixEncoder<KeyType> Encoder;
   typedef typename Encoder::result_type EncodedType;
+  typedef bucket_functor<RadixBits, KeyType, Encoder> Bucket;
 
   const unsigned int NumHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
   const unsigned int HistogramSize =  1 << RadixBits;
 
   const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
-  Encoder encode;
+  // only the digits covering [begin_bit, end_bit) are sorted on; bits above
+  // end_bit are masked off, so the last digit may be narrower than RadixBits
+  const unsigned int NumPasses = (end_bit - begin_bit + (RadixBits - 1)) / RadixBits;
+
+  const EncodedType FieldMask = (end_bit - begin_bit < 8 * sizeof(EncodedType))
+                              ? static_cast<EncodedType>((static_cast<EncodedType>(1) << (end_bit - begin_bit)) - 1)
+                              : static_cast<EncodedType>(~static_cast<EncodedType>(0));
 
   // storage for histograms
   size_t histograms[NumHistograms][HistogramSize] = {{0}};
@@ -261,17 +170,20 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
   // compute histograms
   for(size_t i = 0; i < N; i++)
   {
-    const EncodedType x = encode(keys1[i]);
+    const EncodedType x = static_cast<EncodedType>(encode(keys1[i]) >> begin_bit) & FieldMask;
 
     for(unsigned int j = 0; j < NumHistograms; j++)
     {
-      const auto BitShift = static_cast<EncodedType>(RadixBits * j);
-      histograms[j][(x >> BitShift) & BitMask]++;
+      if(j < NumPasses)
+      {
+        const auto BitShift = static_cast<EncodedType>(RadixBits * j);
+        histograms[j][(x >> BitShift) & BitMask]++;
+      }
     }
   }
 
   // scan histograms
-  for(unsigned int i = 0; i < NumHistograms; i++)
+  for(unsigned int i = 0; i < NumPasses; i++)
   {
     size_t sum = 0;
 
@@ -289,9 +201,9 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
   }
 
   // shuffle keys and (optionally) values
-  for(unsigned int i = 0; i < NumHistograms; i++)
+  for(unsigned int i = 0; i < NumPasses; i++)
   {
-    const EncodedType BitShift = static_cast<EncodedType>(RadixBits * i);
+    const Bucket bucket(encode, begin_bit, FieldMask, RadixBits * i, histograms[i]);
 
     if(!skip_shuffle[i])
     {
@@ -299,22 +211,22 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
       {
         if(HasValues)
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
+          radix_shuffle_n(exec, keys2, vals2, N, keys1, vals1, bucket);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, N, keys1, BitShift, histograms[i]);
+          radix_shuffle_n(exec, keys2, N, keys1, bucket);
         }
       }
       else
       {
         if(HasValues)
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
+          radix_shuffle_n(exec, keys1, vals1, N, keys2, vals2, bucket);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, N, keys2, BitShift, histograms[i]);
+          radix_shuffle_n(exec, keys1, N, keys2, bucket);
         }
       }
 
@@ -347,27 +259,35 @@ struct radix_sort_dispatcher<1>
 {
   template<typename DerivedPolicy,
            typename RandomAccessIterator1,
-           typename RandomAccessIterator2>
+           typename RandomAccessIterator2,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+    radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
   }
 
   template<typename DerivedPolicy,
            typename RandomAccessIterator1,
            typename RandomAccessIterator2,
            typename RandomAccessIterator3,
-           typename RandomAccessIterator4>
+           typename RandomAccessIterator4,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+    radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
   }
 };
 
@@ -377,11 +297,15 @@ struct radix_sort_dispatcher<2>
 {
   template<typename DerivedPolicy,
            typename RandomAccessIterator1,
-           typename RandomAccessIterator2>
+           typename RandomAccessIterator2,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
 #ifdef __QNX__
     // XXX war for nvbug 200193674
@@ -391,11 +315,11 @@ struct radix_sort_dispatcher<2>
 #endif
     if (condition)
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<16,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<16,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
   }
 
@@ -404,12 +328,16 @@ struct radix_sort_dispatcher<2>
            typename RandomAccessIterator1,
            typename RandomAccessIterator2,
            typename RandomAccessIterator3,
-           typename RandomAccessIterator4>
+           typename RandomAccessIterator4,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
 #ifdef __QNX__
     // XXX war for nvbug 200193674
@@ -419,11 +347,11 @@ struct radix_sort_dispatcher<2>
 #endif
     if (condition)
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<16,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<16,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
   }
 };
@@ -434,19 +362,28 @@ struct radix_sort_dispatcher<4>
 {
   template<typename DerivedPolicy,
            typename RandomAccessIterator1,
-           typename RandomAccessIterator2>
+           typename RandomAccessIterator2,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    if(N < (1 << 22))
+    if(end_bit - begin_bit <= 22)
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      // a narrow bit range is sorted in at most two passes
+      radix_sort_detail::radix_sort<11,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
+    }
+    else if(N < (1 << 22))
+    {
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
   }
 
@@ -454,20 +391,29 @@ struct radix_sort_dispatcher<4>
            typename RandomAccessIterator1,
            typename RandomAccessIterator2,
            typename RandomAccessIterator3,
-           typename RandomAccessIterator4>
+           typename RandomAccessIterator4,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    if(N < (1 << 22))
+    if(end_bit - begin_bit <= 22)
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      // a narrow bit range is sorted in at most two passes
+      radix_sort_detail::radix_sort<11,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
+    }
+    else if(N < (1 << 22))
+    {
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
   }
 };
@@ -478,19 +424,28 @@ struct radix_sort_dispatcher<8>
 {
   template<typename DerivedPolicy,
            typename RandomAccessIterator1,
-           typename RandomAccessIterator2>
+           typename RandomAccessIterator2,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    if(N < (1 << 21))
+    if(end_bit - begin_bit <= 22)
+    {
+      // a narrow bit range is sorted in at most two passes
+      radix_sort_detail::radix_sort<11,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
+    }
+    else if(N < (1 << 21))
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, encode, begin_bit, end_bit);
     }
   }
 
@@ -498,36 +453,67 @@ struct radix_sort_dispatcher<8>
            typename RandomAccessIterator1,
            typename RandomAccessIterator2,
            typename RandomAccessIterator3,
-           typename RandomAccessIterator4>
+           typename RandomAccessIterator4,
+           typename Encoder>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  Encoder encode,
+                  unsigned int begin_bit,
+                  unsigned int end_bit)
   {
-    if(N < (1 << 21))
+    if(end_bit - begin_bit <= 22)
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      // a narrow bit range is sorted in at most two passes
+      radix_sort_detail::radix_sort<11,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
+    }
+    else if(N < (1 << 21))
+    {
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
     }
   }
 };
 
 
+// clamps the bit range to the encoded keys and returns false if no bit is left
+template<typename Encoder>
+__host__ __device__
+bool clamp_bit_range(int &begin_bit, int &end_bit)
+{
+  const int num_bits = 8 * sizeof(typename Encoder::result_type);
+
+  if(end_bit > num_bits) end_bit = num_bits;
+  if(begin_bit < 0)      begin_bit = 0;
+
+  return begin_bit < end_bit;
+}
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator1,
-         typename RandomAccessIterator2>
+         typename RandomAccessIterator2,
+         typename Encoder>
 __host__ __device__
 void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 RandomAccessIterator1 keys1,
                 RandomAccessIterator2 keys2,
-                const size_t N)
+                const size_t N,
+                Encoder encode,
+                int begin_bit,
+                int end_bit)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, N);
+  typedef typename Encoder::result_type EncodedType;
+
+  if(clamp_bit_range<Encoder>(begin_bit, end_bit))
+  {
+    radix_sort_dispatcher<sizeof(EncodedType)>()(exec, keys1, keys2, N, encode, begin_bit, end_bit);
+  }
 }
 
 
@@ -535,17 +521,25 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename RandomAccessIterator3,
-         typename RandomAccessIterator4>
+         typename RandomAccessIterator4,
+         typename Encoder>
 __host__ __device__
 void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 RandomAccessIterator1 keys1,
                 RandomAccessIterator2 keys2,
                 RandomAccessIterator3 vals1,
                 RandomAccessIterator4 vals2,
-                const size_t N)
+                const size_t N,
+                Encoder encode,
+                int begin_bit,
+                int end_bit)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, vals1, vals2, N);
+  typedef typename Encoder::result_type EncodedType;
+
+  if(clamp_bit_range<Encoder>(begin_bit, end_bit))
+  {
+    radix_sort_dispatcher<sizeof(EncodedType)>()(exec, keys1, keys2, vals1, vals2, N, encode, begin_bit, end_bit);
+  }
 }
 
 
@@ -553,11 +547,15 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
 
 
 template<typename DerivedPolicy,
-         typename RandomAccessIterator>
+         typename RandomAccessIterator,
+         typename Encoder>
 __host__ __device__
 void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                        RandomAccessIterator first,
-                       RandomAccessIterator last)
+                       RandomAccessIterator last,
+                       Encoder encode,
+                       int begin_bit,
+                       int end_bit)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
 
@@ -565,18 +563,22 @@ void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
 
   thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, N);
 
-  radix_sort_detail::radix_sort(exec, first, temp.begin(), N);
+  radix_sort_detail::radix_sort(exec, first, temp.begin(), N, encode, begin_bit, end_bit);
 }
 
 
 template<typename DerivedPolicy,
          typename RandomAccessIterator1,
-         typename RandomAccessIterator2>
+         typename RandomAccessIterator2,
+         typename Encoder>
 __host__ __device__
 void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
                               RandomAccessIterator1 first1,
                               RandomAccessIterator1 last1,
-                              RandomAccessIterator2 first2)
+                              RandomAccessIterator2 first2,
+                              Encoder encode,
+                              int begin_bit,
+                              int end_bit)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
   typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
@@ -586,7 +588,39 @@ void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
   thrust::detail::temporary_array<KeyType, DerivedPolicy>   temp1(exec, N);
   thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, N);
 
-  radix_sort_detail::radix_sort(exec, first1, temp1.begin(), first2, temp2.begin(), N);
+  radix_sort_detail::radix_sort(exec, first1, temp1.begin(), first2, temp2.begin(), N, encode, begin_bit, end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  sequential::stable_radix_sort(exec, first, last,
+                                thrust::detail::radix_encoder<KeyType>(),
+                                0, thrust::detail::radix_encoded_bits<KeyType>::value);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first1,
+                              RandomAccessIterator1 last1,
+                              RandomAccessIterator2 first2)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  sequential::stable_radix_sort_by_key(exec, first1, last1, first2,
+                                       thrust::detail::radix_encoder<KeyType>(),
+                                       0, thrust::detail::radix_encoded_bits<KeyType>::value);
 }
 
 
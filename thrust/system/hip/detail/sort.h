@@ -35,6 +35,7 @@
 #include <thrust/system/hip/detail/par_to_seq.h>
 #include <thrust/sort.h>
 #include <thrust/distance.h>
+#include <thrust/radix_key.h>
 
 // rocPRIM includes
 #include <rocprim/rocprim.hpp>
@@ -160,6 +161,26 @@ namespace __merge_sort
 namespace __radix_sort
 {
 
+    // rocPRIM requires 0 <= begin_bit <= end_bit <= 8 * sizeof(K)
+    template <class K>
+    THRUST_HIP_RUNTIME_FUNCTION
+    unsigned int clamp_end_bit(const thrust::bit_range_less<K>& compare_op)
+    {
+        const int num_bits = sizeof(K) * 8;
+        return compare_op.end_bit < 0          ? 0
+               : compare_op.end_bit > num_bits ? num_bits
+                                               : compare_op.end_bit;
+    }
+
+    template <class K>
+    THRUST_HIP_RUNTIME_FUNCTION
+    unsigned int clamp_begin_bit(const thrust::bit_range_less<K>& compare_op, unsigned int end_bit)
+    {
+        return compare_op.begin_bit < 0                                  ? 0
+               : static_cast<unsigned int>(compare_op.begin_bit) > end_bit ? end_bit
+                                                                         : compare_op.begin_bit;
+    }
+
     template <class SORT_ITEMS, class Comparator>
     struct dispatch;
 
@@ -174,6 +195,7 @@ namespace __radix_sort
              KeysIt  keys,
              ItemsIt /*items*/,
              Size        count,
+             thrust::less<K> /*compare_op*/,
              hipStream_t stream,
              bool        debug_sync)
         {
@@ -200,6 +222,7 @@ namespace __radix_sort
              KeysIt  keys,
              ItemsIt /*items*/,
              Size        count,
+             thrust::greater<K> /*compare_op*/,
              hipStream_t stream,
              bool        debug_sync)
         {
@@ -226,6 +249,7 @@ namespace __radix_sort
              KeysIt      keys,
              ItemsIt     items,
              Size        count,
+             thrust::less<K> /*compare_op*/,
              hipStream_t stream,
              bool        debug_sync)
         {
@@ -254,6 +278,7 @@ namespace __radix_sort
               KeysIt      keys,
               ItemsIt     items,
               Size        count,
+              thrust::greater<K> /*compare_op*/,
               hipStream_t stream,
               bool        debug_sync)
         {
@@ -271,6 +296,68 @@ namespace __radix_sort
         }
     }; // struct dispatch -- sort pairs in descending order;
 
+    // sort keys on a range of bits
+    template <class K>
+    struct dispatch<detail::false_type, thrust::bit_range_less<K>>
+    {
+        template <class KeysIt, class ItemsIt, class Size>
+        static hipError_t THRUST_HIP_RUNTIME_FUNCTION
+        doit(void*                     d_temp_storage,
+             size_t&                   temp_storage_bytes,
+             KeysIt                    keys,
+             ItemsIt                   /*items*/,
+             Size                      count,
+             thrust::bit_range_less<K> compare_op,
+             hipStream_t               stream,
+             bool                      debug_sync)
+        {
+            const unsigned int end_bit   = clamp_end_bit<K>(compare_op);
+            const unsigned int begin_bit = clamp_begin_bit(compare_op, end_bit);
+
+            return rocprim::radix_sort_keys(d_temp_storage,
+                                            temp_storage_bytes,
+                                            keys,
+                                            keys,
+                                            static_cast<unsigned int>(count),
+                                            begin_bit,
+                                            end_bit,
+                                            stream,
+                                            debug_sync);
+        }
+    }; // struct dispatch -- sort keys on a range of bits;
+
+    // sort pairs on a range of bits
+    template <class K>
+    struct dispatch<detail::true_type, thrust::bit_range_less<K>>
+    {
+        template <class KeysIt, class ItemsIt, class Size>
+        static hipError_t THRUST_HIP_RUNTIME_FUNCTION
+        doit(void*                     d_temp_storage,
+             size_t&                   temp_storage_bytes,
+             KeysIt                    keys,
+             ItemsIt                   items,
+             Size                      count,
+             thrust::bit_range_less<K> compare_op,
+             hipStream_t               stream,
+             bool                      debug_sync)
+        {
+            const unsigned int end_bit   = clamp_end_bit<K>(compare_op);
+            const unsigned int begin_bit = clamp_begin_bit(compare_op, end_bit);
+
+            return rocprim::radix_sort_pairs(d_temp_storage,
+                                             temp_storage_bytes,
+                                             keys,
+                                             keys,
+                                             items,
+                                             items,
+                                             static_cast<unsigned int>(count),
+                                             begin_bit,
+                                             end_bit,
+                                             stream,
+                                             debug_sync);
+        }
+    }; // struct dispatch -- sort pairs on a range of bits;
+
     template <typename SORT_ITEMS,
               typename Derived,
               typename KeysIt,
@@ -281,7 +368,7 @@ namespace __radix_sort
                     KeysIt                     keys_first,
                     KeysIt                     keys_last,
                     ItemsIt                    items_first,
-                    CompareOp )
+                    CompareOp                  compare_op)
     {
         typedef typename iterator_traits<KeysIt>::difference_type size_type;
 
@@ -301,6 +388,7 @@ namespace __radix_sort
                                                        keys_first,
                                                        items_first,
                                                        count,
+                                                       compare_op,
                                                        stream,
                                                        debug_sync);
         hip_rocprim::throw_on_error(status, "radix_sort: failed on 1st step");
@@ -315,6 +403,7 @@ namespace __radix_sort
                                                        keys_first,
                                                        items_first,
                                                        count,
+                                                       compare_op,
                                                        stream,
                                                        debug_sync);
         hip_rocprim::throw_on_error(status, "radix_sort: failed on 2nd step");
@@ -336,7 +425,8 @@ namespace __smart_sort
         : thrust::detail::and_<
               thrust::detail::is_arithmetic<Key>,
               thrust::detail::or_<thrust::detail::is_same<CompareOp, thrust::less<Key>>,
-                                  thrust::detail::is_same<CompareOp, thrust::greater<Key>>>>
+                                  thrust::detail::is_same<CompareOp, thrust::greater<Key>>,
+                                  thrust::detail::is_same<CompareOp, thrust::bit_range_less<Key>>>>
     {
     };
 
@@ -83,6 +83,16 @@ using universal_allocator = thrust::mr::stateless_resource_allocator<
   T, thrust::system::hip::universal_memory_resource
 >;
 
+/*! \p hip::universal_host_pinned_pool_allocator allocates host pinned memory
+ *  from a global \p hip::universal_host_pinned_pool_resource. Containers using
+ *  it, such as <tt>thrust::host_vector<T, hip::universal_host_pinned_pool_allocator<T>></tt>,
+ *  make cheap staging buffers for copies to and from the device.
+ */
+template<typename T>
+using universal_host_pinned_pool_allocator = thrust::mr::stateless_resource_allocator<
+  T, thrust::system::hip::universal_host_pinned_pool_resource
+>;
+
 } // namespace hip_rocprim
 
 namespace system { namespace hip
@@ -91,6 +101,7 @@ using thrust::hip_rocprim::malloc;
 using thrust::hip_rocprim::free;
 using thrust::hip_rocprim::allocator;
 using thrust::hip_rocprim::universal_allocator;
+using thrust::hip_rocprim::universal_host_pinned_pool_allocator;
 }} // namespace system::hip
 
 /*! \namespace thrust::hip
@@ -102,6 +113,7 @@ using thrust::hip_rocprim::malloc;
 using thrust::hip_rocprim::free;
 using thrust::hip_rocprim::allocator;
 using thrust::hip_rocprim::universal_allocator;
+using thrust::hip_rocprim::universal_host_pinned_pool_allocator;
 } // namespace hip
 
 THRUST_NAMESPACE_END
@@ -30,6 +30,7 @@
 #include <thrust/system/hip/detail/util.h>
 
 #include <thrust/mr/host_memory_resource.h>
+#include <thrust/mr/pinned_pool.h>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -114,6 +115,13 @@ typedef detail::managed_memory_resource universal_memory_resource;
  *  hip::universal_pointer.
  */
 typedef detail::pinned_memory_resource universal_host_pinned_memory_resource;
+/*! A synchronized pool of host pinned memory for the HIP system, for staging
+ *  buffers of host-device transfers. Obtains memory in large chunks from \p
+ *  universal_host_pinned_memory_resource and keeps freed blocks for reuse, so
+ *  that repeated staging allocations do not call <tt>hipHostMalloc</tt>.
+ */
+typedef thrust::mr::pinned_pool_resource<detail::pinned_memory_resource>
+    universal_host_pinned_pool_resource;
 
 } // end hip
 } // end system
@@ -123,5 +131,6 @@ namespace hip
 using thrust::system::hip::memory_resource;
 using thrust::system::hip::universal_memory_resource;
 using thrust::system::hip::universal_host_pinned_memory_resource;
+using thrust::system::hip::universal_host_pinned_pool_resource;
 }
 THRUST_NAMESPACE_END
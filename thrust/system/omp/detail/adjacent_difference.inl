@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/adjacent_difference.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/adjacent_difference.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator adjacent_difference(execution_policy<DerivedPolicy> &exec,
+                                     InputIterator first,
+                                     InputIterator last,
+                                     OutputIterator result,
+                                     BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_value<InputIterator>::type      InputType;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(n == 0)
+  {
+    // empty range, nothing to do
+    return result;
+  }
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::system::detail::sequential::adjacent_difference(exec, first, last, result, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // the operation may be in-place, so save the element preceding each
+  // interval before any interval is overwritten. only these boundary
+  // elements need to be copied, not the whole input
+  thrust::detail::temporary_array<InputType,DerivedPolicy> boundaries(exec, decomp.size());
+
+  difference_type num_intervals = decomp.size();
+
+  for(difference_type i = 1; i < num_intervals; ++i)
+  {
+    InputIterator prev = first + (decomp[i].begin() - 1);
+    boundaries[i] = *prev;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < num_intervals; ++i)
+  {
+    difference_type begin = decomp[i].begin();
+    difference_type end   = decomp[i].end();
+
+    if(begin == end) continue;
+
+    InputIterator  in  = first + begin;
+    OutputIterator out = result + begin;
+
+    InputType prev = *in;
+
+    if(i == 0)
+    {
+      *out = prev;
+    }
+    else
+    {
+      InputType boundary = boundaries[i];
+      *out = binary_op(prev, boundary);
+    }
+
+    ++in;
+    ++out;
+
+    // read each element before its output slot is written so that
+    // first == result is safe
+    for(difference_type j = begin + 1; j < end; ++j, ++in, ++out)
+    {
+      InputType curr = *in;
+      *out = binary_op(curr, prev);
+      prev = curr;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end adjacent_difference()
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,6 +22,10 @@
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/distance.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/system/omp/detail/tabulate.h>
 
 
 THRUST_NAMESPACE_BEGIN
@@ -47,6 +52,46 @@ template<typename DerivedPolicy,
 } // end copy()
 
 
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::random_access_traversal_tag,
+                        thrust::detail::false_type) // not streamable
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::random_access_traversal_tag,
+                        thrust::detail::true_type) // streamable
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type value_type;
+
+  if(n > 0 && thrust::system::detail::internal::use_streaming_stores<value_type>(n))
+  {
+    // large copies bypass the cache so they don't evict the working set
+    thrust::system::omp::detail::streaming_tabulate_n(thrust::detail::contiguous_iterator_raw_pointer_cast(result), n, thrust::system::detail::internal::streaming_copy_functor<value_type,InputIterator>(first));
+
+    return result + n;
+  }
+
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator>
@@ -56,7 +101,14 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  typedef thrust::system::detail::internal::is_streamable_iterator<OutputIterator> is_streamable;
+
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_copy_size))
+  {
+    return thrust::system::detail::sequential::copy(exec, first, last, result);
+  }
+
+  return thrust::system::omp::detail::dispatch::copy_n(exec, first, thrust::distance(first, last), result, thrust::random_access_traversal_tag(), thrust::detail::integral_constant<bool, is_streamable::value>());
 } // end copy()
 
 
@@ -84,7 +136,14 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  typedef thrust::system::detail::internal::is_streamable_iterator<OutputIterator> is_streamable;
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_copy_size))
+  {
+    return thrust::system::detail::sequential::copy_n(exec, first, n, result);
+  }
+
+  return thrust::system::omp::detail::dispatch::copy_n(exec, first, n, result, thrust::random_access_traversal_tag(), thrust::detail::integral_constant<bool, is_streamable::value>());
 } // end copy_n()
 
 
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/omp/detail/copy_if.h>
 #include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/copy_if.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,6 +44,11 @@ template<typename DerivedPolicy,
                          OutputIterator result,
                          Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::copy_if(exec, first, last, stencil, result, pred);
+  }
+
   // omp prefers generic::copy_if to cpp::copy_if
   return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
 } // end copy_if()
@@ -22,7 +22,10 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/detail/generic/find.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/find.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -39,6 +42,11 @@ InputIterator find_if(execution_policy<DerivedPolicy> &exec,
                       InputIterator last,
                       Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_reduce_size))
+  {
+    return thrust::system::detail::sequential::find_if(exec, first, last, pred);
+  }
+
   // omp prefers generic::find_if to cpp::find_if
   return thrust::system::detail::generic::find_if(exec, first, last, pred);
 }
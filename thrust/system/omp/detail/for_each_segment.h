@@ -0,0 +1,55 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file for_each_segment.h
+ *  \brief Load balanced processing of the segments of a sequence for the OpenMP backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// calls f(i, begin, end) for every segment i = [begin, end) in parallel.
+// Segments much longer than the average are instead processed one after
+// another by f(exec, i, begin, end), which is expected to parallelize.
+template<typename DerivedPolicy,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+  void for_each_segment(execution_policy<DerivedPolicy> &exec,
+                        BeginOffsetIterator begin_offsets_first,
+                        BeginOffsetIterator begin_offsets_last,
+                        EndOffsetIterator end_offsets_first,
+                        SegmentFunction f);
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/omp/detail/for_each_segment.inl>
+
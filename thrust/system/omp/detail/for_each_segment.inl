@@ -0,0 +1,154 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#include <omp.h>
+#endif // omp support
+
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/for_each_segment.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/omp/detail/for_each_segment.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace for_each_segment_detail
+{
+
+
+// threads claim segments dynamically, so a run of long segments does not
+// stall the thread which was statically assigned to it
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentIndex,
+         typename SegmentFunction>
+  void for_each_short_segment(BeginOffsetIterator begin_offsets_first,
+                              EndOffsetIterator end_offsets_first,
+                              SegmentIndex num_segments,
+                              SegmentIndex chunk_size,
+                              typename SegmentFunction::size_type max_segment_size,
+                              SegmentFunction f)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename SegmentFunction::size_type Size;
+
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic, chunk_size))
+  for(SegmentIndex i = 0; i < num_segments; ++i)
+  {
+    const Size begin = static_cast<Size>(begin_offsets_first[i]);
+    const Size end   = static_cast<Size>(end_offsets_first[i]);
+
+    if(end - begin <= max_segment_size)
+    {
+      f(i, begin, end);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end for_each_segment_detail
+
+
+template<typename DerivedPolicy,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+  void for_each_segment(execution_policy<DerivedPolicy> &exec,
+                        BeginOffsetIterator begin_offsets_first,
+                        BeginOffsetIterator begin_offsets_last,
+                        EndOffsetIterator end_offsets_first,
+                        SegmentFunction f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      BeginOffsetIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+  typedef typename SegmentFunction::size_type                            Size;
+
+  const SegmentIndex num_segments = thrust::distance(begin_offsets_first, begin_offsets_last);
+  const SegmentIndex num_threads  = omp_get_num_procs();
+
+  if(num_segments == 0)
+  {
+    return;
+  }
+
+  if(num_threads < 2)
+  {
+    thrust::system::detail::internal::sequential_for_each_segment(begin_offsets_first, begin_offsets_last, end_offsets_first, f);
+    return;
+  }
+
+  const Size total_size = thrust::system::detail::internal::total_segment_size<Size>(begin_offsets_first, begin_offsets_last, end_offsets_first);
+
+  if(thrust::system::detail::internal::is_small_input(total_size, thrust::system::detail::internal::small_reduce_size))
+  {
+    thrust::system::detail::internal::sequential_for_each_segment(begin_offsets_first, begin_offsets_last, end_offsets_first, f);
+    return;
+  }
+
+  const Size max_segment_size = thrust::system::detail::internal::max_sequential_segment_size(total_size, Size(num_threads));
+
+  // claim a few segments at a time to keep the scheduling overhead small
+  // when there are millions of them
+  const SegmentIndex chunk_size = thrust::max<SegmentIndex>(1, num_segments / (64 * num_threads));
+
+  for_each_segment_detail::for_each_short_segment(begin_offsets_first, end_offsets_first, num_segments, chunk_size, max_segment_size, f);
+
+  for(SegmentIndex i = 0; i < num_segments; ++i)
+  {
+    const Size begin = static_cast<Size>(begin_offsets_first[i]);
+    const Size end   = static_cast<Size>(end_offsets_first[i]);
+
+    if(end - begin > max_segment_size)
+    {
+      f(exec, i, begin, end);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
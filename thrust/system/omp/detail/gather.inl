@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/prefetch.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/gather.h>
+#include <thrust/detail/seq.h>
+#include <thrust/gather.h>
+#include <thrust/system/detail/internal/small_input.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type InputType;
+
+  const difference_type n        = thrust::distance(map_first, map_last);
+  const difference_type distance = thrust::system::detail::internal::prefetch_distance<InputType>::value;
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::gather(thrust::seq, map_first, map_last, input_first, result);
+  }
+
+  // random-index gathers are latency-bound, so each thread prefetches the
+  // element it will read a few iterations ahead
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < n; ++i)
+  {
+    if(i + distance < n)
+    {
+      thrust::system::detail::internal::prefetch_for_read(input_first + map_first[i + distance]);
+    }
+
+    OutputIterator out = result + i;
+    *out = input_first[map_first[i]];
+  }
+
+  return result + n;
+} // end gather()
+
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator gather_if(execution_policy<DerivedPolicy> &,
+                           InputIterator1 map_first,
+                           InputIterator1 map_last,
+                           InputIterator2 stencil,
+                           RandomAccessIterator input_first,
+                           OutputIterator result,
+                           Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type InputType;
+
+  const difference_type n        = thrust::distance(map_first, map_last);
+  const difference_type distance = thrust::system::detail::internal::prefetch_distance<InputType>::value;
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::gather_if(thrust::seq, map_first, map_last, stencil, input_first, result, pred);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < n; ++i)
+  {
+    if(i + distance < n)
+    {
+      thrust::system::detail::internal::prefetch_for_read(input_first + map_first[i + distance]);
+    }
+
+    if(pred(stencil[i]))
+    {
+      OutputIterator out = result + i;
+      *out = input_first[map_first[i]];
+    }
+  }
+
+  return result + n;
+} // end gather_if()
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
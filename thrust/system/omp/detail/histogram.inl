@@ -0,0 +1,228 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/histogram.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+// every thread counts its interval of the samples into a private histogram,
+// and the private histograms are summed at the end, so no counter is ever
+// shared between threads
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+  OutputIterator privatized_histogram(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      OutputIterator histogram,
+                                      Size num_bins,
+                                      BinOp bin_op,
+                                      const thrust::system::detail::internal::uniform_decomposition<
+                                        typename thrust::iterator_difference<InputIterator>::type
+                                      > &decomp)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_value<OutputIterator>::type      Counter;
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType num_intervals = decomp.size();
+
+  // pad the private histograms to whole cache lines
+  const Size stride = thrust::system::detail::internal::padded_num_bins<Counter>(num_bins);
+
+  thrust::detail::temporary_array<Counter,DerivedPolicy> counters(exec, num_intervals * stride);
+
+  Counter *counters_ptr = thrust::raw_pointer_cast(counters.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_intervals; ++i)
+  {
+    Counter *local = counters_ptr + i * stride;
+
+    for(Size b = 0; b < num_bins; ++b)
+    {
+      local[b] = Counter(0);
+    }
+
+    for(IndexType j = decomp[i].begin(); j < decomp[i].end(); ++j)
+    {
+      const Size b = bin_op(first[j]);
+
+      if(b < num_bins)
+      {
+        ++local[b];
+      }
+    }
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(Size b = 0; b < num_bins; ++b)
+  {
+    Counter sum = Counter(0);
+
+    for(IndexType i = 0; i < num_intervals; ++i)
+    {
+      sum += counters_ptr[i * stride + b];
+    }
+
+    histogram[b] = sum;
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return histogram + num_bins;
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+  OutputIterator histogram(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator histogram,
+                           Size num_bins,
+                           BinOp bin_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::histogram_detail::histogram(first, last, histogram, num_bins, bin_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  const IndexType num_intervals = decomp.size();
+
+  if(num_intervals < 2)
+  {
+    return thrust::system::detail::sequential::histogram_detail::histogram(first, last, histogram, num_bins, bin_op);
+  }
+
+  // clearing and summing the private histograms costs num_intervals * num_bins;
+  // when that outweighs counting the samples, sorting their bins is cheaper
+  if(static_cast<IndexType>(num_bins) > n / num_intervals + IndexType(thrust::system::detail::internal::max_privatized_bins))
+  {
+    return thrust::system::detail::generic::histogram_detail::sort_histogram(exec, first, last, histogram, num_bins, bin_op);
+  }
+
+  return histogram_detail::privatized_histogram(exec, first, histogram, num_bins, bin_op, decomp);
+#else
+  return histogram + num_bins;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  OutputIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::even_bin_op<Level,Size>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  OutputIterator histogram_range(execution_policy<DerivedPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  typedef typename thrust::iterator_difference<LevelIterator>::type Size;
+
+  const Size num_levels = thrust::distance(levels_first, levels_last);
+
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::range_bin_op<LevelIterator,Size>(levels_first, num_bins));
+} // end histogram_range()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -21,6 +21,8 @@
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/reduce.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -45,6 +47,11 @@ template<typename DerivedPolicy,
 
   const difference_type n = thrust::distance(first,last);
 
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_reduce_size))
+  {
+    return thrust::system::detail::sequential::reduce(exec, first, last, init, binary_op);
+  }
+
   // determine first and second level decomposition
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 = thrust::system::omp::detail::default_decomposition(n);
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
@@ -19,6 +19,8 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/reduce_by_key.h>
 #include <thrust/distance.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -46,6 +48,11 @@ template <typename DerivedPolicy,
                   BinaryPredicate binary_pred,
                   BinaryFunction binary_op)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(keys_first, keys_last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
   // omp prefers generic::reduce_by_key to cpp::reduce_by_key
   return thrust::system::detail::generic::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
 } // end reduce_by_key()
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/remove.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,6 +39,11 @@ template<typename DerivedPolicy,
                             ForwardIterator last,
                             Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::remove_if(exec, first, last, pred);
+  }
+
   // omp prefers generic::remove_if to cpp::remove_if
   return thrust::system::detail::generic::remove_if(exec, first, last, pred);
 }
@@ -51,6 +59,11 @@ template<typename DerivedPolicy,
                             InputIterator stencil,
                             Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::remove_if(exec, first, last, stencil, pred);
+  }
+
   // omp prefers generic::remove_if to cpp::remove_if
   return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
 }
@@ -66,6 +79,11 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::remove_copy_if(exec, first, last, result, pred);
+  }
+
   // omp prefers generic::remove_copy_if to cpp::remove_copy_if
   return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
 }
@@ -82,6 +100,11 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::remove_copy_if(exec, first, last, stencil, result, pred);
+  }
+
   // omp prefers generic::remove_copy_if to cpp::remove_copy_if
   return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
 }
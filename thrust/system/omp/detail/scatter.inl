@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/prefetch.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scatter.h>
+#include <thrust/detail/seq.h>
+#include <thrust/scatter.h>
+#include <thrust/system/detail/internal/small_input.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type OutputType;
+
+  const difference_type n        = thrust::distance(first, last);
+  const difference_type distance = thrust::system::detail::internal::prefetch_distance<OutputType>::value;
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    thrust::scatter(thrust::seq, first, last, map, output);
+    return;
+  }
+
+  // random-index scatters are latency-bound, so each thread prefetches the
+  // element it will write a few iterations ahead
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < n; ++i)
+  {
+    if(i + distance < n)
+    {
+      thrust::system::detail::internal::prefetch_for_write(output + map[i + distance]);
+    }
+
+    RandomAccessIterator out = output + map[i];
+    *out = first[i];
+  }
+} // end scatter()
+
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type OutputType;
+
+  const difference_type n        = thrust::distance(first, last);
+  const difference_type distance = thrust::system::detail::internal::prefetch_distance<OutputType>::value;
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    thrust::scatter_if(thrust::seq, first, last, map, stencil, output, pred);
+    return;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(difference_type i = 0; i < n; ++i)
+  {
+    if(i + distance < n)
+    {
+      thrust::system::detail::internal::prefetch_for_write(output + map[i + distance]);
+    }
+
+    if(pred(stencil[i]))
+    {
+      RandomAccessIterator out = output + map[i];
+      *out = first[i];
+    }
+  }
+} // end scatter_if()
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
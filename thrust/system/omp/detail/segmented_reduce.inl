@@ -0,0 +1,151 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/segmented_reduce.h>
+#include <thrust/system/omp/detail/for_each_segment.h>
+#include <thrust/system/detail/internal/segmented_reduce.h>
+#include <thrust/distance.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_reduce(execution_policy<DerivedPolicy> &exec,
+                                  RandomAccessIterator first,
+                                  BeginOffsetIterator begin_offsets_first,
+                                  BeginOffsetIterator begin_offsets_last,
+                                  EndOffsetIterator end_offsets_first,
+                                  OutputIterator result,
+                                  T init,
+                                  BinaryFunction binary_op)
+{
+  typedef thrust::system::detail::internal::reduce_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    T,
+    BinaryFunction
+  > SegmentFunction;
+
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, init, binary_op));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename UnaryFunction,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator segmented_transform_reduce(execution_policy<DerivedPolicy> &exec,
+                                            RandomAccessIterator first,
+                                            BeginOffsetIterator begin_offsets_first,
+                                            BeginOffsetIterator begin_offsets_last,
+                                            EndOffsetIterator end_offsets_first,
+                                            OutputIterator result,
+                                            UnaryFunction unary_op,
+                                            T init,
+                                            BinaryFunction binary_op)
+{
+  typedef thrust::system::detail::internal::transform_reduce_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    UnaryFunction,
+    T,
+    BinaryFunction
+  > SegmentFunction;
+
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, unary_op, init, binary_op));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_transform_reduce()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  OutputIterator segmented_min_element(execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  typedef thrust::system::detail::internal::min_element_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    BinaryPredicate
+  > SegmentFunction;
+
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, comp));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_min_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename OutputIterator,
+         typename BinaryPredicate>
+  OutputIterator segmented_max_element(execution_policy<DerivedPolicy> &exec,
+                                       RandomAccessIterator first,
+                                       BeginOffsetIterator begin_offsets_first,
+                                       BeginOffsetIterator begin_offsets_last,
+                                       EndOffsetIterator end_offsets_first,
+                                       OutputIterator result,
+                                       BinaryPredicate comp)
+{
+  typedef thrust::system::detail::internal::max_element_segment<
+    RandomAccessIterator,
+    OutputIterator,
+    BinaryPredicate
+  > SegmentFunction;
+
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first, SegmentFunction(first, result, comp));
+
+  return result + thrust::distance(begin_offsets_first, begin_offsets_last);
+} // end segmented_max_element()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
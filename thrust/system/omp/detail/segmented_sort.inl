@@ -0,0 +1,113 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/segmented_sort.h>
+#include <thrust/system/omp/detail/for_each_segment.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort(execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator keys_first,
+                      RandomAccessIterator,
+                      BeginOffsetIterator begin_offsets_first,
+                      BeginOffsetIterator begin_offsets_last,
+                      EndOffsetIterator end_offsets_first,
+                      StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first,
+    thrust::system::detail::internal::key_segment_sorter<false,RandomAccessIterator,StrictWeakOrdering>(keys_first, comp));
+} // end segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort(execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator keys_first,
+                             RandomAccessIterator,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first,
+    thrust::system::detail::internal::key_segment_sorter<true,RandomAccessIterator,StrictWeakOrdering>(keys_first, comp));
+} // end stable_segmented_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void segmented_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                             RandomAccessIterator1 keys_first,
+                             RandomAccessIterator1,
+                             RandomAccessIterator2 values_first,
+                             BeginOffsetIterator begin_offsets_first,
+                             BeginOffsetIterator begin_offsets_last,
+                             EndOffsetIterator end_offsets_first,
+                             StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first,
+    thrust::system::detail::internal::key_value_segment_sorter<false,RandomAccessIterator1,RandomAccessIterator2,StrictWeakOrdering>(keys_first, values_first, comp));
+} // end segmented_sort_by_key()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename StrictWeakOrdering>
+  void stable_segmented_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                                    RandomAccessIterator1 keys_first,
+                                    RandomAccessIterator1,
+                                    RandomAccessIterator2 values_first,
+                                    BeginOffsetIterator begin_offsets_first,
+                                    BeginOffsetIterator begin_offsets_last,
+                                    EndOffsetIterator end_offsets_first,
+                                    StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::for_each_segment(exec, begin_offsets_first, begin_offsets_last, end_offsets_first,
+    thrust::system::detail::internal::key_value_segment_sorter<true,RandomAccessIterator1,RandomAccessIterator2,StrictWeakOrdering>(keys_first, values_first, comp));
+} // end stable_segmented_sort_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
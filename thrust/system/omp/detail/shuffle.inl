@@ -0,0 +1,196 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+namespace shuffle_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator>
+  void bucketed_shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                             RandomIterator first,
+                             OutputIterator result,
+                             const thrust::system::detail::internal::bucketed_shuffle_plan<
+                               typename thrust::iterator_difference<RandomIterator>::type
+                             > &plan,
+                             std::uint64_t seed)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+
+  const Size num_chunks  = plan.num_chunks;
+  const Size num_buckets = plan.num_buckets;
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> counts(exec, num_chunks * num_buckets);
+  thrust::detail::temporary_array<Size,DerivedPolicy> bucket_offsets(exec, num_buckets + 1);
+
+  Size *counts_ptr         = thrust::raw_pointer_cast(counts.data());
+  Size *bucket_offsets_ptr = thrust::raw_pointer_cast(bucket_offsets.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(Size c = 0; c < num_chunks; ++c)
+  {
+    thrust::system::detail::internal::count_chunk(plan, seed, c, counts_ptr + c * num_buckets);
+  }
+
+  thrust::system::detail::internal::scan_counts(plan, counts_ptr, bucket_offsets_ptr);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(Size c = 0; c < num_chunks; ++c)
+  {
+    thrust::system::detail::internal::scatter_chunk(plan, seed, c, first, result, counts_ptr + c * num_buckets);
+  }
+
+  // bucket sizes vary, so hand them out dynamically
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for(Size b = 0; b < num_buckets; ++b)
+  {
+    thrust::system::detail::internal::shuffle_bucket(plan, seed, b, result, bucket_offsets_ptr);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::true_type) // result can't be read
+{
+  thrust::system::detail::generic::shuffle_copy(exec, first, last, result, g);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::false_type) // result can be read
+{
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+  typedef thrust::system::detail::internal::bucketed_shuffle_plan<Size> plan_type;
+
+  const Size n = last - first;
+
+  if(n < plan_type::min_parallel_size)
+  {
+    thrust::system::detail::internal::sequential_shuffle_copy(first, last, result, g);
+    return;
+  }
+
+  const std::uint64_t seed = thrust::system::detail::internal::make_shuffle_seed(g);
+
+  shuffle_detail::bucketed_shuffle_copy(exec, first, result, plan_type(n), seed);
+}
+
+
+} // end shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  typedef typename thrust::iterator_value<RandomIterator>::type      InputType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+  typedef thrust::system::detail::internal::bucketed_shuffle_plan<Size> plan_type;
+
+  const Size n = last - first;
+
+  if(n < plan_type::min_parallel_size)
+  {
+    thrust::system::detail::internal::sequential_shuffle(first, last, g);
+    return;
+  }
+
+  // the buckets are formed out of place
+  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, last);
+
+  shuffle_detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g, thrust::detail::false_type());
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // the buckets are shuffled in place, which needs to read back the output
+  shuffle_detail::shuffle_copy(exec, first, last, result, g,
+    typename thrust::detail::is_output_iterator<OutputIterator>::type());
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -30,6 +30,8 @@
 #include <thrust/merge.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/sort.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -118,8 +120,11 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
 
-  if(first == last)
+  if(thrust::system::detail::internal::is_small_input(last - first, thrust::system::detail::internal::small_sort_size))
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
     return;
+  }
 
   THRUST_PRAGMA_OMP(parallel)
   {
@@ -201,8 +206,11 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
 
-  if(keys_first == keys_last)
+  if(thrust::system::detail::internal::is_small_input(keys_last - keys_first, thrust::system::detail::internal::small_sort_size))
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
     return;
+  }
 
   THRUST_PRAGMA_OMP(parallel)
   {
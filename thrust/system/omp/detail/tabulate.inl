@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/tabulate.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tabulate.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+namespace tabulate_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op,
+                thrust::detail::false_type) // not streamable
+{
+  thrust::system::detail::generic::tabulate(exec, first, last, unary_op);
+}
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op,
+                thrust::detail::true_type) // streamable
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::use_streaming_stores<value_type>(n))
+  {
+    thrust::system::omp::detail::streaming_tabulate_n(thrust::detail::contiguous_iterator_raw_pointer_cast(first), n, thrust::system::detail::internal::streaming_tabulate_functor<value_type,UnaryOperation>(unary_op));
+  }
+  else
+  {
+    thrust::system::detail::generic::tabulate(exec, first, last, unary_op);
+  }
+}
+
+
+} // end tabulate_detail
+
+
+template<typename T,
+         typename Size,
+         typename Function>
+  void streaming_tabulate_n(T *result,
+                            Size n,
+                            Function f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      Function, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  Size num_intervals = decomp.size();
+
+  // a static schedule hands each thread one contiguous interval, matching the
+  // default schedule of the algorithms which later process the result, so
+  // each page ends up on the NUMA node of the thread which will use it
+  THRUST_PRAGMA_OMP(parallel for schedule(static))
+  for(Size i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::streaming_tabulate(result, decomp[i].begin(), decomp[i].end(), f);
+    thrust::system::detail::internal::streaming_store_fence();
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end streaming_tabulate_n()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op)
+{
+  typedef thrust::system::detail::internal::is_streamable_iterator<ForwardIterator> is_streamable;
+
+  tabulate_detail::tabulate(exec, first, last, unary_op, thrust::detail::integral_constant<bool, is_streamable::value>());
+} // end tabulate()
+
+
+} // end detail
+} // end omp
+} // end system
+THRUST_NAMESPACE_END
+
@@ -18,5 +18,6 @@
 
 #include <thrust/detail/config.h>
 
-// this system has no special temporary buffer functions
+// this system inherits get_temporary_buffer & return_temporary_buffer
+#include <thrust/system/cpp/detail/temporary_buffer.h>
 
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/omp/detail/unique.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/unique.h>
 #include <thrust/pair.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -38,6 +41,11 @@ template<typename DerivedPolicy,
                          ForwardIterator last,
                          BinaryPredicate binary_pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::unique(exec,first,last,binary_pred);
+  }
+
   // omp prefers generic::unique to cpp::unique
   return thrust::system::detail::generic::unique(exec,first,last,binary_pred);
 } // end unique()
@@ -53,6 +61,11 @@ template<typename DerivedPolicy,
                              OutputIterator output,
                              BinaryPredicate binary_pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::unique_copy(exec,first,last,output,binary_pred);
+  }
+
   // omp prefers generic::unique_copy to cpp::unique_copy
   return thrust::system::detail::generic::unique_copy(exec,first,last,output,binary_pred);
 } // end unique_copy()
@@ -67,6 +80,11 @@ template<typename DerivedPolicy,
                  ForwardIterator last,
                  BinaryPredicate binary_pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::unique_count(exec,first,last,binary_pred);
+  }
+
   // omp prefers generic::unique_count to cpp::unique_count
   return thrust::system::detail::generic::unique_count(exec,first,last,binary_pred);
 } // end unique_count()
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -44,11 +45,13 @@
 #include <thrust/system/omp/detail/gather.h>
 #include <thrust/system/omp/detail/generate.h>
 #include <thrust/system/omp/detail/get_value.h>
+#include <thrust/system/omp/detail/histogram.h>
 #include <thrust/system/omp/detail/inner_product.h>
 #include <thrust/system/omp/detail/iter_swap.h>
 #include <thrust/system/omp/detail/logical.h>
 #include <thrust/system/omp/detail/malloc_and_free.h>
 #include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/multiway_merge.h>
 #include <thrust/system/omp/detail/mismatch.h>
 #include <thrust/system/omp/detail/partition.h>
 #include <thrust/system/omp/detail/reduce.h>
@@ -59,8 +62,13 @@
 #include <thrust/system/omp/detail/scan.h>
 #include <thrust/system/omp/detail/scan_by_key.h>
 #include <thrust/system/omp/detail/scatter.h>
+#include <thrust/system/omp/detail/segmented_reduce.h>
+#include <thrust/system/omp/detail/segmented_scan.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
+#include <thrust/system/omp/detail/selection.h>
 #include <thrust/system/omp/detail/sequence.h>
 #include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/omp/detail/shuffle.h>
 #include <thrust/system/omp/detail/sort.h>
 #include <thrust/system/omp/detail/swap_ranges.h>
 #include <thrust/system/omp/detail/tabulate.h>
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,7 +19,6 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
-#include <thrust/system/detail/generic/adjacent_difference.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,14 +36,12 @@ template<typename DerivedPolicy,
                                      InputIterator first,
                                      InputIterator last,
                                      OutputIterator result,
-                                     BinaryFunction binary_op)
-{
-  // tbb prefers generic::adjacent_difference to cpp::adjacent_difference
-  return thrust::system::detail::generic::adjacent_difference(exec, first, last, result, binary_op);
-} // end adjacent_difference()
+                                     BinaryFunction binary_op);
 
 } // end detail
 } // end tbb
 } // end system
 THRUST_NAMESPACE_END
 
+#include <thrust/system/tbb/detail/adjacent_difference.inl>
+
@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/adjacent_difference.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/adjacent_difference.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace adjacent_difference_detail
+{
+
+
+template<typename L, typename R>
+  inline L divide_ri(const L x, const R y)
+{
+  return (x + (y - 1)) / y;
+}
+
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename BoundaryIterator,
+         typename Size,
+         typename BinaryFunction>
+  struct body
+{
+  typedef typename thrust::iterator_value<InputIterator>::type InputType;
+
+  InputIterator first;
+  OutputIterator result;
+  BoundaryIterator boundaries;
+  Size n, interval_size;
+  BinaryFunction binary_op;
+
+  body(InputIterator first, OutputIterator result, BoundaryIterator boundaries, Size n, Size interval_size, BinaryFunction binary_op)
+    : first(first), result(result), boundaries(boundaries), n(n), interval_size(interval_size), binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      Size offset_to_first = interval_size * interval_idx;
+      Size offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      InputIterator  in  = first + offset_to_first;
+      OutputIterator out = result + offset_to_first;
+
+      InputType prev = *in;
+
+      if(interval_idx == 0)
+      {
+        *out = prev;
+      }
+      else
+      {
+        InputType boundary = boundaries[interval_idx];
+        *out = binary_op(prev, boundary);
+      }
+
+      ++in;
+      ++out;
+
+      // read each element before its output slot is written so that
+      // first == result is safe
+      for(Size i = offset_to_first + 1; i < offset_to_last; ++i, ++in, ++out)
+      {
+        InputType curr = *in;
+        *out = binary_op(curr, prev);
+        prev = curr;
+      }
+    }
+  }
+};
+
+
+} // end adjacent_difference_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator adjacent_difference(execution_policy<DerivedPolicy> &exec,
+                                     InputIterator first,
+                                     InputIterator last,
+                                     OutputIterator result,
+                                     BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type      InputType;
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef thrust::detail::temporary_array<InputType,DerivedPolicy>  boundary_array;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(n == 0)
+  {
+    // empty range, nothing to do
+    return result;
+  }
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::system::detail::sequential::adjacent_difference(exec, first, last, result, binary_op);
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate O(P) intervals of sequential work
+  // XXX oversubscribing is a tuning opportunity
+  const unsigned int subscription_rate = 4;
+  difference_type interval_size = thrust::max<difference_type>(1, adjacent_difference_detail::divide_ri(n, difference_type(subscription_rate * p)));
+  difference_type num_intervals = adjacent_difference_detail::divide_ri(n, interval_size);
+
+  // the operation may be in-place, so save the element preceding each
+  // interval before any interval is overwritten. only these boundary
+  // elements need to be copied, not the whole input
+  boundary_array boundaries(exec, num_intervals);
+
+  for(difference_type i = 1; i < num_intervals; ++i)
+  {
+    boundaries[i] = first[i * interval_size - 1];
+  }
+
+  typedef adjacent_difference_detail::body<InputIterator,OutputIterator,typename boundary_array::iterator,difference_type,BinaryFunction> Body;
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+                      Body(first, result, boundaries.begin(), n, interval_size, binary_op),
+                      ::tbb::simple_partitioner());
+
+  return result + n;
+} // end adjacent_difference()
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -32,7 +32,7 @@ template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename Predicate>
-  OutputIterator copy_if(tag,
+  OutputIterator copy_if(tag exec,
                          InputIterator1 first,
                          InputIterator1 last,
                          InputIterator2 stencil,
@@ -21,6 +21,8 @@
 #include <thrust/system/tbb/detail/copy_if.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/copy_if.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
 
@@ -101,7 +103,7 @@ template<typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename Predicate>
-  OutputIterator copy_if(tag,
+  OutputIterator copy_if(tag exec,
                          InputIterator1 first,
                          InputIterator1 last,
                          InputIterator2 stencil,
@@ -113,13 +115,15 @@ template<typename InputIterator1,
   
   Size n = thrust::distance(first, last);
 
-  if (n != 0)
+  if (thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_compaction_size))
   {
-    Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), body);
-    thrust::advance(result, body.sum);
+    return thrust::system::detail::sequential::copy_if(exec, first, last, stencil, result, pred);
   }
 
+  Body body(first, stencil, result, pred);
+  ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), body);
+  thrust::advance(result, body.sum);
+
   return result;
 } // end copy_if()
 
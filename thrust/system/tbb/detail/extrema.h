@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/extrema.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -34,6 +37,11 @@ ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_reduce_size))
+  {
+    return thrust::system::detail::sequential::max_element(exec, first, last, comp);
+  }
+
   // tbb prefers generic::max_element to cpp::max_element
   return thrust::system::detail::generic::max_element(exec, first, last, comp);
 } // end max_element()
@@ -44,6 +52,11 @@ ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
                             ForwardIterator last,
                             BinaryPredicate comp)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_reduce_size))
+  {
+    return thrust::system::detail::sequential::min_element(exec, first, last, comp);
+  }
+
   // tbb prefers generic::min_element to cpp::min_element
   return thrust::system::detail::generic::min_element(exec, first, last, comp);
 } // end min_element()
@@ -54,6 +67,11 @@ thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<De
                                                              ForwardIterator last,
                                                              BinaryPredicate comp)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_reduce_size))
+  {
+    return thrust::system::detail::sequential::minmax_element(exec, first, last, comp);
+  }
+
   // tbb prefers generic::minmax_element to cpp::minmax_element
   return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
 } // end minmax_element()
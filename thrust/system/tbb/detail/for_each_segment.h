@@ -0,0 +1,156 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file for_each_segment.h
+ *  \brief Load balanced processing of the segments of a sequence for the TBB backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/for_each_segment.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace for_each_segment_detail
+{
+
+
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+  struct body
+{
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+  typedef typename SegmentFunction::size_type                            Size;
+
+  BeginOffsetIterator begin_offsets_first;
+  EndOffsetIterator end_offsets_first;
+  Size max_segment_size;
+  SegmentFunction f;
+
+  body(BeginOffsetIterator begin_offsets_first, EndOffsetIterator end_offsets_first, Size max_segment_size, SegmentFunction f)
+    : begin_offsets_first(begin_offsets_first), end_offsets_first(end_offsets_first), max_segment_size(max_segment_size), f(f)
+  {}
+
+  void operator()(const ::tbb::blocked_range<SegmentIndex> &r) const
+  {
+    for(SegmentIndex i = r.begin(); i != r.end(); ++i)
+    {
+      const Size begin = static_cast<Size>(begin_offsets_first[i]);
+      const Size end   = static_cast<Size>(end_offsets_first[i]);
+
+      if(end - begin <= max_segment_size)
+      {
+        f(i, begin, end);
+      }
+    }
+  }
+};
+
+
+// idle threads steal ranges of segments from busy ones, so segments of
+// very different lengths still keep every thread busy
+template<typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentIndex,
+         typename SegmentFunction>
+  void for_each_short_segment(BeginOffsetIterator begin_offsets_first,
+                              EndOffsetIterator end_offsets_first,
+                              SegmentIndex num_segments,
+                              typename SegmentFunction::size_type max_segment_size,
+                              SegmentFunction f)
+{
+  ::tbb::parallel_for(::tbb::blocked_range<SegmentIndex>(0, num_segments),
+                      body<BeginOffsetIterator,EndOffsetIterator,SegmentFunction>(begin_offsets_first, end_offsets_first, max_segment_size, f));
+}
+
+
+} // end for_each_segment_detail
+
+
+// calls f(i, begin, end) for every segment i = [begin, end) in parallel.
+// Segments much longer than the average are instead processed one after
+// another by f(exec, i, begin, end), which is expected to parallelize.
+template<typename DerivedPolicy,
+         typename BeginOffsetIterator,
+         typename EndOffsetIterator,
+         typename SegmentFunction>
+  void for_each_segment(execution_policy<DerivedPolicy> &exec,
+                        BeginOffsetIterator begin_offsets_first,
+                        BeginOffsetIterator begin_offsets_last,
+                        EndOffsetIterator end_offsets_first,
+                        SegmentFunction f)
+{
+  typedef typename thrust::iterator_difference<BeginOffsetIterator>::type SegmentIndex;
+  typedef typename SegmentFunction::size_type                            Size;
+
+  const SegmentIndex num_segments = thrust::distance(begin_offsets_first, begin_offsets_last);
+  const Size num_threads = std::thread::hardware_concurrency();
+
+  if(num_segments == 0)
+  {
+    return;
+  }
+
+  if(num_threads < 2)
+  {
+    thrust::system::detail::internal::sequential_for_each_segment(begin_offsets_first, begin_offsets_last, end_offsets_first, f);
+    return;
+  }
+
+  const Size total_size = thrust::system::detail::internal::total_segment_size<Size>(begin_offsets_first, begin_offsets_last, end_offsets_first);
+
+  if(thrust::system::detail::internal::is_small_input(total_size, thrust::system::detail::internal::small_reduce_size))
+  {
+    thrust::system::detail::internal::sequential_for_each_segment(begin_offsets_first, begin_offsets_last, end_offsets_first, f);
+    return;
+  }
+
+  const Size max_segment_size = thrust::system::detail::internal::max_sequential_segment_size(total_size, num_threads);
+
+  for_each_segment_detail::for_each_short_segment(begin_offsets_first, end_offsets_first, num_segments, max_segment_size, f);
+
+  for(SegmentIndex i = 0; i < num_segments; ++i)
+  {
+    const Size begin = static_cast<Size>(begin_offsets_first[i]);
+    const Size end   = static_cast<Size>(end_offsets_first[i]);
+
+    if(end - begin > max_segment_size)
+    {
+      f(exec, i, begin, end);
+    }
+  }
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
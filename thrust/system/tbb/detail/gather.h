@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -14,10 +15,54 @@
  *  limitations under the License.
  */
 
+
+/*! \file gather.h
+ *  \brief TBB implementation of gather algorithms.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &exec,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result);
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator gather_if(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 map_first,
+                           InputIterator1 map_last,
+                           InputIterator2 stencil,
+                           RandomAccessIterator input_first,
+                           OutputIterator result,
+                           Predicate pred);
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
 
-// this system inherits gather
-#include <thrust/system/cpp/detail/gather.h>
+#include <thrust/system/tbb/detail/gather.inl>
 
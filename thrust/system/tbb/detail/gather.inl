@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/prefetch.h>
+#include <thrust/system/tbb/detail/gather.h>
+#include <thrust/detail/seq.h>
+#include <thrust/gather.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace gather_detail
+{
+
+
+template<typename MapIterator,
+         typename StencilIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename Predicate>
+  struct body
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type InputType;
+
+  MapIterator map_first;
+  StencilIterator stencil;
+  RandomAccessIterator input_first;
+  OutputIterator result;
+  Predicate pred;
+
+  body(MapIterator map_first, StencilIterator stencil, RandomAccessIterator input_first, OutputIterator result, Predicate pred)
+    : map_first(map_first), stencil(stencil), input_first(input_first), result(result), pred(pred)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    const Size distance = thrust::system::detail::internal::prefetch_distance<InputType>::value;
+
+    // random-index gathers are latency-bound, so prefetch the element
+    // which will be read a few iterations ahead
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      if(r.end() - i > distance)
+      {
+        thrust::system::detail::internal::prefetch_for_read(input_first + map_first[i + distance]);
+      }
+
+      if(pred(stencil[i]))
+      {
+        OutputIterator out = result + i;
+        *out = input_first[map_first[i]];
+      }
+    }
+  }
+};
+
+
+// gather is gather_if with a stencil which is always true
+struct always_true
+{
+  template<typename T>
+  bool operator()(const T &) const
+  {
+    return true;
+  }
+};
+
+
+template<typename MapIterator,
+         typename StencilIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename Predicate>
+  body<MapIterator,StencilIterator,RandomAccessIterator,OutputIterator,Predicate>
+    make_body(MapIterator map_first, StencilIterator stencil, RandomAccessIterator input_first, OutputIterator result, Predicate pred)
+{
+  return body<MapIterator,StencilIterator,RandomAccessIterator,OutputIterator,Predicate>(map_first, stencil, input_first, result, pred);
+}
+
+
+} // end gather_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename OutputIterator>
+  OutputIterator gather(execution_policy<DerivedPolicy> &,
+                        InputIterator map_first,
+                        InputIterator map_last,
+                        RandomAccessIterator input_first,
+                        OutputIterator result)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(map_first, map_last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::gather(thrust::seq, map_first, map_last, input_first, result);
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, n),
+                      gather_detail::make_body(map_first, map_first, input_first, result, gather_detail::always_true()));
+
+  return result + n;
+} // end gather()
+
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator,
+         typename OutputIterator,
+         typename Predicate>
+  OutputIterator gather_if(execution_policy<DerivedPolicy> &,
+                           InputIterator1 map_first,
+                           InputIterator1 map_last,
+                           InputIterator2 stencil,
+                           RandomAccessIterator input_first,
+                           OutputIterator result,
+                           Predicate pred)
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = thrust::distance(map_first, map_last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    return thrust::gather_if(thrust::seq, map_first, map_last, stencil, input_first, result, pred);
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, n),
+                      gather_detail::make_body(map_first, stencil, input_first, result, pred));
+
+  return result + n;
+} // end gather_if()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/generate.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/system/tbb/detail/generate.h>
+#include <thrust/system/tbb/detail/tabulate.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace generate_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename Generator>
+  OutputIterator generate_n(execution_policy<DerivedPolicy> &exec,
+                            OutputIterator first,
+                            Size n,
+                            Generator gen,
+                            thrust::detail::false_type) // not streamable
+{
+  return thrust::system::detail::generic::generate_n(exec, first, n, gen);
+}
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename Generator>
+  OutputIterator generate_n(execution_policy<DerivedPolicy> &exec,
+                            OutputIterator first,
+                            Size n,
+                            Generator gen,
+                            thrust::detail::true_type) // streamable
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type value_type;
+
+  if(n > 0 && thrust::system::detail::internal::use_streaming_stores<value_type>(n))
+  {
+    thrust::system::tbb::detail::streaming_tabulate_n(thrust::detail::contiguous_iterator_raw_pointer_cast(first), n, thrust::system::detail::internal::streaming_generate_functor<value_type,Generator>(gen));
+
+    return first + n;
+  }
+
+  return thrust::system::detail::generic::generate_n(exec, first, n, gen);
+}
+
+
+} // end generate_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Generator>
+  void generate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                Generator gen)
+{
+  thrust::system::tbb::detail::generate_n(exec, first, thrust::distance(first, last), gen);
+} // end generate()
+
+
+template<typename DerivedPolicy,
+         typename OutputIterator,
+         typename Size,
+         typename Generator>
+  OutputIterator generate_n(execution_policy<DerivedPolicy> &exec,
+                            OutputIterator first,
+                            Size n,
+                            Generator gen)
+{
+  typedef thrust::system::detail::internal::is_streamable_iterator<OutputIterator> is_streamable;
+
+  // fill and uninitialized_fill of trivial types also end up here
+  return generate_detail::generate_n(exec, first, n, gen, thrust::detail::integral_constant<bool, is_streamable::value>());
+} // end generate_n()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,265 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include <thrust/system/tbb/detail/histogram.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+template<typename InputIterator,
+         typename Counter,
+         typename Size,
+         typename BinOp>
+  struct count_body
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  InputIterator first;
+  Counter *counters;
+  IndexType n, interval_size;
+  Size num_bins, stride;
+  BinOp bin_op;
+
+  count_body(InputIterator first, Counter *counters, IndexType n, IndexType interval_size, Size num_bins, Size stride, BinOp bin_op)
+    : first(first), counters(counters), n(n), interval_size(interval_size), num_bins(num_bins), stride(stride), bin_op(bin_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      Counter *local = counters + interval_idx * stride;
+
+      for(Size b = 0; b < num_bins; ++b)
+      {
+        local[b] = Counter(0);
+      }
+
+      IndexType offset_to_first = interval_size * interval_idx;
+      IndexType offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      for(IndexType j = offset_to_first; j < offset_to_last; ++j)
+      {
+        const Size b = bin_op(first[j]);
+
+        if(b < num_bins)
+        {
+          ++local[b];
+        }
+      }
+    }
+  }
+};
+
+
+template<typename Counter,
+         typename OutputIterator,
+         typename IndexType,
+         typename Size>
+  struct merge_body
+{
+  const Counter *counters;
+  OutputIterator histogram;
+  IndexType num_intervals;
+  Size stride;
+
+  merge_body(const Counter *counters, OutputIterator histogram, IndexType num_intervals, Size stride)
+    : counters(counters), histogram(histogram), num_intervals(num_intervals), stride(stride)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size b = r.begin(); b != r.end(); ++b)
+    {
+      Counter sum = Counter(0);
+
+      for(IndexType i = 0; i < num_intervals; ++i)
+      {
+        sum += counters[i * stride + b];
+      }
+
+      OutputIterator out = histogram + b;
+      *out = sum;
+    }
+  }
+};
+
+
+// every task counts its interval of the samples into a private histogram,
+// and the private histograms are summed at the end, so no counter is ever
+// shared between threads
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+  OutputIterator privatized_histogram(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      OutputIterator histogram,
+                                      Size num_bins,
+                                      BinOp bin_op,
+                                      typename thrust::iterator_difference<InputIterator>::type n,
+                                      typename thrust::iterator_difference<InputIterator>::type interval_size)
+{
+  typedef typename thrust::iterator_value<OutputIterator>::type      Counter;
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType num_intervals = (n + interval_size - 1) / interval_size;
+
+  // pad the private histograms to whole cache lines
+  const Size stride = thrust::system::detail::internal::padded_num_bins<Counter>(num_bins);
+
+  thrust::detail::temporary_array<Counter,DerivedPolicy> counters(exec, num_intervals * stride);
+
+  Counter *counters_ptr = thrust::raw_pointer_cast(counters.data());
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_intervals, 1),
+                      count_body<InputIterator,Counter,Size,BinOp>(first, counters_ptr, n, interval_size, num_bins, stride, bin_op),
+                      ::tbb::simple_partitioner());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_bins),
+                      merge_body<Counter,OutputIterator,IndexType,Size>(counters_ptr, histogram, num_intervals, stride));
+
+  return histogram + num_bins;
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename BinOp>
+  OutputIterator histogram(execution_policy<DerivedPolicy> &exec,
+                           InputIterator first,
+                           InputIterator last,
+                           OutputIterator histogram,
+                           Size num_bins,
+                           BinOp bin_op)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::histogram_detail::histogram(first, last, histogram, num_bins, bin_op);
+  }
+
+  // one private histogram per hardware thread
+  const IndexType p = thrust::max<IndexType>(1, std::thread::hardware_concurrency());
+
+  const IndexType interval_size = thrust::max<IndexType>(1, (n + p - 1) / p);
+  const IndexType num_intervals = (n + interval_size - 1) / interval_size;
+
+  if(num_intervals < 2)
+  {
+    return thrust::system::detail::sequential::histogram_detail::histogram(first, last, histogram, num_bins, bin_op);
+  }
+
+  // clearing and summing the private histograms costs num_intervals * num_bins;
+  // when that outweighs counting the samples, sorting their bins is cheaper
+  if(static_cast<IndexType>(num_bins) > interval_size + IndexType(thrust::system::detail::internal::max_privatized_bins))
+  {
+    return thrust::system::detail::generic::histogram_detail::sort_histogram(exec, first, last, histogram, num_bins, bin_op);
+  }
+
+  return histogram_detail::privatized_histogram(exec, first, histogram, num_bins, bin_op, n, interval_size);
+}
+
+
+} // end histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename Size,
+         typename Level>
+  OutputIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator histogram,
+                                Size num_levels,
+                                Level lower_level,
+                                Level upper_level)
+{
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::even_bin_op<Level,Size>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename LevelIterator>
+  OutputIterator histogram_range(execution_policy<DerivedPolicy> &exec,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator histogram,
+                                 LevelIterator levels_first,
+                                 LevelIterator levels_last)
+{
+  typedef typename thrust::iterator_difference<LevelIterator>::type Size;
+
+  const Size num_levels = thrust::distance(levels_first, levels_last);
+
+  if(num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const Size num_bins = num_levels - 1;
+
+  return histogram_detail::histogram(exec, first, last, histogram, num_bins,
+    thrust::system::detail::internal::range_bin_op<LevelIterator,Size>(levels_first, num_bins));
+} // end histogram_range()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
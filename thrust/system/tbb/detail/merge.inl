@@ -18,12 +18,14 @@
 
 #include <thrust/detail/config.h>
 
+#include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/merge.h>
 #include <thrust/binary_search.h>
 #include <thrust/detail/seq.h>
+#include <thrust/system/detail/internal/small_input.h>
 #include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -236,6 +238,11 @@ OutputIterator merge(execution_policy<DerivedPolicy> &,
                      OutputIterator result,
                      StrictWeakOrdering comp)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first1, last1) + thrust::distance(first2, last2), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
   typedef typename merge_detail::range<InputIterator1,InputIterator2,OutputIterator,StrictWeakOrdering> Range;
   typedef          merge_detail::body                                                                   Body;
   Range range(first1, last1, first2, last2, result, comp);
@@ -268,6 +275,11 @@ thrust::pair<OutputIterator1,OutputIterator2>
                OutputIterator2 values_result,
                StrictWeakOrdering comp)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::merge_by_key(thrust::seq, keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+  }
+
   typedef typename merge_by_key_detail::range<InputIterator1,InputIterator2,InputIterator3,InputIterator4,OutputIterator1,OutputIterator2,StrictWeakOrdering> Range;
   typedef          merge_by_key_detail::body                                                                                                                  Body;
 
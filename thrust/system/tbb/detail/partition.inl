@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/partition.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,6 +40,11 @@ template<typename DerivedPolicy,
                                    ForwardIterator last,
                                    Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::stable_partition(exec, first, last, pred);
+  }
+
   // tbb prefers generic::stable_partition to cpp::stable_partition
   return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
 } // end stable_partition()
@@ -52,6 +60,11 @@ template<typename DerivedPolicy,
                                    InputIterator stencil,
                                    Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::stable_partition(exec, first, last, stencil, pred);
+  }
+
   // tbb prefers generic::stable_partition to cpp::stable_partition
   return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
 } // end stable_partition()
@@ -69,6 +82,11 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  }
+
   // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
   return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
 } // end stable_partition_copy()
@@ -89,6 +107,11 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  }
+
   // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
   return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
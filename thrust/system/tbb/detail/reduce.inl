@@ -23,6 +23,8 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/reduce.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -99,7 +101,7 @@ template<typename DerivedPolicy,
          typename InputIterator, 
          typename OutputType,
          typename BinaryFunction>
-  OutputType reduce(execution_policy<DerivedPolicy> &,
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
                     InputIterator begin,
                     InputIterator end,
                     OutputType init,
@@ -109,9 +111,9 @@ template<typename DerivedPolicy,
 
   Size n = thrust::distance(begin, end);
 
-  if (n == 0)
+  if (thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_reduce_size))
   {
-    return init;
+    return thrust::system::detail::sequential::reduce(exec, begin, end, init, binary_op);
   }
   else
   {
@@ -35,7 +35,7 @@ namespace detail
 template<typename InputIterator,
          typename OutputIterator,
          typename BinaryFunction>
-  OutputIterator inclusive_scan(tag,
+  OutputIterator inclusive_scan(tag exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -46,7 +46,7 @@ template<typename InputIterator,
          typename OutputIterator,
          typename T,
          typename BinaryFunction>
-  OutputIterator exclusive_scan(tag,
+  OutputIterator exclusive_scan(tag exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
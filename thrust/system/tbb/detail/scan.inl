@@ -18,6 +18,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/scan.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/scan.h>
 #include <thrust/distance.h>
 #include <thrust/advance.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -195,7 +197,7 @@ struct exclusive_body
 template<typename InputIterator,
          typename OutputIterator,
          typename BinaryFunction>
-  OutputIterator inclusive_scan(tag,
+  OutputIterator inclusive_scan(tag exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -209,6 +211,11 @@ template<typename InputIterator,
   using Size = typename thrust::iterator_difference<InputIterator>::type;
   Size n = thrust::distance(first, last);
 
+  if (thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::inclusive_scan(exec, first, last, result, binary_op);
+  }
+
   if (n != 0)
   {
     typedef typename scan_detail::inclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
@@ -225,7 +232,7 @@ template<typename InputIterator,
          typename OutputIterator,
          typename InitialValueType,
          typename BinaryFunction>
-  OutputIterator exclusive_scan(tag,
+  OutputIterator exclusive_scan(tag exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -240,6 +247,11 @@ template<typename InputIterator,
   using Size = typename thrust::iterator_difference<InputIterator>::type;
   Size n = thrust::distance(first, last);
 
+  if (thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::exclusive_scan(exec, first, last, result, init, binary_op);
+  }
+
   if (n != 0)
   {
     typedef typename scan_detail::exclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
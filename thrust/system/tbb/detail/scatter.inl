@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/prefetch.h>
+#include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/detail/seq.h>
+#include <thrust/scatter.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace scatter_detail
+{
+
+
+template<typename InputIterator,
+         typename MapIterator,
+         typename StencilIterator,
+         typename RandomAccessIterator,
+         typename Predicate>
+  struct body
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type OutputType;
+
+  InputIterator first;
+  MapIterator map;
+  StencilIterator stencil;
+  RandomAccessIterator output;
+  Predicate pred;
+
+  body(InputIterator first, MapIterator map, StencilIterator stencil, RandomAccessIterator output, Predicate pred)
+    : first(first), map(map), stencil(stencil), output(output), pred(pred)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    const Size distance = thrust::system::detail::internal::prefetch_distance<OutputType>::value;
+
+    // random-index scatters are latency-bound, so prefetch the element
+    // which will be written a few iterations ahead
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      if(r.end() - i > distance)
+      {
+        thrust::system::detail::internal::prefetch_for_write(output + map[i + distance]);
+      }
+
+      if(pred(stencil[i]))
+      {
+        RandomAccessIterator out = output + map[i];
+        *out = first[i];
+      }
+    }
+  }
+};
+
+
+// scatter is scatter_if with a stencil which is always true
+struct always_true
+{
+  template<typename T>
+  bool operator()(const T &) const
+  {
+    return true;
+  }
+};
+
+
+template<typename InputIterator,
+         typename MapIterator,
+         typename StencilIterator,
+         typename RandomAccessIterator,
+         typename Predicate>
+  body<InputIterator,MapIterator,StencilIterator,RandomAccessIterator,Predicate>
+    make_body(InputIterator first, MapIterator map, StencilIterator stencil, RandomAccessIterator output, Predicate pred)
+{
+  return body<InputIterator,MapIterator,StencilIterator,RandomAccessIterator,Predicate>(first, map, stencil, output, pred);
+}
+
+
+} // end scatter_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename RandomAccessIterator>
+  void scatter(execution_policy<DerivedPolicy> &,
+               InputIterator1 first,
+               InputIterator1 last,
+               InputIterator2 map,
+               RandomAccessIterator output)
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    thrust::scatter(thrust::seq, first, last, map, output);
+    return;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, n),
+                      scatter_detail::make_body(first, map, first, output, scatter_detail::always_true()));
+} // end scatter()
+
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename InputIterator3,
+         typename RandomAccessIterator,
+         typename Predicate>
+  void scatter_if(execution_policy<DerivedPolicy> &,
+                  InputIterator1 first,
+                  InputIterator1 last,
+                  InputIterator2 map,
+                  InputIterator3 stencil,
+                  RandomAccessIterator output,
+                  Predicate pred)
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::is_small_input(n, thrust::system::detail::internal::small_elementwise_size))
+  {
+    thrust::scatter_if(thrust::seq, first, last, map, stencil, output, pred);
+    return;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, n),
+                      scatter_detail::make_body(first, map, stencil, output, pred));
+} // end scatter_if()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,242 @@
+/*
+ *  Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace shuffle_detail
+{
+
+
+template<typename Size>
+  struct count_body
+{
+  const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan;
+  std::uint64_t seed;
+  Size *counts;
+
+  count_body(const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan, std::uint64_t seed, Size *counts)
+    : plan(plan), seed(seed), counts(counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size c = r.begin(); c != r.end(); ++c)
+    {
+      thrust::system::detail::internal::count_chunk(plan, seed, c, counts + c * plan.num_buckets);
+    }
+  }
+};
+
+
+template<typename Size, typename RandomIterator, typename OutputIterator>
+  struct scatter_body
+{
+  const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan;
+  std::uint64_t seed;
+  RandomIterator first;
+  OutputIterator result;
+  Size *positions;
+
+  scatter_body(const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan, std::uint64_t seed, RandomIterator first, OutputIterator result, Size *positions)
+    : plan(plan), seed(seed), first(first), result(result), positions(positions)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size c = r.begin(); c != r.end(); ++c)
+    {
+      thrust::system::detail::internal::scatter_chunk(plan, seed, c, first, result, positions + c * plan.num_buckets);
+    }
+  }
+};
+
+
+template<typename Size, typename OutputIterator>
+  struct bucket_body
+{
+  const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan;
+  std::uint64_t seed;
+  OutputIterator result;
+  const Size *bucket_offsets;
+
+  bucket_body(const thrust::system::detail::internal::bucketed_shuffle_plan<Size> &plan, std::uint64_t seed, OutputIterator result, const Size *bucket_offsets)
+    : plan(plan), seed(seed), result(result), bucket_offsets(bucket_offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size b = r.begin(); b != r.end(); ++b)
+    {
+      thrust::system::detail::internal::shuffle_bucket(plan, seed, b, result, bucket_offsets);
+    }
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator>
+  void bucketed_shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                             RandomIterator first,
+                             OutputIterator result,
+                             const thrust::system::detail::internal::bucketed_shuffle_plan<
+                               typename thrust::iterator_difference<RandomIterator>::type
+                             > &plan,
+                             std::uint64_t seed)
+{
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+
+  const Size num_chunks  = plan.num_chunks;
+  const Size num_buckets = plan.num_buckets;
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> counts(exec, num_chunks * num_buckets);
+  thrust::detail::temporary_array<Size,DerivedPolicy> bucket_offsets(exec, num_buckets + 1);
+
+  Size *counts_ptr         = thrust::raw_pointer_cast(counts.data());
+  Size *bucket_offsets_ptr = thrust::raw_pointer_cast(bucket_offsets.data());
+
+  // one chunk per task; the chunks are already sized for load balance
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_chunks, 1),
+                      count_body<Size>(plan, seed, counts_ptr),
+                      ::tbb::simple_partitioner());
+
+  thrust::system::detail::internal::scan_counts(plan, counts_ptr, bucket_offsets_ptr);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_chunks, 1),
+                      scatter_body<Size,RandomIterator,OutputIterator>(plan, seed, first, result, counts_ptr),
+                      ::tbb::simple_partitioner());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_buckets),
+                      bucket_body<Size,OutputIterator>(plan, seed, result, bucket_offsets_ptr));
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::true_type) // result can't be read
+{
+  thrust::system::detail::generic::shuffle_copy(exec, first, last, result, g);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &g,
+                    thrust::detail::false_type) // result can be read
+{
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+  typedef thrust::system::detail::internal::bucketed_shuffle_plan<Size> plan_type;
+
+  const Size n = last - first;
+
+  if(n < plan_type::min_parallel_size)
+  {
+    thrust::system::detail::internal::sequential_shuffle_copy(first, last, result, g);
+    return;
+  }
+
+  const std::uint64_t seed = thrust::system::detail::internal::make_shuffle_seed(g);
+
+  shuffle_detail::bucketed_shuffle_copy(exec, first, result, plan_type(n), seed);
+}
+
+
+} // end shuffle_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename URBG>
+  void shuffle(execution_policy<DerivedPolicy> &exec,
+               RandomIterator first,
+               RandomIterator last,
+               URBG &&g)
+{
+  typedef typename thrust::iterator_value<RandomIterator>::type      InputType;
+  typedef typename thrust::iterator_difference<RandomIterator>::type Size;
+  typedef thrust::system::detail::internal::bucketed_shuffle_plan<Size> plan_type;
+
+  const Size n = last - first;
+
+  if(n < plan_type::min_parallel_size)
+  {
+    thrust::system::detail::internal::sequential_shuffle(first, last, g);
+    return;
+  }
+
+  // the buckets are formed out of place
+  thrust::detail::temporary_array<InputType,DerivedPolicy> temp(exec, first, last);
+
+  shuffle_detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g, thrust::detail::false_type());
+} // end shuffle()
+
+
+template<typename DerivedPolicy,
+         typename RandomIterator,
+         typename OutputIterator,
+         typename URBG>
+  void shuffle_copy(execution_policy<DerivedPolicy> &exec,
+                    RandomIterator first,
+                    RandomIterator last,
+                    OutputIterator result,
+                    URBG &&g)
+{
+  // the buckets are shuffled in place, which needs to read back the output
+  shuffle_detail::shuffle_copy(exec, first, last, result, g,
+    typename thrust::detail::is_output_iterator<OutputIterator>::type());
+} // end shuffle_copy()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
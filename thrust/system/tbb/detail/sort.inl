@@ -24,6 +24,8 @@
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/detail/seq.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -231,6 +233,14 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
 
+  // inputs below the threshold of merge_sort are sorted sequentially anyway,
+  // so skip copying them into temporary storage
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first, last), sort_detail::threshold))
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+    return;
+  }
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
   sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
@@ -250,6 +260,12 @@ template<typename DerivedPolicy,
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
   typedef typename thrust::iterator_value<RandomAccessIterator2>::type val_type;
 
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(first1, last1), sort_by_key_detail::threshold))
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);
+    return;
+  }
+
   RandomAccessIterator2 last2 = first2 + thrust::distance(first1, last1);
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
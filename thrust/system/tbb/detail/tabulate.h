@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -14,10 +15,48 @@
  *  limitations under the License.
  */
 
+
+/*! \file tabulate.h
+ *  \brief TBB implementation of tabulate.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+// writes result[i] = f(i) for i in [0, n) in parallel using non-temporal
+// stores. each thread writes, and so first touches, one contiguous range
+template<typename T,
+         typename Size,
+         typename Function>
+  void streaming_tabulate_n(T *result,
+                            Size n,
+                            Function f);
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op);
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
 
-// this system inherits tabulate
-#include <thrust/system/cpp/detail/tabulate.h>
+#include <thrust/system/tbb/detail/tabulate.inl>
 
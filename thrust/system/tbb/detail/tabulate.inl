@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/tabulate.h>
+#include <thrust/system/detail/internal/streaming_store.h>
+#include <thrust/system/tbb/detail/tabulate.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace tabulate_detail
+{
+
+
+template<typename T,
+         typename Function>
+  struct streaming_body
+{
+  T *result;
+  Function f;
+
+  streaming_body(T *result, Function f)
+    : result(result), f(f)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    // TBB may invoke the body concurrently, so work on a copy of f
+    Function local_f = f;
+
+    thrust::system::detail::internal::streaming_tabulate(result, r.begin(), r.end(), local_f);
+    thrust::system::detail::internal::streaming_store_fence();
+  }
+};
+
+
+template<typename T, typename Function>
+  streaming_body<T,Function> make_streaming_body(T *result, Function f)
+{
+  return streaming_body<T,Function>(result, f);
+}
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op,
+                thrust::detail::false_type) // not streamable
+{
+  thrust::system::detail::generic::tabulate(exec, first, last, unary_op);
+}
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op,
+                thrust::detail::true_type) // streamable
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<ForwardIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(thrust::system::detail::internal::use_streaming_stores<value_type>(n))
+  {
+    thrust::system::tbb::detail::streaming_tabulate_n(thrust::detail::contiguous_iterator_raw_pointer_cast(first), n, thrust::system::detail::internal::streaming_tabulate_functor<value_type,UnaryOperation>(unary_op));
+  }
+  else
+  {
+    thrust::system::detail::generic::tabulate(exec, first, last, unary_op);
+  }
+}
+
+
+} // end tabulate_detail
+
+
+template<typename T,
+         typename Size,
+         typename Function>
+  void streaming_tabulate_n(T *result,
+                            Size n,
+                            Function f)
+{
+  // a static partitioner hands each thread one contiguous range, so each
+  // page is first touched by the thread which wrote it
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n),
+                      tabulate_detail::make_streaming_body(result, f),
+                      ::tbb::static_partitioner());
+} // end streaming_tabulate_n()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename UnaryOperation>
+  void tabulate(execution_policy<DerivedPolicy> &exec,
+                ForwardIterator first,
+                ForwardIterator last,
+                UnaryOperation unary_op)
+{
+  typedef thrust::system::detail::internal::is_streamable_iterator<ForwardIterator> is_streamable;
+
+  tabulate_detail::tabulate(exec, first, last, unary_op, thrust::detail::integral_constant<bool, is_streamable::value>());
+} // end tabulate()
+
+
+} // end detail
+} // end tbb
+} // end system
+THRUST_NAMESPACE_END
+
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <thrust/detail/config.h>
+#include <thrust/distance.h>
 #include <thrust/system/tbb/detail/unique_by_key.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/detail/internal/small_input.h>
+#include <thrust/system/detail/sequential/unique_by_key.h>
 #include <thrust/pair.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -41,6 +44,11 @@ template<typename DerivedPolicy,
                   ForwardIterator2 values_first,
                   BinaryPredicate binary_pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(keys_first, keys_last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::unique_by_key(exec,keys_first,keys_last,values_first,binary_pred);
+  }
+
   // tbb prefers generic::unique_by_key to cpp::unique_by_key
   return thrust::system::detail::generic::unique_by_key(exec,keys_first,keys_last,values_first,binary_pred);
 } // end unique_by_key()
@@ -61,6 +69,11 @@ template<typename DerivedPolicy,
                        OutputIterator2 values_output,
                        BinaryPredicate binary_pred)
 {
+  if(thrust::system::detail::internal::is_small_input(thrust::distance(keys_first, keys_last), thrust::system::detail::internal::small_compaction_size))
+  {
+    return thrust::system::detail::sequential::unique_by_key_copy(exec,keys_first,keys_last,values_first,keys_output,values_output,binary_pred);
+  }
+
   // tbb prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
   return thrust::system::detail::generic::unique_by_key_copy(exec,keys_first,keys_last,values_first,keys_output,values_output,binary_pred);
 } // end unique_by_key_copy()
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2023 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -44,11 +45,13 @@
 #include <thrust/system/tbb/detail/gather.h>
 #include <thrust/system/tbb/detail/generate.h>
 #include <thrust/system/tbb/detail/get_value.h>
+#include <thrust/system/tbb/detail/histogram.h>
 #include <thrust/system/tbb/detail/inner_product.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/logical.h>
 #include <thrust/system/tbb/detail/malloc_and_free.h>
 #include <thrust/system/tbb/detail/merge.h>
+#include <thrust/system/tbb/detail/multiway_merge.h>
 #include <thrust/system/tbb/detail/mismatch.h>
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/tbb/detail/reduce.h>
@@ -59,8 +62,13 @@
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/system/tbb/detail/scan_by_key.h>
 #include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/system/tbb/detail/segmented_reduce.h>
+#include <thrust/system/tbb/detail/segmented_scan.h>
+#include <thrust/system/tbb/detail/segmented_sort.h>
+#include <thrust/system/tbb/detail/selection.h>
 #include <thrust/system/tbb/detail/sequence.h>
 #include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/shuffle.h>
 #include <thrust/system/tbb/detail/sort.h>
 #include <thrust/system/tbb/detail/swap_ranges.h>
 #include <thrust/system/tbb/detail/tabulate.h>
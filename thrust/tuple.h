@@ -74,8 +74,6 @@ template <size_t N, class T> struct tuple_element;
 template <class T> struct tuple_size;
 
 
-// get function for non-const cons-lists, returns a reference to the element
-
 /*! The \p get function returns a reference to a \p tuple element of
  *  interest.
  *
@@ -99,12 +97,12 @@ template <class T> struct tuple_size;
  *  \see pair
  *  \see tuple
  */
-template<int N, class HT, class TT>
+template<int N, class... Ts>
 __host__ __device__
 inline typename access_traits<
-                  typename tuple_element<N, detail::cons<HT, TT> >::type
+                  typename tuple_element<N, tuple<Ts...> >::type
                 >::non_const_type
-get(detail::cons<HT, TT>& t);
+get(tuple<Ts...>& t);
 
 
 /*! The \p get function returns a \c const reference to a \p tuple element of
@@ -130,24 +128,27 @@ get(detail::cons<HT, TT>& t);
  *  \see pair
  *  \see tuple
  */
-template<int N, class HT, class TT>
+template<int N, class... Ts>
 __host__ __device__
 inline typename access_traits<
-                  typename tuple_element<N, detail::cons<HT, TT> >::type
+                  typename tuple_element<N, tuple<Ts...> >::type
                 >::const_type
-get(const detail::cons<HT, TT>& t);
+get(const tuple<Ts...>& t);
 
 
 
-/*! \brief \p tuple is a class template that can be instantiated with up to ten
- *  arguments. Each template argument specifies the type of element in the \p
- *  tuple. Consequently, tuples are heterogeneous, fixed-size collections of
- *  values. An instantiation of \p tuple with two arguments is similar to an
- *  instantiation of \p pair with the same two arguments. Individual elements
- *  of a \p tuple may be accessed with the \p get function.
+/*! \brief \p tuple is a class template that can be instantiated with any
+ *  number of arguments. Each template argument specifies the type of element
+ *  in the \p tuple. Consequently, tuples are heterogeneous, fixed-size
+ *  collections of values. An instantiation of \p tuple with two arguments is
+ *  similar to an instantiation of \p pair with the same two arguments.
+ *  Individual elements of a \p tuple may be accessed with the \p get function.
+ *
+ *  The elements are laid out in order, like the members of a \c struct.
+ *  Elements of empty class type take no space, and a \p tuple whose elements
+ *  are all trivially copyable is itself trivially copyable.
  *
- *  \tparam TN The type of the <tt>N</tt> \c tuple element. Thrust's \p tuple
- *          type currently supports up to ten elements.
+ *  \tparam Ts The types of the \c tuple elements.
  *
  *  The following code snippet demonstrates how to create a new \p tuple object
  *  and inspect and modify the value of its elements.
@@ -178,12 +179,11 @@ get(const detail::cons<HT, TT>& t);
  *  \see tuple_size
  *  \see tie
  */
-template <class T0, class T1, class T2, class T3, class T4,
-          class T5, class T6, class T7, class T8, class T9>
+template <class... Ts>
   class tuple
   /*! \cond
    */
-    : public detail::map_tuple_to_cons<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9>::type
+    : public detail::tuple_impl<thrust::make_index_sequence<sizeof...(Ts)>, Ts...>
   /*! \endcond
    */
 {
@@ -191,7 +191,19 @@ template <class T0, class T1, class T2, class T3, class T4,
    */
 
   private:
-  typedef typename detail::map_tuple_to_cons<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9>::type inherited;
+  typedef detail::tuple_impl<thrust::make_index_sequence<sizeof...(Ts)>, Ts...> inherited;
+
+  template<class... Us>
+    struct is_prefix
+      : detail::integral_constant<
+          bool,
+          (0 < sizeof...(Us)) && (sizeof...(Us) < sizeof...(Ts)) &&
+          detail::tuple_prefix_convertible<
+            tuple<Us...>, tuple,
+            thrust::make_index_sequence<(sizeof...(Us) < sizeof...(Ts)) ? sizeof...(Us) : 0>
+          >::value
+        >
+  {};
 
   /*! \endcond
    */
@@ -203,161 +215,68 @@ template <class T0, class T1, class T2, class T3, class T4,
   inline __host__ __device__
   tuple(void) {}
 
-  /*! \p tuple's one-argument constructor copy constructs the first element from the given parameter
-   *     and intializes all other elements.
-   *  \param t0 The value to assign to this \p tuple's first element.
+  /*! \p tuple's element-wise constructor copy constructs each element from
+   *     the corresponding parameter.
+   *  \param ts The values to assign to this \p tuple's elements.
    */
   inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0)
-    : inherited(t0,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
-
-  /*! \p tuple's one-argument constructor copy constructs the first two elements from the given parameters
-   *     and intializes all other elements.
-   *  \param t0 The value to assign to this \p tuple's first element.
-   *  \param t1 The value to assign to this \p tuple's second element.
-   *  \note \p tuple's constructor has ten variants of this form, the rest of which are ommitted here for brevity.
+  tuple(typename access_traits<Ts>::parameter_type... ts)
+    : inherited(detail::tuple_init_tag(), ts...) {}
+
+  /*! \p tuple's prefix constructor copy constructs the first elements from
+   *     the given parameters and initializes all other elements.
+   *  \param us The values to assign to this \p tuple's first elements.
    */
+  template<class... Us,
+           typename std::enable_if<is_prefix<Us...>::value, int>::type = 0>
   inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1)
-    : inherited(t0, t1,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
+  tuple(const Us&... us)
+    : inherited(detail::tuple_prefix_tag(), tuple<const Us&...>(us...)) {}
 
   /*! \cond
    */
 
+#if THRUST_CPP_DIALECT >= 2011
+  tuple(const tuple &) = default;
+  tuple(tuple &&) = default;
+  tuple& operator=(const tuple &) = default;
+  tuple& operator=(tuple &&) = default;
+#endif
+
+  template<class... Us,
+           typename std::enable_if<
+             detail::tuple_constructible<tuple<Us...>, tuple>::value, int
+           >::type = 0>
   inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2)
-    : inherited(t0, t1, t2,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
-
-  inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3)
-    : inherited(t0, t1, t2, t3,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
-
-  inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4)
-    : inherited(t0, t1, t2, t3, t4,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
-
-  inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4,
-        typename access_traits<T5>::parameter_type t5)
-    : inherited(t0, t1, t2, t3, t4, t5,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
-
-  inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4,
-        typename access_traits<T5>::parameter_type t5,
-        typename access_traits<T6>::parameter_type t6)
-    : inherited(t0, t1, t2, t3, t4, t5, t6,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
+  tuple(const tuple<Us...>& p)
+    : inherited(detail::tuple_convert_tag(), p)
+  {}
 
+  __thrust_exec_check_disable__
+  template <class... Us>
   inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4,
-        typename access_traits<T5>::parameter_type t5,
-        typename access_traits<T6>::parameter_type t6,
-        typename access_traits<T7>::parameter_type t7)
-    : inherited(t0, t1, t2, t3, t4, t5, t6, t7,
-                static_cast<const null_type&>(null_type()),
-                static_cast<const null_type&>(null_type())) {}
+  tuple& operator=(const tuple<Us...>& k)
+  {
+    static_assert(sizeof...(Us) == sizeof...(Ts), "cannot assign tuples of different lengths");
 
-  inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4,
-        typename access_traits<T5>::parameter_type t5,
-        typename access_traits<T6>::parameter_type t6,
-        typename access_traits<T7>::parameter_type t7,
-        typename access_traits<T8>::parameter_type t8)
-    : inherited(t0, t1, t2, t3, t4, t5, t6, t7, t8,
-                static_cast<const null_type&>(null_type())) {}
+    inherited::assign(k);
+    return *this;
+  }
 
+  template<int N>
   inline __host__ __device__
-  tuple(typename access_traits<T0>::parameter_type t0,
-        typename access_traits<T1>::parameter_type t1,
-        typename access_traits<T2>::parameter_type t2,
-        typename access_traits<T3>::parameter_type t3,
-        typename access_traits<T4>::parameter_type t4,
-        typename access_traits<T5>::parameter_type t5,
-        typename access_traits<T6>::parameter_type t6,
-        typename access_traits<T7>::parameter_type t7,
-        typename access_traits<T8>::parameter_type t8,
-        typename access_traits<T9>::parameter_type t9)
-    : inherited(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9) {}
-
-
-  template<class U1, class U2>
-  inline __host__ __device__
-  tuple(const detail::cons<U1, U2>& p) : inherited(p) {}
+  typename access_traits<typename tuple_element<N, tuple>::type>::non_const_type
+  get()
+  {
+    return thrust::get<N>(*this);
+  }
 
-  __thrust_exec_check_disable__
-  template <class U1, class U2>
+  template<int N>
   inline __host__ __device__
-  tuple& operator=(const detail::cons<U1, U2>& k)
+  typename access_traits<typename tuple_element<N, tuple>::type>::const_type
+  get() const
   {
-    inherited::operator=(k);
-    return *this;
+    return thrust::get<N>(*this);
   }
 
   /*! \endcond
@@ -370,9 +289,10 @@ template <class T0, class T1, class T2, class T3, class T4,
   template <class U1, class U2>
   __host__ __device__ inline
   tuple& operator=(const thrust::pair<U1, U2>& k) {
-    //BOOST_STATIC_ASSERT(length<tuple>::value == 2);// check_length = 2
-    this->head = k.first;
-    this->tail.head = k.second;
+    static_assert(sizeof...(Ts) == 2, "only a tuple of two elements may be assigned from a pair");
+
+    thrust::get<0>(*this) = k.first;
+    thrust::get<1>(*this) = k.second;
     return *this;
   }
 
@@ -391,160 +311,52 @@ template <class T0, class T1, class T2, class T3, class T4,
  */
 
 template <>
-class tuple<null_type, null_type, null_type, null_type, null_type, null_type, null_type, null_type, null_type, null_type>  :
-  public null_type
+class tuple<>
 {
 public:
-  typedef null_type inherited;
+  inline __host__ __device__
+  void swap(tuple &) {}
 };
 
 /*! \endcond
  */
 
 
-/*! This version of \p make_tuple creates a new \c tuple object from a
- *  single object.
+/*! \p make_tuple creates a new \c tuple object from a list of objects.
  *
- *  \param t0 The object to copy from.
- *  \return A \p tuple object with a single member which is a copy of \p t0.
+ *  \param ts The objects to copy from.
+ *  \return A \p tuple object whose members are copies of \p ts.
  */
-template<class T0>
+template<class... Ts>
 __host__ __device__ inline
-  typename detail::make_tuple_mapper<T0>::type
-    make_tuple(const T0& t0);
+  typename detail::make_tuple_mapper<Ts...>::type
+    make_tuple(const Ts&... ts);
 
-/*! This version of \p make_tuple creates a new \c tuple object from two
- *  objects.
- *
- *  \param t0 The first object to copy from.
- *  \param t1 The second object to copy from.
- *  \return A \p tuple object with two members which are copies of \p t0
- *          and \p t1.
- *
- *  \note \p make_tuple has ten variants, the rest of which are omitted here
- *        for brevity.
- */
-template<class T0, class T1>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1>::type
-    make_tuple(const T0& t0, const T1& t1);
-
-/*! This version of \p tie creates a new \c tuple whose single element is
- *  a reference which refers to this function's argument.
- *
- *  \param t0 The object to reference.
- *  \return A \p tuple object with one member which is a reference to \p t0.
- */
-template<typename T0>
-__host__ __device__ inline
-tuple<T0&> tie(T0& t0);
-
-/*! This version of \p tie creates a new \c tuple of references object which
- *  refers to this function's arguments.
- *
- *  \param t0 The first object to reference.
- *  \param t1 The second object to reference.
- *  \return A \p tuple object with two members which are references to \p t0
- *          and \p t1.
+/*! \p tie creates a new \c tuple of references object which refers to this
+ *  function's arguments.
  *
- *  \note \p tie has ten variants, the rest of which are omitted here for
- *           brevity.
+ *  \param ts The objects to reference.
+ *  \return A \p tuple object whose members are references to \p ts.
  */
-template<typename T0, typename T1>
+template<typename... Ts>
 __host__ __device__ inline
-tuple<T0&,T1&> tie(T0& t0, T1& t1);
+tuple<Ts&...> tie(Ts&... ts);
 
 /*! \p swap swaps the contents of two <tt>tuple</tt>s.
  *
  *  \param x The first \p tuple to swap.
  *  \param y The second \p tuple to swap.
  */
-template<
-  typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9,
-  typename U0, typename U1, typename U2, typename U3, typename U4, typename U5, typename U6, typename U7, typename U8, typename U9
->
+template<typename... Ts, typename... Us>
 inline __host__ __device__
-void swap(tuple<T0,T1,T2,T3,T4,T5,T6,T7,T8,T9> &x,
-          tuple<U0,U1,U2,U3,U4,U5,U6,U7,U8,U9> &y);
+void swap(tuple<Ts...> &x,
+          tuple<Us...> &y);
 
 
 
 /*! \cond
  */
 
-template<class T0, class T1, class T2>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2);
-
-template<class T0, class T1, class T2, class T3>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3);
-
-template<class T0, class T1, class T2, class T3, class T4>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4);
-
-template<class T0, class T1, class T2, class T3, class T4, class T5>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4, T5>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5);
-
-template<class T0, class T1, class T2, class T3, class T4, class T5, class T6>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4, T5, T6>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6);
-
-template<class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4, T5, T6, T7>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6, const T7& t7);
-
-template<class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7, class T8>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4, T5, T6, T7, T8>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6, const T7& t7, const T8& t8);
-
-template<class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7, class T8, class T9>
-__host__ __device__ inline
-  typename detail::make_tuple_mapper<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9>::type
-    make_tuple(const T0& t0, const T1& t1, const T2& t2, const T3& t3, const T4& t4, const T5& t5, const T6& t6, const T7& t7, const T8& t8, const T9& t9);
-
-template<typename T0, typename T1, typename T2>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&> tie(T0 &t0, T1 &t1, T2 &t2);
-
-template<typename T0, typename T1, typename T2, typename T3>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4, typename T5>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&,T5&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4, T5 &t5);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&,T5&,T6&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4, T5 &t5, T6 &t6);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&,T5&,T6&,T7&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4, T5 &t5, T6 &t6, T7 &t7);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&,T5&,T6&,T7&,T8&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4, T5 &t5, T6 &t6, T7 &t7, T8 &t8);
-
-template<typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>
-__host__ __device__ inline
-tuple<T0&,T1&,T2&,T3&,T4&,T5&,T6&,T7&,T8&,T9&> tie(T0 &t0, T1 &t1, T2 &t2, T3 &t3, T4 &t4, T5 &t5, T6 &t6, T7 &t7, T8 &t8, T9 &t9);
-
-
 __host__ __device__ inline
 bool operator==(const null_type&, const null_type&);
 